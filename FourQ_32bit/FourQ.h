@@ -81,6 +81,21 @@ extern "C" {
 #endif
 
 
+// Definition of SIMD support for x86 (SSE2 or AVX2)
+
+#define NO_SIMD_SUPPORT 0
+#define SSE2_SUPPORT    1
+#define AVX2_SUPPORT    2
+
+#if (TARGET == TARGET_x86) && defined(_AVX2_)
+    #define SIMD_SUPPORT AVX2_SUPPORT       // AVX2 support selection 
+#elif (TARGET == TARGET_x86) && defined(_SSE2_)
+    #define SIMD_SUPPORT SSE2_SUPPORT       // SSE2 support selection 
+#else
+    #define SIMD_SUPPORT NO_SIMD_SUPPORT
+#endif
+
+
 // Constants
 
 #define RADIX64         64
@@ -243,6 +243,12 @@ void v2mul1271(v2elm_t a, v2elm_t b, v2elm_t c);
 // Quadratic extension field inversion, af = a^-1 = a^(p-2) in GF((2^127-1)^2)
 void v2inv1271(v2elm_t a);
 
+#if (SIMD_SUPPORT != NO_SIMD_SUPPORT)
+// Quadratic extension field multiplication and squaring using SSE2 or AVX2 instructions
+void v2mul1271_a(uint32_t* a, uint32_t* b, uint32_t* c);
+void v2sqr1271_a(uint32_t* a, uint32_t* c);
+#endif
+
 /************ Curve and recoding functions *************/
 
 // Normalize projective twisted Edwards point Q = (X,Y,Z) -> P = (x,y)
@@ -113,6 +113,9 @@ void v2mod1271(uint32_t* a, uint32_t* c)
 
 void v2mul1271(v2elm_t a, v2elm_t b, v2elm_t c)
 { // GF(p^2) multiplication, c = a*b in GF((2^127-1)^2) 
+#if (SIMD_SUPPORT != NO_SIMD_SUPPORT)
+    v2mul1271_a((uint32_t*)a, (uint32_t*)b, (uint32_t*)c);
+#else
     velm_t t1, t2, t3, t4;
     
     vmul1271(&a[0], &b[0], t1);                        // t1 = a0*b0
@@ -123,11 +126,15 @@ void v2mul1271(v2elm_t a, v2elm_t b, v2elm_t c)
     vmul1271(t3, t4, t3);                              // t3 = (a0+a1)*(b0+b1)
     vsub1271(t3, t1, t3);                              // t3 = (a0+a1)*(b0+b1) - a0*b0
     vsub1271(t3, t2, &c[VWORDS_FIELD]);                // c[1] = (a0+a1)*(b0+b1) - a0*b0 - a1*b1
+#endif
 }
 
 
 void v2sqr1271(v2elm_t a, v2elm_t c)
 { // GF(p^2) squaring, c = a^2 in GF((2^127-1)^2) 
+#if (SIMD_SUPPORT != NO_SIMD_SUPPORT)
+    v2sqr1271_a((uint32_t*)a, (uint32_t*)c);
+#else
     velm_t t1, t2, t3;
 
     vadd1271(&a[0], &a[VWORDS_FIELD], t1);             // t1 = a0+a1 
@@ -135,6 +142,7 @@ void v2sqr1271(v2elm_t a, v2elm_t c)
     vmul1271(&a[0], &a[VWORDS_FIELD], t3);             // t3 = a0*a1
     vmul1271(t1, t2, &c[0]);                           // c0 = (a0+a1)(a0-a1)
     vadd1271(t3, t3, &c[VWORDS_FIELD]);                // c1 = 2a0*a1
+#endif
 }
 
 
@@ -102,6 +102,24 @@ bool fp_test()
 }
 
 
+static void v2unreduce1271_test(v2elm_t a)
+{ // Rewrite a with wide signed limbs representing the same GF(p^2) element, as produced by the point formulas
+    unsigned int i, j;
+    int32_t d;
+
+    for (j = 0; j < 2*VWORDS_FIELD; j += VWORDS_FIELD) {
+        for (i = 0; i < VWORDS_FIELD-1; i++) {
+            d = (int32_t)(a[j+i+1] & 0x3) - 2;                        // Move d*2^26 from limb i+1 to limb i
+            a[j+i] += (uint32_t)d << 26;
+            a[j+i+1] -= (uint32_t)d;
+        }
+        d = (int32_t)(a[j] & 0x3) - 2;                                // Move d*2^127 = d (mod p) from limb 0 to limb 4
+        a[j+4] += (uint32_t)d << 23;
+        a[j] -= (uint32_t)d;
+    }
+}
+
+
 bool fp2_test()
 { // Tests for the quadratic extension field arithmetic
     bool OK = true;
@@ -175,6 +193,30 @@ bool fp2_test()
     else { printf("  GF(p^2) squaring tests... FAILED"); printf("\n"); return false; }
     printf("\n");
     
+    // GF(p^2) multiplication and squaring with unreduced inputs
+    passed = 1;
+    for (n=0; n<TEST_LOOPS; n++)
+    {
+        v2random1271_test(va); v2random1271_test(vb);
+        v2copy1271(va, vc); v2unreduce1271_test(vc);
+        v2copy1271(vb, vd); v2unreduce1271_test(vd);
+            
+        v2mul1271(va, vb, ve);                                        // e = a*b
+        v2mod1271(ve, ve); from_ext_to_std(ve, e);
+        v2mul1271(vc, vd, vf);                                        // f = a*b with unreduced inputs
+        v2mod1271(vf, vf); from_ext_to_std(vf, f);
+        if (fp2compare64((uint64_t*)e,(uint64_t*)f)!=0) { passed=0; break; }
+
+        v2sqr1271(va, ve);                                            // e = a^2
+        v2mod1271(ve, ve); from_ext_to_std(ve, e);
+        v2sqr1271(vc, vf);                                            // f = a^2 with unreduced input
+        v2mod1271(vf, vf); from_ext_to_std(vf, f);
+        if (fp2compare64((uint64_t*)e,(uint64_t*)f)!=0) { passed=0; break; }
+    }
+    if (passed==1) printf("  GF(p^2) unreduced input tests.................................................................... PASSED");
+    else { printf("  GF(p^2) unreduced input tests... FAILED"); printf("\n"); return false; }
+    printf("\n");
+    
     // GF(p^2) inversion using p = 2^127-1
     passed = 1;
     for (n=0; n<TEST_LOOPS; n++)
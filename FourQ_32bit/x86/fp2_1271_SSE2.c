@@ -0,0 +1,198 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: arithmetic over GF(p) and GF(p^2) using SSE2 and AVX2 intrinsics
+*
+* Limb products are computed with the unsigned 32x32->64-bit multiplication (pmuludq),
+* two (SSE2) or four (AVX2) at a time. Since SSE2 has neither a signed multiplication
+* nor a 64-bit arithmetic shift, inputs in the 23/26-bit redundant representation are
+* first carried into non-negative digits, so that all partial sums are non-negative.
+************************************************************************************/
+
+#include "../FourQ_internal.h"
+#include <emmintrin.h>
+#if (SIMD_SUPPORT == AVX2_SUPPORT)
+    #include <immintrin.h>
+#endif
+
+#define mask_26        (((uint32_t)1 << 26) - 1)
+#define mask_23        (((uint32_t)1 << 23) - 1)
+
+
+static __inline void transpose_x4(__m128i x0, __m128i x1, __m128i x2, __m128i x3, __m128i* L)
+{ // Transposition of the 4 lower limbs of four field elements, L[i] = (x0[i], x1[i], x2[i], x3[i])
+    __m128i t0, t1, t2, t3;
+
+    t0 = _mm_unpacklo_epi32(x0, x1);
+    t1 = _mm_unpacklo_epi32(x2, x3);
+    t2 = _mm_unpackhi_epi32(x0, x1);
+    t3 = _mm_unpackhi_epi32(x2, x3);
+    L[0] = _mm_unpacklo_epi64(t0, t1);
+    L[1] = _mm_unpackhi_epi64(t0, t1);
+    L[2] = _mm_unpacklo_epi64(t2, t3);
+    L[3] = _mm_unpackhi_epi64(t2, t3);
+}
+
+
+static __inline void vcarry1271_x4(__m128i* L)
+{ // Carry propagation of four field elements in transposed form, L[i] = limb i of each element
+  // Inputs: signed limbs in the range (-2^30, 2^30)
+  // Output: non-negative limbs in the range [0, 2^27+2^8) (limbs 0-3) and [0, 2^24) (limb 4). If the top carry
+  //         is negative p is added, so that an element with fully reduced limbs is returned unchanged
+    const __m128i m26 = _mm_set1_epi32(mask_26), m23 = _mm_set1_epi32(mask_23);
+    __m128i rem;
+
+    L[1] = _mm_add_epi32(L[1], _mm_srai_epi32(L[0], 26)); L[0] = _mm_and_si128(L[0], m26);
+    L[2] = _mm_add_epi32(L[2], _mm_srai_epi32(L[1], 26)); L[1] = _mm_and_si128(L[1], m26);
+    L[3] = _mm_add_epi32(L[3], _mm_srai_epi32(L[2], 26)); L[2] = _mm_and_si128(L[2], m26);
+    L[4] = _mm_add_epi32(L[4], _mm_srai_epi32(L[3], 26)); L[3] = _mm_and_si128(L[3], m26);
+    rem  = _mm_srai_epi32(L[4], 23);                      L[4] = _mm_and_si128(L[4], m23);
+    L[0] = _mm_add_epi32(L[0], rem);
+
+    rem  = _mm_srai_epi32(rem, 31);                        // If rem < 0 then add p
+    L[0] = _mm_add_epi32(L[0], _mm_and_si128(rem, m26));
+    L[1] = _mm_add_epi32(L[1], _mm_and_si128(rem, m26));
+    L[2] = _mm_add_epi32(L[2], _mm_and_si128(rem, m26));
+    L[3] = _mm_add_epi32(L[3], _mm_and_si128(rem, m26));
+    L[4] = _mm_add_epi32(L[4], _mm_and_si128(rem, m23));
+}
+
+
+static __inline void vmul1271_x2(__m128i* A, __m128i* B, __m128i* C)
+{ // Two field multiplications without reduction, C[k] += sum(A[i]*B[k-i]) + 8*sum(A[i]*B[k+5-i])
+  // Operands in 32-bit lanes 0 and 2, products in the two 64-bit lanes. B is assumed to be < 2^28
+    __m128i B8[5];
+    int i, k;
+
+    for (i = 0; i < VWORDS_FIELD; i++) {
+        B8[i] = _mm_slli_epi32(B[i], 3);
+    }
+    for (k = 0; k < VWORDS_FIELD; k++) {
+        for (i = 0; i <= k; i++) {
+            C[k] = _mm_add_epi64(C[k], _mm_mul_epu32(A[i], B[k-i]));
+        }
+        for (i = k+1; i < VWORDS_FIELD; i++) {
+            C[k] = _mm_add_epi64(C[k], _mm_mul_epu32(A[i], B8[k+VWORDS_FIELD-i]));
+        }
+    }
+}
+
+
+static __inline void vreduce1271_x2(__m128i* C, __m128i* c)
+{ // Reduction modulo p = 2^127-1 of two unreduced products in 64-bit lanes
+  // Output: 23/26/26/26/26-bit limbs in lanes 0 and 2
+    const __m128i m26 = _mm_set_epi32(0, mask_26, 0, mask_26), m23 = _mm_set_epi32(0, mask_23, 0, mask_23);
+    __m128i r0, r1;
+
+                                                      r0   = _mm_and_si128(C[0], m26);
+    C[1] = _mm_add_epi64(C[1], _mm_srli_epi64(C[0], 26)); r1   = _mm_and_si128(C[1], m26);
+    C[2] = _mm_add_epi64(C[2], _mm_srli_epi64(C[1], 26)); c[2] = _mm_and_si128(C[2], m26);
+    C[3] = _mm_add_epi64(C[3], _mm_srli_epi64(C[2], 26)); c[3] = _mm_and_si128(C[3], m26);
+    C[4] = _mm_add_epi64(C[4], _mm_srli_epi64(C[3], 26)); c[4] = _mm_and_si128(C[4], m23);
+
+    C[0] = _mm_add_epi64(r0, _mm_srli_epi64(C[4], 23));
+    c[0] = _mm_and_si128(C[0], m26);
+    c[1] = _mm_add_epi64(r1, _mm_srli_epi64(C[0], 26));
+}
+
+
+static __inline void vstore1271_x2(__m128i* c, uint32_t* c0, uint32_t* c1)
+{ // Store the field elements in lanes 0 and 2 of c to c0 and c1
+    __m128i x, y;
+
+    x = _mm_or_si128(c[0], _mm_slli_epi64(c[1], 32));
+    y = _mm_or_si128(c[2], _mm_slli_epi64(c[3], 32));
+    _mm_storeu_si128((__m128i*)c0, _mm_unpacklo_epi64(x, y));
+    _mm_storeu_si128((__m128i*)c1, _mm_unpackhi_epi64(x, y));
+    c0[4] = (uint32_t)_mm_cvtsi128_si32(c[4]);
+    c1[4] = (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(c[4], 8));
+}
+
+
+void v2mul1271_a(uint32_t* a, uint32_t* b, uint32_t* c)
+{ // Multiplication over GF((2^127-1)^2) using SSE2 (or AVX2) instructions, c = a*b
+  // Computes c0 = a0*b0 + a1*(4p-b1) and c1 = a0*b1 + a1*b0 in parallel. c may alias a or b
+    __m128i L[5], A[5], B[5], C[5], t;
+    const __m128i p4 = _mm_set1_epi32(4*mask_26), p4_top = _mm_set1_epi32(4*mask_23);
+    int i;
+
+    // L[i] = (a0[i], a1[i], b0[i], b1[i])
+    transpose_x4(_mm_loadu_si128((__m128i*)&a[0]), _mm_loadu_si128((__m128i*)&a[VWORDS_FIELD]),
+                 _mm_loadu_si128((__m128i*)&b[0]), _mm_loadu_si128((__m128i*)&b[VWORDS_FIELD]), L);
+    L[4] = _mm_set_epi32((int)b[9], (int)b[4], (int)a[9], (int)a[4]);
+    vcarry1271_x4(L);
+
+#if (SIMD_SUPPORT == AVX2_SUPPORT)
+    {
+    __m256i A4[5], B4[5], B8[5], C4[5];
+    const __m256i idx_a = _mm256_set_epi32(1, 1, 1, 1, 0, 0, 0, 0), idx_b = _mm256_set_epi32(2, 2, 7, 7, 3, 3, 2, 2);
+    int k;
+
+    // 64-bit lanes: (a0*b0, a0*b1, a1*(4p-b1), a1*b0)
+    for (i = 0; i < VWORDS_FIELD; i++) {
+        t = _mm_sub_epi32((i == 4) ? p4_top : p4, L[i]);
+        A4[i] = _mm256_permutevar8x32_epi32(_mm256_castsi128_si256(L[i]), idx_a);
+        B4[i] = _mm256_permutevar8x32_epi32(_mm256_inserti128_si256(_mm256_castsi128_si256(L[i]), t, 1), idx_b);
+        B8[i] = _mm256_slli_epi32(B4[i], 3);
+        C4[i] = _mm256_setzero_si256();
+    }
+    for (k = 0; k < VWORDS_FIELD; k++) {
+        for (i = 0; i <= k; i++) {
+            C4[k] = _mm256_add_epi64(C4[k], _mm256_mul_epu32(A4[i], B4[k-i]));
+        }
+        for (i = k+1; i < VWORDS_FIELD; i++) {
+            C4[k] = _mm256_add_epi64(C4[k], _mm256_mul_epu32(A4[i], B8[k+VWORDS_FIELD-i]));
+        }
+    }
+    for (i = 0; i < VWORDS_FIELD; i++) {
+        C[i] = _mm_add_epi64(_mm256_castsi256_si128(C4[i]), _mm256_extracti128_si256(C4[i], 1));
+    }
+    }
+#else
+    // 64-bit lanes: (a0*b0, a0*b1)
+    for (i = 0; i < VWORDS_FIELD; i++) {
+        A[i] = _mm_shuffle_epi32(L[i], _MM_SHUFFLE(0,0,0,0));
+        B[i] = _mm_shuffle_epi32(L[i], _MM_SHUFFLE(3,3,2,2));
+        C[i] = _mm_setzero_si128();
+    }
+    vmul1271_x2(A, B, C);
+
+    // 64-bit lanes: (a1*(4p-b1), a1*b0)
+    for (i = 0; i < VWORDS_FIELD; i++) {
+        t = _mm_sub_epi32((i == 4) ? p4_top : p4, L[i]);
+        A[i] = _mm_shuffle_epi32(L[i], _MM_SHUFFLE(1,1,1,1));
+        B[i] = _mm_shuffle_epi32(_mm_unpackhi_epi32(t, L[i]), _MM_SHUFFLE(1,1,2,2));
+    }
+    vmul1271_x2(A, B, C);
+#endif
+
+    vreduce1271_x2(C, A);
+    vstore1271_x2(A, &c[0], &c[VWORDS_FIELD]);
+}
+
+
+void v2sqr1271_a(uint32_t* a, uint32_t* c)
+{ // Squaring over GF((2^127-1)^2) using SSE2 instructions, c = a^2
+  // Computes c0 = (a0+a1)*(a0-a1) and c1 = a0*(2*a1) in parallel. c may alias a
+    __m128i L[5], A[5], B[5], C[5], x, y;
+    int i;
+
+    // L[i] = (a0[i]+a1[i], a0[i]-a1[i], a0[i], 2*a1[i])
+    x = _mm_loadu_si128((__m128i*)&a[0]);
+    y = _mm_loadu_si128((__m128i*)&a[VWORDS_FIELD]);
+    transpose_x4(_mm_add_epi32(x, y), _mm_sub_epi32(x, y), x, _mm_add_epi32(y, y), L);
+    L[4] = _mm_set_epi32((int)(a[9] << 1), (int)a[4], (int)(a[4] - a[9]), (int)(a[4] + a[9]));
+    vcarry1271_x4(L);
+
+    for (i = 0; i < VWORDS_FIELD; i++) {
+        A[i] = _mm_shuffle_epi32(L[i], _MM_SHUFFLE(2,2,0,0));
+        B[i] = _mm_shuffle_epi32(L[i], _MM_SHUFFLE(3,3,1,1));
+        C[i] = _mm_setzero_si128();
+    }
+    vmul1271_x2(A, B, C);
+
+    vreduce1271_x2(C, A);
+    vstore1271_x2(A, &c[0], &c[VWORDS_FIELD]);
+}
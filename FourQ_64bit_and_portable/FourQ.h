@@ -63,6 +63,7 @@ extern "C" {
 #define TARGET_x86          2
 #define TARGET_ARM          3
 #define TARGET_ARM64        4
+#define TARGET_RV64         5
 
 #if defined(_AMD64_)
     #define TARGET TARGET_AMD64
@@ -92,6 +93,13 @@ extern "C" {
     typedef int64_t         sdigit_t;     // Signed 64-bit digit
     #define NWORDS_FIELD    2             
     #define NWORDS_ORDER    4              
+#elif defined(_RV64_)
+    #define TARGET TARGET_RV64
+    #define RADIX           64
+    typedef uint64_t        digit_t;      // Unsigned 64-bit digit
+    typedef int64_t         sdigit_t;     // Signed 64-bit digit
+    #define NWORDS_FIELD    2             
+    #define NWORDS_ORDER    4              
 #else
     #error -- "Unsupported ARCHITECTURE"
 #endif
@@ -126,6 +134,28 @@ extern "C" {
     #define GENERIC_IMPLEMENTATION
 #endif
 
+#if defined(_COMPACT_TABLES_)               // Precomputed tables store (x+y,y-x) per point, 2dt is recomputed after each lookup
+    #define COMPACT_TABLES
+#endif
+
+#if defined(_TUNED_)                        // Window parameters and precomputed tables are taken from FourQ_tuned.h (see tune.sh)
+    #define TUNED_CONFIG
+#endif
+
+#if defined(_SCA_PROTECTION_)              // Side-channel countermeasures in the scalar multiplications that handle secret scalars
+    #define SCA_PROTECTION
+#endif
+
+#if defined(_IFMA_)                         // AVX-512 IFMA engine for the batch functions, used only if the processor supports it
+    #define IFMA_SUPPORT
+#endif
+
+// Define to maintain per-thread counters of field and point operations (see FourQ_GetOpCounts()), or use COUNT_OPS=TRUE with make
+//#define FOURQ_COUNT_OPS
+
+// Define to maintain latency histograms and call, failure and event counters of the public API (see FourQ_MetricsSnapshot()), or use METRICS=TRUE with make
+//#define FOURQ_METRICS
+
 
 // Unsupported configurations
                          
@@ -141,7 +171,11 @@ extern "C" {
     #error -- "Unsupported configuration"
 #endif
 
-#if (TARGET != TARGET_AMD64 && TARGET != TARGET_ARM64) && !defined(GENERIC_IMPLEMENTATION)
+#if (TARGET != TARGET_AMD64 && TARGET != TARGET_ARM64 && TARGET != TARGET_RV64) && !defined(GENERIC_IMPLEMENTATION)
+    #error -- "Unsupported configuration"
+#endif
+
+#if defined(IFMA_SUPPORT) && (TARGET != TARGET_AMD64 || OS_TARGET != OS_LINUX || defined(GENERIC_IMPLEMENTATION))
     #error -- "Unsupported configuration"
 #endif
 
@@ -149,7 +183,7 @@ extern "C" {
 // Definition of complementary cryptographic functions
 
 #define RandomBytesFunction     random_bytes    
-#define CryptoHashFunction      crypto_sha512        // Use SHA-512 by default
+#define CryptoHashFunction      crypto_sha512        // SHA-512, used by hashing to the curve. SchnorrQ uses the selected hash provider (SHA-512 by default)
 
 
 // Basic parameters for variable-base scalar multiplication (without using endomorphisms)
@@ -157,14 +191,20 @@ extern "C" {
 #define NBITS_ORDER_PLUS_ONE  246+1 
 
 
+#if defined(TUNED_CONFIG)
+    #include "FourQ_tuned.h"
+#else
+
 // Basic parameters for fixed-base scalar multiplication
-#define W_FIXEDBASE       5                            // Memory requirement: 7.5KB (storage for 80 points).
+#define W_FIXEDBASE       5                            // Memory requirement: 7.5KB, or 5KB with COMPACT_TABLES (storage for 80 points).
 #define V_FIXEDBASE       5                  
 
 
 // Basic parameters for double scalar multiplication
-#define WP_DOUBLEBASE     8                            // Memory requirement: 24KB (storage for 256 points).
+#define WP_DOUBLEBASE     8                            // Memory requirement: 24KB, or 16KB with COMPACT_TABLES (storage for 256 points).
 #define WQ_DOUBLEBASE     4  
+
+#endif
    
 
 // FourQ's basic element definitions and point representations
@@ -175,6 +215,79 @@ typedef felm_t f2elm_t[2];                             // Datatype for represent
 typedef struct { f2elm_t x; f2elm_t y; } point_affine; // Point representation in affine coordinates.
 typedef point_affine point_t[1]; 
 
+typedef struct { f2elm_t x; f2elm_t y; f2elm_t z; f2elm_t ta; f2elm_t tb; } point_extproj;  // Point representation in extended coordinates (X:Y:Z:Ta:Tb), where T = Ta*Tb.
+typedef point_extproj point_extproj_t[1];                                                     // Its contents are opaque to applications (see the projective point API in FourQ_api.h).
+
+
+// Opaque cache of verified SchnorrQ signatures (see SchnorrQ_CacheCreate())
+
+typedef struct SchnorrQ_cache SchnorrQ_cache_t;
+
+
+// Opaque pool of pre-generated ephemeral keypairs for key exchange (see EphemeralPoolCreate())
+
+typedef struct ephemeral_pool ephemeral_pool_t;
+
+typedef struct {
+    uint64_t pops;                                     // Calls to EphemeralPoolKeyGeneration(), including those made by EphemeralPoolKeyAgreement()
+    uint64_t exhausted;                                // Pops that found the pool empty and generated the keypair on the calling thread
+    uint64_t generated;                                // Keypairs generated and stored in the pool
+    uint64_t discarded;                                // Keypairs generated by a refill thread that no longer fitted in the pool, and were cleared
+    uint64_t refills;                                  // Pops that left the pool at or below its low-water mark and woke up the refill threads
+    uint64_t refill_failures;                          // Refills that stopped early because generating keypairs failed (e.g., the random source failed)
+    uint64_t available;                                // Keypairs currently in the pool
+    unsigned int capacity, low_water;
+} ephemeral_pool_stats_t;
+
+
+// Hash providers used by SchnorrQ (see FourQ_SetHashProvider())
+
+#define HASH_PROVIDER_SHA512    0                      // SHA-512, as specified by SchnorrQ (default). Reserved to HashProviderSHA512
+#define HASH_PROVIDER_BLAKE2B   1                      // BLAKE2b with 64-byte output. Reserved to HashProviderBLAKE2b
+
+typedef struct { uint64_t words[32]; } hash_ctx_t;     // Streaming state of a hash provider
+
+typedef struct {
+    unsigned int id;                                                                        // Provider ID, tagged into the SchnorrQ domain separation
+    const char* name;
+    int (*hash)(const unsigned char* in, unsigned long long inlen, unsigned char* out);     // One-shot hashing with 64-byte output
+    int (*init)(hash_ctx_t* ctx);                                                           // Streaming interface: init, update any number of times, final (64-byte output)
+    int (*update)(hash_ctx_t* ctx, const unsigned char* in, unsigned long long inlen);
+    int (*final)(hash_ctx_t* ctx, unsigned char* out);                                      // All functions return 0 on success
+} hash_provider_t;
+
+
+// Operation counters of the calling thread (see FourQ_GetOpCounts())
+
+typedef struct {
+    uint64_t fpmul, fpsqr, fpinv;                      // GF(p) multiplications, squarings and inversions
+    uint64_t fp2mul, fp2sqr, fp2inv;                   // GF(p^2) multiplications, squarings and inversions
+    uint64_t eccdouble, eccadd, eccmadd;               // Point doublings, additions and mixed additions (with a precomputed affine point)
+    uint64_t table_lookup_1x8, table_lookup_fixed_base; // Constant-time lookups in the variable-base and fixed-base tables
+} op_counts_t;
+
+
+// Placement of the precomputed tables of fixed-base and double-scalar multiplication (see ecc_tables_place())
+
+#define TABLES_HUGE_PAGES     1                        // Copies in explicit huge pages if enough are reserved, otherwise in transparent huge pages
+#define TABLES_NUMA_REPLICAS  2                        // One copy per NUMA node with CPUs, bound to its memory and read by the threads running on that node
+
+typedef enum {
+    TABLE_PAGES_STATIC,                                // Static tables in the read-only data of the library (default)
+    TABLE_PAGES_SMALL,                                 // Copies in base pages, e.g., if no huge page could be obtained
+    TABLE_PAGES_TRANSPARENT,                           // Copies in transparent huge pages
+    TABLE_PAGES_EXPLICIT                               // Copies in explicit (hugetlbfs) huge pages
+} table_pages_t;
+
+typedef struct {
+    unsigned int flags;                                // Flags of the current placement
+    table_pages_t pages;                               // Smallest pages backing a copy
+    unsigned int copies;                               // Number of copies, 0 for the static tables
+    unsigned int bound;                                // Number of copies bound to the memory of their NUMA node
+    size_t table_bytes;                                // Size of the tables, in bytes
+    size_t mapped_bytes;                               // Memory mapped for all copies, in bytes
+} table_placement_t;
+
 
 // Definitions of the error-handling type and error codes
 
@@ -207,6 +320,65 @@ typedef enum {
 #define ECCRYPTO_MSG_ERROR_SIGNATURE_VERIFICATION           "ECCRYPTO_ERROR_SIGNATURE_VERIFICATION" 
 
 
+// Metrics of the public API (see FourQ_MetricsSnapshot())
+
+typedef enum {
+    METRICS_SCHNORRQ_KEYGENERATION,
+    METRICS_SCHNORRQ_FULLKEYGENERATION,
+    METRICS_SCHNORRQ_SIGN,
+    METRICS_SCHNORRQ_VERIFY,
+    METRICS_SCHNORRQ_VERIFYBATCH,
+    METRICS_SCHNORRQ_VERIFYCACHED,
+    METRICS_COMPRESSEDPUBLICKEYGENERATION,
+    METRICS_COMPRESSEDKEYGENERATION,
+    METRICS_COMPRESSEDSECRETAGREEMENT,
+    METRICS_EPHEMERALKEYAGREEMENT,
+    METRICS_EPHEMERALPOOLKEYGENERATION,
+    METRICS_EPHEMERALPOOLKEYAGREEMENT,
+    METRICS_PUBLICKEYGENERATION,
+    METRICS_KEYGENERATION,
+    METRICS_SECRETAGREEMENT,
+    METRICS_HASHTOCURVE,
+    METRICS_ENCODETOCURVE,
+    METRICS_HASHTOCURVEEVALUATEBATCH,
+    METRICS_NCALLS
+} metrics_call_t;
+
+typedef enum {
+    METRICS_DECODE_FAILURE,                    // A 32-byte encoding that does not decode to a point on the curve
+    METRICS_INVALID_POINT,                     // A point input to a scalar multiplication that does not lie on the curve
+    METRICS_VERIFICATION_FAILURE,              // A SchnorrQ signature that is rejected
+    METRICS_EPHEMERAL_POOL_EXHAUSTED,          // A keypair requested from an empty pool of ephemeral keypairs, and generated on the calling thread
+    METRICS_EPHEMERAL_POOL_REFILL_FAILURE,     // A refill of a pool of ephemeral keypairs that stopped because generating keypairs failed
+    METRICS_NEVENTS
+} metrics_event_t;
+
+// Latencies are recorded in nanoseconds in log-linear buckets: values below 2^METRICS_SUB_BUCKET_BITS have their own bucket, and every
+// larger power-of-two range is split into 2^(METRICS_SUB_BUCKET_BITS-1) buckets (relative error below 6.25%). Values of 2^METRICS_MAX_EXPONENT 
+// nanoseconds (about 69 seconds) or more are recorded in the last bucket.
+#define METRICS_SUB_BUCKET_BITS   5
+#define METRICS_MAX_EXPONENT      36
+#define METRICS_BUCKETS           ((METRICS_MAX_EXPONENT-METRICS_SUB_BUCKET_BITS+2) << (METRICS_SUB_BUCKET_BITS-1))
+
+typedef struct {
+    uint64_t calls, failures;                  // Number of calls, and of calls that did not return ECCRYPTO_SUCCESS
+    uint64_t sum_ns, min_ns, max_ns;           // Total, minimum and maximum latency in nanoseconds
+    uint64_t buckets[METRICS_BUCKETS];         // Latency histogram
+} metrics_histogram_t;
+
+typedef struct {
+    metrics_histogram_t calls[METRICS_NCALLS];
+    uint64_t events[METRICS_NEVENTS];
+} metrics_snapshot_t;
+
+typedef struct {
+    void* (*begin)(metrics_call_t call, void* context);                                                         // Called on entry, returns a span handle passed to end()
+    void (*end)(void* span, metrics_call_t call, ECCRYPTO_STATUS status, uint64_t latency_ns, void* context);   // Called on return
+    void (*event)(metrics_event_t event, void* context);                                                        // Called when an event is counted
+    void* context;
+} metrics_tracer_t;
+
+
 #ifdef __cplusplus
 }
 #endif
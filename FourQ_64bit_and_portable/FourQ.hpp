@@ -0,0 +1,262 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: header-only C++17 interface to SchnorrQ and key exchange
+*
+* A thin layer over the C functions of FourQ_api.h. Keys, signatures and shared secrets
+* have distinct move-only types that hold their bytes in a std::array and zeroize them on
+* destruction and when moved from. Messages are passed as spans. Nothing is allocated, no
+* exceptions are thrown, and errors are returned as a Status. Each function is one call to
+* the corresponding C function, plus a check that the message length fits in 32 bits.
+************************************************************************************/
+
+#ifndef __FOURQ_HPP__
+#define __FOURQ_HPP__
+
+#include "FourQ_api.h"
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#if __cplusplus >= 202002L && defined(__has_include)
+    #if __has_include(<span>)
+        #include <span>
+    #endif
+#endif
+
+
+namespace fourq {
+
+using byte = unsigned char;
+
+
+#if defined(__cpp_lib_span)
+
+template <class T> using span = std::span<T>;
+
+#else
+
+// Replacement of std::span for C++17: a pointer and a length, built implicitly from arrays and contiguous containers
+template <class T>
+class span {
+public:
+    constexpr span() noexcept : ptr(nullptr), count(0) {}
+    constexpr span(T* data, std::size_t size) noexcept : ptr(data), count(size) {}
+    template <std::size_t N>
+    constexpr span(T (&array)[N]) noexcept : ptr(array), count(N) {}
+    template <class Container, class = std::enable_if_t<std::is_convertible_v<decltype(std::declval<Container&>().data()), T*>>>
+    constexpr span(Container& container) noexcept : ptr(container.data()), count(container.size()) {}
+
+    constexpr T* data() const noexcept { return ptr; }
+    constexpr std::size_t size() const noexcept { return count; }
+    constexpr bool empty() const noexcept { return count == 0; }
+    constexpr T* begin() const noexcept { return ptr; }
+    constexpr T* end() const noexcept { return ptr + count; }
+    constexpr T& operator[](std::size_t i) const noexcept { return ptr[i]; }
+
+private:
+    T* ptr;
+    std::size_t count;
+};
+
+#endif
+
+
+// Result of an operation. True if and only if the C function returned ECCRYPTO_SUCCESS
+class [[nodiscard]] Status {
+public:
+    constexpr Status(ECCRYPTO_STATUS code) noexcept : status(code) {}
+    constexpr explicit operator bool() const noexcept { return status == ECCRYPTO_SUCCESS; }
+    constexpr ECCRYPTO_STATUS code() const noexcept { return status; }
+    const char* message() const noexcept { return FourQ_get_error_message(status); }
+
+private:
+    ECCRYPTO_STATUS status;
+};
+
+
+namespace detail {
+
+inline void zeroize(void* p, std::size_t n) noexcept
+{ // Volatile stores, which the compiler cannot remove as dead
+    volatile byte* v = static_cast<volatile byte*>(p);
+
+    while (n--) *v++ = 0;
+}
+
+// N bytes of one kind, distinguished by Tag. Move-only and zeroized on destruction and when moved from;
+// clone() makes an explicit copy, and == compares in constant time
+template <class Tag, std::size_t N>
+class Bytes {
+public:
+    static constexpr std::size_t length = N;
+
+    Bytes() noexcept : value{} {}
+    explicit Bytes(const std::array<byte, N>& bytes) noexcept : value(bytes) {}
+    Bytes(const Bytes&) = delete;
+    Bytes& operator=(const Bytes&) = delete;
+    Bytes(Bytes&& other) noexcept : value(other.value) { other.clear(); }
+    Bytes& operator=(Bytes&& other) noexcept
+    {
+        if (this != &other) {
+            value = other.value;
+            other.clear();
+        }
+        return *this;
+    }
+    ~Bytes() { clear(); }
+
+    // Copies input, which must be N bytes long. Returns false otherwise
+    bool assign(span<const byte> input) noexcept
+    {
+        if (input.size() != N) return false;
+        for (std::size_t i = 0; i < N; i++) value[i] = input[i];
+        return true;
+    }
+
+    Bytes clone() const noexcept { return Bytes(value); }
+    void clear() noexcept { zeroize(value.data(), N); }
+
+    const std::array<byte, N>& bytes() const noexcept { return value; }
+    byte* data() noexcept { return value.data(); }
+    const byte* data() const noexcept { return value.data(); }
+    static constexpr std::size_t size() noexcept { return N; }
+
+    friend bool operator==(const Bytes& a, const Bytes& b) noexcept
+    {
+        byte diff = 0;
+        for (std::size_t i = 0; i < N; i++) diff |= a.value[i] ^ b.value[i];
+        return diff == 0;
+    }
+    friend bool operator!=(const Bytes& a, const Bytes& b) noexcept { return !(a == b); }
+
+private:
+    std::array<byte, N> value;
+};
+
+inline bool fits_32_bits(std::size_t size) noexcept { return size <= UINT_MAX; }
+
+}
+
+
+// SchnorrQ signatures
+
+namespace schnorrq {
+
+struct SecretKeyTag;
+struct PublicKeyTag;
+struct SignatureTag;
+
+using SecretKey = detail::Bytes<SecretKeyTag, 32>;
+using PublicKey = detail::Bytes<PublicKeyTag, 32>;
+using Signature = detail::Bytes<SignatureTag, 64>;
+
+// Number of signatures per call to SchnorrQ_VerifyBatch() in verify_batch(), whose pointer arrays live on the stack
+constexpr unsigned int verify_batch_chunk = 64;
+
+// Public key of secret_key
+inline Status public_key(const SecretKey& secret_key, PublicKey& public_key) noexcept
+{
+    return SchnorrQ_KeyGeneration(secret_key.data(), public_key.data());
+}
+
+// Random key pair
+inline Status generate(SecretKey& secret_key, PublicKey& public_key) noexcept
+{
+    return SchnorrQ_FullKeyGeneration(secret_key.data(), public_key.data());
+}
+
+inline Status sign(const SecretKey& secret_key, const PublicKey& public_key, span<const byte> message, Signature& signature) noexcept
+{
+    if (!detail::fits_32_bits(message.size())) return ECCRYPTO_ERROR_INVALID_PARAMETER;
+    return SchnorrQ_Sign(secret_key.data(), public_key.data(), message.data(), static_cast<unsigned int>(message.size()), signature.data());
+}
+
+// ECCRYPTO_SUCCESS if signature is valid, ECCRYPTO_ERROR_SIGNATURE_VERIFICATION if it is not
+inline Status verify(const PublicKey& public_key, span<const byte> message, const Signature& signature) noexcept
+{
+    unsigned int valid = false;
+    ECCRYPTO_STATUS status;
+
+    if (!detail::fits_32_bits(message.size())) return ECCRYPTO_ERROR_INVALID_PARAMETER;
+    status = SchnorrQ_Verify(public_key.data(), message.data(), static_cast<unsigned int>(message.size()), signature.data(), &valid);
+    if (status != ECCRYPTO_SUCCESS) return status;
+    return valid ? ECCRYPTO_SUCCESS : ECCRYPTO_ERROR_SIGNATURE_VERIFICATION;
+}
+
+// Batched verification of signatures[i] of messages[i] under public_keys[i]: valid[i] = true if the signature is valid.
+// All spans must have the same length. The batch is verified in chunks of verify_batch_chunk signatures
+inline Status verify_batch(span<const PublicKey> public_keys, span<const span<const byte>> messages, span<const Signature> signatures, span<bool> valid) noexcept
+{
+    const byte* keys[verify_batch_chunk];
+    const byte* msgs[verify_batch_chunk];
+    const byte* sigs[verify_batch_chunk];
+    unsigned int sizes[verify_batch_chunk], results[verify_batch_chunk];
+    std::size_t n = public_keys.size(), i, j, count;
+    ECCRYPTO_STATUS status;
+
+    if (messages.size() != n || signatures.size() != n || valid.size() != n) return ECCRYPTO_ERROR_INVALID_PARAMETER;
+    for (i = 0; i < n; i += count) {
+        count = (n - i < verify_batch_chunk) ? n - i : verify_batch_chunk;
+        for (j = 0; j < count; j++) {
+            if (!detail::fits_32_bits(messages[i + j].size())) return ECCRYPTO_ERROR_INVALID_PARAMETER;
+            keys[j] = public_keys[i + j].data();
+            msgs[j] = messages[i + j].data();
+            sigs[j] = signatures[i + j].data();
+            sizes[j] = static_cast<unsigned int>(messages[i + j].size());
+        }
+        status = SchnorrQ_VerifyBatch(keys, msgs, sizes, sigs, static_cast<unsigned int>(count), results);
+        if (status != ECCRYPTO_SUCCESS) return status;
+        for (j = 0; j < count; j++) valid[i + j] = (results[j] != 0);
+    }
+    return ECCRYPTO_SUCCESS;
+}
+
+}
+
+
+// Key exchange with compressed 32-byte public keys
+
+namespace dh {
+
+struct SecretKeyTag;
+struct PublicKeyTag;
+struct SharedSecretTag;
+
+using SecretKey = detail::Bytes<SecretKeyTag, 32>;
+using PublicKey = detail::Bytes<PublicKeyTag, 32>;
+using SharedSecret = detail::Bytes<SharedSecretTag, 32>;
+
+// Public key of secret_key
+inline Status public_key(const SecretKey& secret_key, PublicKey& public_key) noexcept
+{
+    return CompressedPublicKeyGeneration(secret_key.data(), public_key.data());
+}
+
+// Random key pair
+inline Status generate(SecretKey& secret_key, PublicKey& public_key) noexcept
+{
+    return CompressedKeyGeneration(secret_key.data(), public_key.data());
+}
+
+// Shared secret of secret_key and the peer's public key
+inline Status agree(const SecretKey& secret_key, const PublicKey& peer, SharedSecret& shared) noexcept
+{
+    return CompressedSecretAgreement(secret_key.data(), peer.data(), shared.data());
+}
+
+// Fresh ephemeral key pair and its shared secret with the peer's static public key
+inline Status ephemeral_agree(const PublicKey& peer, SecretKey& secret_key, PublicKey& public_key, SharedSecret& shared) noexcept
+{
+    return EphemeralKeyAgreement(peer.data(), secret_key.data(), public_key.data(), shared.data());
+}
+
+}
+
+}
+
+
+#endif
@@ -26,6 +26,9 @@ extern "C" {
 
 /**************** Public ECC API ****************/
 
+// Output error/success message for a given ECCRYPTO_STATUS
+const char* FourQ_get_error_message(ECCRYPTO_STATUS Status);
+
 // Set generator G = (x,y)
 void eccset(point_t G);
 
@@ -38,6 +41,76 @@ bool ecc_mul_fixed(digit_t* k, point_t Q);
 // Double scalar multiplication R = k*G + l*Q, where G is the generator
 bool ecc_mul_double(digit_t* k, point_t Q, digit_t* l, point_t R);
 
+// Batched fixed-base scalar multiplications Q[i] = k_i*G, i = 0,...,npoints-1. The scalars are stored consecutively in k, NWORDS_ORDER digits each
+bool ecc_mul_fixed_batch(digit_t* k, point_affine* Q, unsigned int npoints);
+
+// Batched variable-base scalar multiplications Q[i] = k_i*P[i], i = 0,...,npoints-1. Returns false if a point P[i] is not on the curve
+bool ecc_mul_batch(point_affine* P, digit_t* k, point_affine* Q, unsigned int npoints, bool clear_cofactor);
+
+// Batched double scalar multiplications R[i] = k_i*G + l_i*Q[i], i = 0,...,npoints-1. Returns false if a point Q[i] is not on the curve
+bool ecc_mul_double_batch(digit_t* k, point_affine* Q, digit_t* l, point_affine* R, unsigned int npoints);
+
+
+/**************** Public API for projective point arithmetic ****************/
+// Points of type point_extproj_t are kept in extended twisted Edwards coordinates and are only normalized by 
+// ecc_point_to_affine() and ecc_point_encode(). Output points may alias input points.
+// ecc_point_from_affine() and ecc_point_decode() accept any point on the curve, including the points outside the prime-order subgroup.
+// Before passing such a point to ecc_point_mul(), either reject it with ecc_point_in_subgroup() or map it to the subgroup with ecc_point_clear_cofactor().
+
+// Set P to the neutral point
+void ecc_point_neutral(point_extproj_t P);
+
+// Set P to the generator G
+void ecc_point_generator(point_extproj_t P);
+
+// Conversion from affine coordinates, Q = P. Returns false if P is not on the curve. P may lie outside the prime-order subgroup
+bool ecc_point_from_affine(point_t P, point_extproj_t Q);
+
+// Decoding of a 32-byte encoded point. The decoded point may lie outside the prime-order subgroup
+ECCRYPTO_STATUS ecc_point_decode(const unsigned char* Pencoded, point_extproj_t P);
+
+// Normalization to affine coordinates, Q = P
+void ecc_point_to_affine(point_extproj_t P, point_t Q);
+
+// Normalization and 32-byte encoding of P
+void ecc_point_encode(point_extproj_t P, unsigned char* Pencoded);
+
+// Complete point addition R = P+Q
+void ecc_point_add(point_extproj_t P, point_extproj_t Q, point_extproj_t R);
+
+// Point doubling R = 2*P
+void ecc_point_double(point_extproj_t P, point_extproj_t R);
+
+// Point negation R = -P
+void ecc_point_neg(point_extproj_t P, point_extproj_t R);
+
+// Constant-time comparison, returns true if P = Q
+bool ecc_point_equals(point_extproj_t P, point_extproj_t Q);
+
+// Co-factor clearing Q = 392*P, which lies in the prime-order subgroup for any P on the curve
+void ecc_point_clear_cofactor(point_extproj_t P, point_extproj_t Q);
+
+// Subgroup check, returns true if P (a point on the curve) lies in the prime-order subgroup. Not constant time: meant for public points
+bool ecc_point_in_subgroup(point_extproj_t P);
+
+// Variable-base scalar multiplication Q = k*P, for P in the prime-order subgroup, without normalization
+// The result is undefined for other points: use ecc_point_in_subgroup() or ecc_point_clear_cofactor() on points from ecc_point_from_affine() or ecc_point_decode()
+bool ecc_point_mul(point_extproj_t P, digit_t* k, point_extproj_t Q);
+
+
+/************* Public API for the placement of the precomputed tables **************/
+
+// Placement of the tables of fixed-base and double-scalar multiplication, which are read by ecc_mul_fixed(), ecc_mul_double() and the functions that call them
+// By default the static tables are used. With TABLES_HUGE_PAGES, the tables are copied to explicit huge pages if enough are reserved (vm.nr_hugepages),
+// or else to memory advised for transparent huge pages. With TABLES_NUMA_REPLICAS, one copy is bound to each NUMA node that has CPUs, and every call
+// reads the copy of the node it runs on. Flags = 0 restores the static tables. The copies are read-only once filled.
+// The placement is global to the process and must not change while other threads use the library. 
+// Returns ECCRYPTO_ERROR_NOT_IMPLEMENTED on platforms other than Linux.
+ECCRYPTO_STATUS ecc_tables_place(unsigned int Flags);
+
+// Current placement of the precomputed tables, including the pages that were actually obtained
+void ecc_tables_placement(table_placement_t* Placement);
+
 
 /************* Public API for arithmetic functions modulo the curve order **************/
 
@@ -90,6 +163,101 @@ ECCRYPTO_STATUS SchnorrQ_Sign(const unsigned char* SecretKey, const unsigned cha
 // Output: true (valid signature) or false (invalid signature)
 ECCRYPTO_STATUS SchnorrQ_Verify(const unsigned char* PublicKey, const unsigned char* Message, const unsigned int SizeMessage, const unsigned char* Signature, unsigned int* valid);
 
+// Batched SchnorrQ signature verification
+// It verifies the signatures Signatures[i] of the messages Messages[i] of size SizeMessages[i] in bytes, for i = 0,...,NumSignatures-1.
+// Malformed public keys or signatures are reported as invalid signatures. The double scalar multiplications use ecc_mul_double_batch().
+// Inputs: 32-byte PublicKeys[i], 64-byte Signatures[i], and Messages[i] of size SizeMessages[i] in bytes
+// Output: valid[i] = true (valid signature) or false (invalid signature)
+ECCRYPTO_STATUS SchnorrQ_VerifyBatch(const unsigned char** PublicKeys, const unsigned char** Messages, const unsigned int* SizeMessages, const unsigned char** Signatures, const unsigned int NumSignatures, unsigned int* valid);
+
+
+/**************** Public API for hash providers ****************/
+
+// Built-in hash providers: SHA-512 (using an AVX2 message schedule when _AVX2_ is defined) and BLAKE2b
+extern const hash_provider_t HashProviderSHA512;
+extern const hash_provider_t HashProviderBLAKE2b;
+
+// Selection of the hash provider used by SchnorrQ key generation, signing, verification and the cache of verified signatures
+// With SHA-512 (the default), SchnorrQ is computed as specified. With any other provider, the challenge hash is prefixed with a domain separator
+// that includes the provider ID, so signatures computed with different providers are never accepted for one another.
+// The IDs HASH_PROVIDER_SHA512 and HASH_PROVIDER_BLAKE2B are reserved to HashProviderSHA512 and HashProviderBLAKE2b: other providers that use
+// them, including zero-initialized ones, are rejected with ECCRYPTO_ERROR_INVALID_PARAMETER.
+// The provider is global to the process and should be selected before other threads use the library.
+// Input:  Provider, or NULL to restore the default
+ECCRYPTO_STATUS FourQ_SetHashProvider(const hash_provider_t* Provider);
+
+// Hash provider currently used by SchnorrQ
+const hash_provider_t* FourQ_GetHashProvider(void);
+
+
+/**************** Public API for operation counters ****************/
+
+// Snapshot of the operation counters of the calling thread
+// When the library is built with FOURQ_COUNT_OPS, every call to a counted field or point primitive increments its counter, including the calls 
+// made by other primitives (e.g., fpinv1271() counts its squarings and multiplications, and without assembly fp2mul1271() counts its three 
+// GF(p) multiplications). The lanes of the AVX-512 IFMA batch engine are not counted. Without FOURQ_COUNT_OPS all counters read zero.
+// Output: Counts
+void FourQ_GetOpCounts(op_counts_t* Counts);
+
+// Reset the operation counters of the calling thread
+void FourQ_ResetOpCounts(void);
+
+
+/**************** Public API for metrics ****************/
+
+// When the library is built with FOURQ_METRICS, every call to the functions listed in metrics_call_t records its latency and whether it
+// failed in a shard of the calling thread, and the events listed in metrics_event_t are counted. Calls made internally by other API functions 
+// are also recorded (e.g., SchnorrQ_FullKeyGeneration() records a call to SchnorrQ_KeyGeneration()). Without FOURQ_METRICS nothing is recorded,
+// FourQ_MetricsSnapshot() and FourQ_SetTracer() return ECCRYPTO_ERROR_NOT_IMPLEMENTED and FourQ_MetricsExport() produces an empty string.
+
+// Snapshot of the metrics aggregated over the shards of all threads, including threads that have exited
+// Output: Snapshot
+ECCRYPTO_STATUS FourQ_MetricsSnapshot(metrics_snapshot_t* Snapshot);
+
+// Reset the metrics of all threads
+void FourQ_MetricsReset(void);
+
+// Latency in nanoseconds below which a fraction Quantile (0 <= Quantile <= 1) of the calls recorded in Histogram completed 
+// The result is the upper bound of the histogram bucket holding the quantile, capped at the maximum latency. Returns 0 for an empty histogram.
+uint64_t FourQ_MetricsPercentile(const metrics_histogram_t* Histogram, double Quantile);
+
+// Names of an API call ("SchnorrQ_Sign", ...) and of an event ("decode_failure", ...), or NULL if out of range
+const char* FourQ_MetricsCallName(metrics_call_t Call);
+const char* FourQ_MetricsEventName(metrics_event_t Event);
+
+// Export of a snapshot of the metrics in the Prometheus text format: counters fourq_calls_total, fourq_failures_total and fourq_events_total,
+// and a summary fourq_latency_seconds with the 0.5, 0.9, 0.99 and 0.999 quantiles of every call that was recorded.
+// As snprintf(), at most Size bytes including the terminating null are written to Buffer, and the length of the full output is returned.
+size_t FourQ_MetricsExport(char* Buffer, size_t Size);
+
+// Registration of a tracer, notified on entry to and return from every recorded call, and of every event
+// Callbacks may be NULL. The tracer is global to the process, must remain valid while it is registered, and should be registered before other
+// threads use the library. Callbacks run on the calling thread and must not call the library.
+// Input: Tracer, or NULL to remove the current tracer
+ECCRYPTO_STATUS FourQ_SetTracer(const metrics_tracer_t* Tracer);
+
+
+/**************** Public API for the cache of verified SchnorrQ signatures ****************/
+
+// Creation of a cache of verified SchnorrQ signatures
+// The cache is sharded and lock-striped, so it can be shared by multiple threads. Its total size, including all internal storage, is bounded by MaxMemory bytes.
+// Input:  memory budget MaxMemory in bytes
+// Output: Cache, which must be released with SchnorrQ_CacheDestroy()
+ECCRYPTO_STATUS SchnorrQ_CacheCreate(const size_t MaxMemory, SchnorrQ_cache_t** Cache);
+
+// Release a cache of verified SchnorrQ signatures
+void SchnorrQ_CacheDestroy(SchnorrQ_cache_t* Cache);
+
+// SchnorrQ signature verification using a cache of verified signatures
+// A tuple (PublicKey, Message, Signature) that was previously verified is accepted at the cost of one hash computation and a table lookup. 
+// Only valid signatures are inserted in the cache, evicting the least recently used tuple when full. If Cache = NULL, SchnorrQ_Verify() is called.
+// Inputs: Cache, 32-byte PublicKey, 64-byte Signature, and Message of size SizeMessage in bytes
+// Output: true (valid signature) or false (invalid signature)
+ECCRYPTO_STATUS SchnorrQ_VerifyCached(SchnorrQ_cache_t* Cache, const unsigned char* PublicKey, const unsigned char* Message, const unsigned int SizeMessage, const unsigned char* Signature, unsigned int* valid);
+
+// Cache statistics: number of hits, misses and currently cached tuples
+void SchnorrQ_CacheStatistics(SchnorrQ_cache_t* Cache, uint64_t* Hits, uint64_t* Misses, uint64_t* Entries);
+
 
 /**************** Public API for co-factor ECDH key exchange with compressed, 32-byte public keys ****************/
 
@@ -110,6 +278,42 @@ ECCRYPTO_STATUS CompressedKeyGeneration(unsigned char* SecretKey, unsigned char*
 // Output: 32-byte SharedSecret
 ECCRYPTO_STATUS CompressedSecretAgreement(const unsigned char* SecretKey, const unsigned char* PublicKey, unsigned char* SharedSecret);
 
+// Ephemeral keypair generation fused with secret agreement against a static, compressed 32-byte public key
+// It produces a fresh SecretKey e, the ephemeral public key EphemeralPublicKey, which is the encoding of e*G, and SharedSecret, which is the 
+// y-coordinate of e*A, where A is the decoding of PublicKey. Equivalent to CompressedKeyGeneration() followed by CompressedSecretAgreement().
+// Input:   32-byte PublicKey
+// Outputs: 32-byte SecretKey, 32-byte EphemeralPublicKey and 32-byte SharedSecret
+ECCRYPTO_STATUS EphemeralKeyAgreement(const unsigned char* PublicKey, unsigned char* SecretKey, unsigned char* EphemeralPublicKey, unsigned char* SharedSecret);
+
+
+/**************** Public API for the pool of pre-generated ephemeral keypairs ****************/
+
+// Creation of a pool of pre-generated ephemeral keypairs for key exchange
+// The pool is filled before this function returns. Whenever a pop leaves LowWater keypairs or fewer, Threads background threads refill it,
+// generating the keypairs in batches whose public keys are normalized with a single inversion. The pool can be shared by multiple threads.
+// Inputs: Capacity in keypairs (1 to 2^24), LowWater < Capacity, and number of refill Threads (1 to 64)
+// Output: Pool, which must be released with EphemeralPoolDestroy()
+ECCRYPTO_STATUS EphemeralPoolCreate(const unsigned int Capacity, const unsigned int LowWater, const unsigned int Threads, ephemeral_pool_t** Pool);
+
+// Release a pool of pre-generated ephemeral keypairs. The refill threads are stopped and the remaining keypairs are cleared
+void EphemeralPoolDestroy(ephemeral_pool_t* Pool);
+
+// Keypair generation for key exchange from a pool of pre-generated ephemeral keypairs. The output is the same as that of CompressedKeyGeneration()
+// The keypair is taken with a lock-free pop and cleared from the pool, so it is handed out only once. If the pool is empty, the keypair is
+// generated on the calling thread and the exhaustion is counted. This is also the case if Pool = NULL or if the pool was created before fork().
+// Input:   Pool
+// Outputs: 32-byte SecretKey and 32-byte PublicKey
+ECCRYPTO_STATUS EphemeralPoolKeyGeneration(ephemeral_pool_t* Pool, unsigned char* SecretKey, unsigned char* PublicKey);
+
+// Secret agreement against a static, compressed 32-byte public key using an ephemeral keypair taken from a pool
+// Equivalent to EphemeralPoolKeyGeneration() followed by CompressedSecretAgreement(). The ephemeral secret key is cleared before returning.
+// Inputs:  Pool and 32-byte PublicKey
+// Outputs: 32-byte EphemeralPublicKey and 32-byte SharedSecret
+ECCRYPTO_STATUS EphemeralPoolKeyAgreement(ephemeral_pool_t* Pool, const unsigned char* PublicKey, unsigned char* EphemeralPublicKey, unsigned char* SharedSecret);
+
+// Pool statistics: pops, exhaustions, keypairs generated and discarded, refills, and keypairs currently available
+void EphemeralPoolStatistics(ephemeral_pool_t* Pool, ephemeral_pool_stats_t* Stats);
+
 
 /**************** Public API for co-factor ECDH key exchange with uncompressed, 64-byte public keys ****************/
 
@@ -131,6 +335,28 @@ ECCRYPTO_STATUS KeyGeneration(unsigned char* SecretKey, unsigned char* PublicKey
 ECCRYPTO_STATUS SecretAgreement(const unsigned char* SecretKey, const unsigned char* PublicKey, unsigned char* SharedSecret);
 
 
+/**************** Public API for hashing to FourQ ****************/
+
+// Hashing to the curve
+// It produces P = H(Message), a point in FourQ's prime-order subgroup, using expand_message_xmd with SHA-512 and two evaluations of a constant-time
+// Elligator 2 map followed by cofactor clearing (hash_to_curve from RFC 9380).
+// Inputs: Message of size SizeMessage in bytes and domain separation tag DST of size SizeDST in bytes (1 <= SizeDST <= 255)
+// Output: point P = (x,y) in affine coordinates
+ECCRYPTO_STATUS HashToCurve(const unsigned char* Message, const unsigned int SizeMessage, const unsigned char* DST, const unsigned int SizeDST, point_t P);
+
+// Encoding to the curve
+// Same as HashToCurve() but using a single evaluation of the map (encode_to_curve from RFC 9380). The output distribution is not uniform.
+// Inputs: Message of size SizeMessage in bytes and domain separation tag DST of size SizeDST in bytes (1 <= SizeDST <= 255)
+// Output: point P = (x,y) in affine coordinates
+ECCRYPTO_STATUS EncodeToCurve(const unsigned char* Message, const unsigned int SizeMessage, const unsigned char* DST, const unsigned int SizeDST, point_t P);
+
+// Batched evaluation of SecretKey*H(Messages[i]), for i = 0,...,NumMessages-1, where H is HashToCurve()
+// The scalar SecretKey is decomposed and recoded once for the whole batch, and outputs are normalized with a shared inversion. 
+// Inputs: 32-byte SecretKey, NumMessages messages Messages[i] of size SizeMessages[i] in bytes, and domain separation tag DST of size SizeDST in bytes
+// Output: NumMessages 32-byte encodings of SecretKey*H(Messages[i]), stored consecutively in Outputs
+ECCRYPTO_STATUS HashToCurveEvaluateBatch(const unsigned char* SecretKey, const unsigned char** Messages, const unsigned int* SizeMessages, const unsigned int NumMessages, const unsigned char* DST, const unsigned int SizeDST, unsigned char* Outputs);
+
+
 #ifdef __cplusplus
 }
 #endif
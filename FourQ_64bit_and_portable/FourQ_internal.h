@@ -34,6 +34,9 @@ extern "C" {
 #elif (TARGET == TARGET_ARM64 && OS_TARGET == OS_LINUX) && (COMPILER == COMPILER_GCC || COMPILER == COMPILER_CLANG)
     #define UINT128_SUPPORT
     typedef unsigned uint128_t __attribute__((mode(TI))); 
+#elif (TARGET == TARGET_RV64 && OS_TARGET == OS_LINUX) && (COMPILER == COMPILER_GCC || COMPILER == COMPILER_CLANG)
+    #define UINT128_SUPPORT
+    typedef unsigned uint128_t __attribute__((mode(TI))); 
 #elif (TARGET == TARGET_AMD64) && (OS_TARGET == OS_WIN && COMPILER == COMPILER_VC)
     #define SCALAR_INTRIN_SUPPORT   
     typedef uint64_t uint128_t[2];
@@ -50,6 +53,79 @@ extern "C" {
 #define NPOINTS_VARBASE       (1 << (W_VARBASE-2)) 
 #define t_VARBASE             ((NBITS_ORDER_PLUS_ONE+W_VARBASE-2)/(W_VARBASE-1))
 
+// Number of digits of a scalar recoded for variable-base scalar multiplication
+#if (USE_ENDO == true) && defined(SCA_PROTECTION)
+    #define NDIGITS_VARBASE   73    // Sub-scalars randomized with the lattice vectors have up to 72 bits
+#elif (USE_ENDO == true)
+    #define NDIGITS_VARBASE   65
+#else
+    #define NDIGITS_VARBASE   (t_VARBASE+1)
+#endif
+
+#if defined(SCA_PROTECTION) && (USE_ENDO != true)
+    #error -- "Unsupported configuration"
+#endif
+
+// Number of uses of the side-channel countermeasure state after which its blinding points are redrawn
+#define SCA_REFRESH_INTERVAL  1024
+
+// Number of fresh GF(p) masks drawn per call by ecc_mul_prepared() (one for the table and one at every other doubling) and by ecc_mul_fixed_ext()
+#define SCA_MASKS_VARBASE     (NDIGITS_VARBASE/2+1)
+#define SCA_MASKS_FIXEDBASE   E_FIXEDBASE
+
+
+// Number of independent GF(p) exponentiations interleaved by fpexp1251_x() and decode_batch()
+#define FP_LANES              4
+
+
+// Thread-local storage
+#if (COMPILER == COMPILER_VC)
+    #define THREAD_LOCAL __declspec(thread)
+#else
+    #define THREAD_LOCAL __thread
+#endif
+
+// Operation counters, compiled out unless FOURQ_COUNT_OPS is defined
+#if defined(FOURQ_COUNT_OPS)
+    extern THREAD_LOCAL op_counts_t op_counts;
+    #define COUNT_OP(op)      (op_counts.op++)
+#else
+    #define COUNT_OP(op)
+#endif
+
+// Metrics of the public API, compiled out unless FOURQ_METRICS is defined
+// METRICS_BEGIN() goes after the declarations of an API function, which then returns through METRICS_RETURN()
+#if defined(FOURQ_METRICS)
+    typedef struct {
+        metrics_call_t call;
+        uint64_t start;
+        const metrics_tracer_t* tracer;
+        void* trace;
+    } metrics_span_t;
+    void metrics_begin(metrics_span_t* span, metrics_call_t call);
+    void metrics_end(metrics_span_t* span, ECCRYPTO_STATUS status);
+    void metrics_event(metrics_event_t event);
+    #define METRICS_BEGIN(call)       metrics_span_t metrics_span_; metrics_begin(&metrics_span_, call)
+    #define METRICS_RETURN(status)    do { ECCRYPTO_STATUS metrics_status_ = (status); metrics_end(&metrics_span_, metrics_status_); return metrics_status_; } while (0)
+    #define METRICS_EVENT(event)      metrics_event(event)
+#else
+    #define METRICS_BEGIN(call)
+    #define METRICS_RETURN(status)    return (status)
+    #define METRICS_EVENT(event)
+#endif
+
+// Loads (acquire) and stores (release) of a pointer that other threads may read concurrently. On Windows, the caller includes <windows.h>
+#if (OS_TARGET == OS_WIN)
+    #define ATOMIC_LOAD_PTR(p)        InterlockedCompareExchangePointer((PVOID volatile*)&(p), NULL, NULL)
+    #define ATOMIC_STORE_PTR(p, v)    InterlockedExchangePointer((PVOID volatile*)&(p), (PVOID)(v))
+#else
+    #define ATOMIC_LOAD_PTR(p)        __atomic_load_n(&(p), __ATOMIC_ACQUIRE)
+    #define ATOMIC_STORE_PTR(p, v)    __atomic_store_n(&(p), (v), __ATOMIC_RELEASE)
+#endif
+
+// Number of scalar multiplications computed together by the batch engine of eccp2_x8.c
+#define X8_LANES              8
+
 
 // Basic parameters for fixed-base scalar multiplication
 #define E_FIXEDBASE       (NBITS_ORDER_PLUS_ONE + W_FIXEDBASE*V_FIXEDBASE - 1)/(W_FIXEDBASE*V_FIXEDBASE)
@@ -57,6 +133,7 @@ extern "C" {
 #define L_FIXEDBASE       D_FIXEDBASE*W_FIXEDBASE  
 #define NPOINTS_FIXEDBASE V_FIXEDBASE*(1 << (W_FIXEDBASE-1))  
 #define VPOINTS_FIXEDBASE (1 << (W_FIXEDBASE-1)) 
+#define NDIGITS_FIXEDBASE (NBITS_ORDER_PLUS_ONE+(W_FIXEDBASE*V_FIXEDBASE)-1)    // Number of digits of the mLSB-set recoding
 #if (NBITS_ORDER_PLUS_ONE-L_FIXEDBASE == 0)  // This parameter selection is not supported  
     #error -- "Unsupported parameter selection for fixed-base scalar multiplication"
 #endif 
@@ -69,12 +146,28 @@ extern "C" {
 
 // FourQ's point representations        
 
-typedef struct { f2elm_t x; f2elm_t y; f2elm_t z; f2elm_t ta; f2elm_t tb; } point_extproj;  // Point representation in extended coordinates.
-typedef point_extproj point_extproj_t[1];                                                              
 typedef struct { f2elm_t xy; f2elm_t yx; f2elm_t z2; f2elm_t t2; } point_extproj_precomp;   // Point representation in extended coordinates (for precomputed points).
 typedef point_extproj_precomp point_extproj_precomp_t[1];  
 typedef struct { f2elm_t xy; f2elm_t yx; f2elm_t t2; } point_precomp;                       // Point representation in extended affine coordinates (for precomputed points).
 typedef point_precomp point_precomp_t[1];
+typedef struct { f2elm_t xy; f2elm_t yx; } point_precomp_compact;                          // Compact representation (x+y,y-x) of precomputed points.
+typedef point_precomp_compact point_precomp_compact_t[1];
+
+#if defined(COMPACT_TABLES)
+    typedef point_precomp_compact_t point_table_t;                                          // Entries of FIXED_BASE_TABLE and DOUBLE_SCALAR_TABLE.
+#else
+    typedef point_precomp_t point_table_t;
+#endif
+
+#if defined(SCA_PROTECTION)
+typedef struct {                                  // Per-thread blinding points of the side-channel countermeasures. Masks are drawn per call.
+    unsigned int uses;                            // Number of uses since the last refresh.
+    point_extproj_t blind_var;                    // Blinding point R for ecc_mul_prepared().
+    point_extproj_t unblind_var;                  // -2^(NDIGITS_VARBASE-1)*R.
+    point_extproj_t blind_fixed;                  // Blinding point R' for ecc_mul_fixed_ext().
+    point_extproj_t unblind_fixed;                // -2^(E_FIXEDBASE-1)*R'.
+} sca_state;
+#endif
 
 
 /********************** Constant-time unsigned comparisons ***********************/
@@ -189,7 +282,7 @@ static __inline unsigned int is_digit_lessthan_ct(digit_t x, digit_t y)
     (shiftOut)[1]  = __shiftleft128((Input)[0], (Input)[1], (shift));                             \
     (shiftOut)[0] = (Input)[0] << (shift);  
 
-#elif ((TARGET == TARGET_AMD64 || TARGET == TARGET_ARM64) && OS_TARGET == OS_LINUX)
+#elif ((TARGET == TARGET_AMD64 || TARGET == TARGET_ARM64 || TARGET == TARGET_RV64) && OS_TARGET == OS_LINUX)
 
 // Digit multiplication
 #define MUL(multiplier, multiplicand, hi, lo)                                                     \
@@ -265,9 +358,11 @@ void fpdiv1271(felm_t a);
 
 // Field multiplication, c = a*b mod p
 void fpmul1271(felm_t a, felm_t b, felm_t c);
+void fpmul1271_a(felm_t a, felm_t b, felm_t c);
 
 // Field squaring, c = a^2 mod p
 void fpsqr1271(felm_t a, felm_t c);
+void fpsqr1271_a(felm_t a, felm_t c);
 
 // Field inversion, af = a^-1 = a^(p-2) mod p
 void fpinv1271(felm_t a);
@@ -275,6 +370,12 @@ void fpinv1271(felm_t a);
 // Exponentiation over GF(p), af = a^(125-1)
 void fpexp1251(felm_t a, felm_t af);
 
+// Interleaved repeated squaring over GF(p), a[j] = a[j]^(2^nsqr) for j = 0,...,nlanes-1
+void fpsqrn1271_x(felm_t* a, unsigned int nsqr, unsigned int nlanes);
+
+// Interleaved exponentiation over GF(p), af[j] = a[j]^(2^125-1) for j = 0,...,nlanes-1, nlanes <= FP_LANES
+void fpexp1251_x(felm_t* a, felm_t* af, unsigned int nlanes);
+
 /************ Quadratic extension field arithmetic functions *************/
 
 // Zeroing a quadratic extension field element, a=0 
@@ -306,11 +407,20 @@ void fp2sqr1271_a(f2elm_t a, f2elm_t c);
 // Quadratic extension field inversion, af = a^-1 = a^(p-2) in GF((2^127-1)^2)
 void fp2inv1271(f2elm_t a);
 
+// Quadratic residuosity test over GF((2^127-1)^2), returns 1 if a is a square and 0 otherwise
+unsigned int fp2issquare1271(f2elm_t a);
+
+// Quadratic extension field square root, c = sqrt(a) in GF((2^127-1)^2), for a square a
+void fp2sqrt1271(f2elm_t a, f2elm_t c);
+
 /************ Curve and recoding functions *************/
 
 // Normalize projective twisted Edwards point Q = (X,Y,Z) -> P = (x,y)
 void eccnorm(point_extproj_t P, point_t Q);
 
+// Normalize npoints projective twisted Edwards points P[i] = (Xi,Yi,Zi) -> Q[i] = (xi,yi) using a single inversion
+void eccnorm_batch(point_extproj* P, point_affine* Q, unsigned int npoints);
+
 // Conversion from representation (X,Y,Z,Ta,Tb) to (X+Y,Y-X,2Z,2dT), where T = Ta*Tb
 void R1_to_R2(point_extproj_t P, point_extproj_precomp_t Q);
 
@@ -353,6 +463,12 @@ void cofactor_clearing(point_extproj_t P);
 // Precomputation function
 void ecc_precomp(point_extproj_t P, point_extproj_precomp_t *T);
 
+// Scalar preparation (decomposition and/or recoding) for the variable-base scalar multiplication
+bool ecc_mul_prepare(digit_t* k, unsigned int* digits, unsigned int* sign_masks);
+
+// Variable-base scalar multiplication P = k*P in extended coordinates, using a scalar prepared with ecc_mul_prepare()
+bool ecc_mul_prepared(point_extproj_t P, unsigned int* digits, unsigned int* sign_masks);
+
 // Constant-time table lookup to extract an extended twisted Edwards point (X+Y:Y-X:2Z:2T) from the precomputed table
 void table_lookup_1x8(point_extproj_precomp_t* table, point_extproj_precomp_t P, unsigned int digit, unsigned int sign_mask);
 void table_lookup_1x8_a(point_extproj_precomp_t* table, point_extproj_precomp_t P, unsigned int* digit, unsigned int* sign_mask);
@@ -364,14 +480,31 @@ void point_setup_ni(point_t P, point_extproj_t Q);
 // Point validation: check if point lies on the curve     
 bool ecc_point_validate(point_extproj_t P);
 
-// Output error/success message for a given ECCRYPTO_STATUS
-const char* FourQ_get_error_message(ECCRYPTO_STATUS Status);
-
 // Mixed point addition P = P+Q or P = P+P
 void eccmadd_ni(point_precomp_t Q, point_extproj_t P);
 
 // Constant-time table lookup to extract a point represented as (x+y,y-x,2t)
-void table_lookup_fixed_base(point_precomp_t* table, point_precomp_t P, unsigned int digit, unsigned int sign);
+void table_lookup_fixed_base(point_table_t* table, point_precomp_t P, unsigned int digit, unsigned int sign);
+
+// Fixed-base scalar multiplication R = k*G in extended coordinates, without normalization
+bool ecc_mul_fixed_ext(digit_t* k, point_extproj_t R);
+
+#if defined(SCA_PROTECTION)
+// Countermeasure state of the calling thread, refreshed every SCA_REFRESH_INTERVAL uses. Returns NULL if the random number generator fails
+sca_state* sca_get_state(void);
+
+// Draw "nmasks" fresh GF(p) masks and a random bit with a single call to the random number generator
+bool sca_draw_masks(felm_t* masks, unsigned int nmasks, digit_t* bit);
+
+// Update the blinding point R of ecc_mul_prepared() to ((-1)^bit*3)*R, together with its correction
+void sca_next_blinding_var(sca_state* state, digit_t bit);
+
+// Randomization of the projective coordinates of P = (X,Y,Z,Ta,Tb) using a GF(p) mask
+void ecc_randomize(point_extproj_t P, felm_t mask);
+
+// Point doubling 2P with randomization of the output coordinates using a GF(p) mask
+void eccdouble_randomized(point_extproj_t P, felm_t mask);
+#endif
 
 //  Computes the modified LSB-set representation of scalar
 void mLSB_set_recode(uint64_t* scalar, unsigned int *digits);
@@ -382,12 +515,51 @@ void ecc_precomp_double(point_extproj_t P, point_extproj_precomp_t* Table, unsig
 // Computes wNAF recoding of a scalar
 void wNAF_recode(uint64_t scalar, unsigned int w, int* digits);
 
+// Expansion of FIXED_BASE_TABLE to NPOINTS_FIXEDBASE points in representation (x+y,y-x,2dt)
+void ecc_fixed_base_points(point_precomp_t* T);
+
+// Precomputed tables copied by ecc_tables_place()
+#define TABLE_FIXED_BASE      0                 // FIXED_BASE_TABLE
+#define TABLE_DOUBLE_SCALAR   1                 // DOUBLE_SCALAR_TABLE
+#define NTABLES               2
+
+// Static precomputed tables Tables[i] and their sizes in bytes Sizes[i], which are 0 if the table is not used by this configuration
+void ecc_static_tables(const uint64_t** Tables, size_t* Sizes);
+
+// Copy of a precomputed table on the NUMA node of the calling thread, or NULL if the static tables are in use
+const uint64_t* ecc_placed_table(unsigned int Table);
+
+// X8_LANES fixed-base scalar multiplications R[j] = k_j*G without normalization, from X8_LANES rows of NDIGITS_FIXEDBASE mLSB-set digits
+// The "_emu" version emulates the AVX-512 IFMA instructions of the "_ifma" version and gives the same results
+void ecc_mul_fixed_x8_emu(point_precomp_t* table, unsigned int* digits, point_extproj* R);
+
+// X8_LANES variable-base scalar multiplications R[j] = k_j*P_j without normalization, from X8_LANES rows of 8 points computed 
+// by ecc_precomp() and X8_LANES rows of NDIGITS_VARBASE digits and sign masks computed by ecc_mul_prepare()
+void ecc_mul_table_x8_emu(point_extproj_precomp_t* tables, unsigned int* digits, unsigned int* sign_masks, point_extproj* R);
+
+#if defined(IFMA_SUPPORT)
+void ecc_mul_fixed_x8_ifma(point_precomp_t* table, unsigned int* digits, point_extproj* R);
+void ecc_mul_table_x8_ifma(point_extproj_precomp_t* tables, unsigned int* digits, unsigned int* sign_masks, point_extproj* R);
+#endif
+
+// Returns true if the batch functions use the AVX-512 IFMA engine on this processor
+bool ecc_batch_uses_ifma(void);
+
 // Encode point P
 void encode(point_t P, unsigned char* Pencoded);
 
 // Decode point P
 ECCRYPTO_STATUS decode(const unsigned char* Pencoded, point_t P);
 
+// Decode npoints points P[i] from consecutive encodings, with per-point status
+void decode_batch(const unsigned char* Pencoded, point_affine* P, ECCRYPTO_STATUS* Status, unsigned int npoints);
+
+// Constant-time Elligator 2 map from GF(p^2) to FourQ (without cofactor clearing)
+void ecc_map_to_curve(f2elm_t u, point_extproj_t P);
+
+// Hold back (hold = true) or resume the background refill of a pool while no refill is running. While held, pops never wake the refill threads
+void ephemeral_pool_hold_refill(ephemeral_pool_t* pool, bool hold);
+
 
 /************ Functions based on macros *************/
 
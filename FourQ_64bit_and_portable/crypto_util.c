@@ -119,6 +119,7 @@ ECCRYPTO_STATUS decode(const unsigned char* Pencoded, point_t P)
         fpneg1271(R->x[1]);
         fpcopy1271(R->x[1], P->x[1]);
         if (ecc_point_validate(R) == false) {       // Final point validation
+            METRICS_EVENT(METRICS_DECODE_FAILURE);
             return ECCRYPTO_ERROR;
         }
     }
@@ -127,6 +128,131 @@ ECCRYPTO_STATUS decode(const unsigned char* Pencoded, point_t P)
 }
 
 
+void decode_batch(const unsigned char* Pencoded, point_affine* P, ECCRYPTO_STATUS* Status, unsigned int npoints)
+{ // Decode npoints points P[i] from the consecutive 32-byte encodings in Pencoded, i = 0,...,npoints-1
+  // Status[i] is set to ECCRYPTO_SUCCESS or ECCRYPTO_ERROR for each point, with the same results as decode().
+  // The norms of the denominators v share a single inversion (Montgomery's simultaneous inversion), so that x = sqrt(u/v) 
+  // is computed from u/v directly. The square roots of a group of FP_LANES points are interleaved with fpsqrn1271_x() and 
+  // fpexp1251_x(). Since u/v is known, the sign of x1 follows from 2*x0*x1 = Im(u/v) and each point is validated once.
+  // P[i].x and P[i].y are used as scratch: P[i].x = (t0*...*ti, 1/ti) and P[i].y = (t1, t2), where ti = |v|^2 = t0 of point i.
+  // SECURITY NOTE: this function does not run in constant time.
+    felm_t t1[FP_LANES], t2[FP_LANES], t3[FP_LANES], r[FP_LANES], t0, t4;
+    f2elm_t u, v, one = {0};
+    digit_t sign_dec;
+    point_extproj_t R;
+    point_affine* Q;
+    unsigned int i, j, n, sign;
+
+    if (npoints == 0) {
+        return;
+    }
+    one[0][0] = 1;
+
+    for (i = 0; i < npoints; i++) {
+        memmove((unsigned char*)v, Pencoded + 32*i, 32);        // Decoding y-coordinate
+        v[1][NWORDS_FIELD-1] &= mask7fff;
+        fp2sqr1271(v, u);
+        fp2mul1271(u, (felm_t*)&PARAMETER_d, v);
+        fp2sub1271(u, one, u);
+        fp2add1271(v, one, v);                                  // u = y^2-1, v = dy^2+1
+
+        fpsqr1271(v[0], t0);
+        fpsqr1271(v[1], t4);
+        fpadd1271(t0, t4, t0);                                  // t0 = v0^2+v1^2
+        fpmul1271(u[0], v[0], P[i].y[0]);
+        fpmul1271(u[1], v[1], t4);
+        fpadd1271(P[i].y[0], t4, P[i].y[0]);                    // t1 = u0*v0+u1*v1
+        fpmul1271(u[1], v[0], P[i].y[1]);
+        fpmul1271(u[0], v[1], t4);
+        fpsub1271(P[i].y[1], t4, P[i].y[1]);                    // t2 = u1*v0-u0*v1, so that u/v = (t1+t2*i)/t0
+
+        mod1271(t0);
+        if (is_zero_ct(t0, NWORDS_FIELD) == true) {             // v = 0 implies t1 = t2 = 0, and then x = 0 as in decode()
+            fpcopy1271(one[0], t0);
+        }
+        fpcopy1271(t0, P[i].x[1]);
+        if (i == 0) {
+            fpcopy1271(t0, P[0].x[0]);
+        } else {
+            fpmul1271(P[i-1].x[0], t0, P[i].x[0]);              // P[i].x[0] = t0*...*ti
+        }
+    }
+    fpcopy1271(P[npoints-1].x[0], t0);
+    fpinv1271(t0);                                              // t0 = (t0*...*t(n-1))^-1
+    for (i = npoints-1; i > 0; i--) {
+        fpmul1271(t0, P[i].x[1], t4);                           // t4 = (t0*...*t(i-1))^-1
+        fpmul1271(t0, P[i-1].x[0], P[i].x[1]);                  // P[i].x[1] = ti^-1
+        fpcopy1271(t4, t0);
+    }
+    fpcopy1271(t0, P[0].x[1]);
+
+    for (i = 0; i < npoints; i += n) {
+        n = (npoints - i < FP_LANES) ? (npoints - i) : FP_LANES;
+        Q = &P[i];
+
+        for (j = 0; j < n; j++) {
+            fpcopy1271(Q[j].y[0], t1[j]);
+            fpmul1271(Q[j].y[1], Q[j].x[1], t2[j]);             // t2 = Im(u/v)
+            fpsqr1271(t1[j], t3[j]);
+            fpsqr1271(Q[j].y[1], t4);
+            fpadd1271(t3[j], t4, t3[j]);                        // t3 = t1^2+t2^2
+        }
+        fpsqrn1271_x(t3, 125, n);                               // t3 = sqrt(t1^2+t2^2) = t0*|u/v|
+
+        for (j = 0; j < n; j++) {
+            fpadd1271(t1[j], t3[j], t1[j]);                     // t1 = t1+t3
+            mod1271(t1[j]);
+            if (is_zero_ct(t1[j], NWORDS_FIELD) == true) {
+                fpcopy1271(Q[j].y[0], t1[j]);
+                fpsub1271(t1[j], t3[j], t1[j]);                 // t1 = t1-t3
+            }
+            fpmul1271(t1[j], Q[j].x[1], t1[j]);
+            fpdiv1271(t1[j]);                                   // t1 = (Re(u/v)+|u/v|)/2
+        }
+        fpexp1251_x(t1, r, n);                                  // r = t1^(2^125-1)
+
+        for (j = 0; j < n; j++) {
+            memmove((unsigned char*)Q[j].y, Pencoded + 32*(i+j), 32);
+            Q[j].y[1][NWORDS_FIELD-1] &= mask7fff;
+            fpdiv1271(t2[j]);
+            fpmul1271(t2[j], r[j], t2[j]);                      // t2 = Im(u/v)*r/2
+            fpmul1271(t1[j], r[j], t3[j]);                      // t3 = t1*r, a square root of t1 or of -t1
+            fpsqr1271(t3[j], t4);
+            fpsub1271(t4, t1[j], t4);
+            mod1271(t4);
+            if (is_zero_ct(t4, NWORDS_FIELD) == true) {         // t1*r^2 = 1: x0 = t1*r and x1 = Im(u/v)/(2*x0) = Im(u/v)*r/2 
+                fpcopy1271(t3[j], Q[j].x[0]);
+                fpcopy1271(t2[j], Q[j].x[1]);
+            } else {                                            // t1*r^2 = -1: x1 = t1*r and x0 = Im(u/v)/(2*x1) = -Im(u/v)*r/2
+                fpneg1271(t2[j]);
+                fpcopy1271(t2[j], Q[j].x[0]);
+                fpcopy1271(t3[j], Q[j].x[1]);
+            }
+
+            mod1271(Q[j].x[0]);
+            mod1271(Q[j].x[1]);
+            sign = (unsigned int)(Pencoded[32*(i+j)+31] >> 7);
+            if (is_zero_ct((digit_t*)Q[j].x, NWORDS_FIELD) == true) {
+                sign_dec = ((digit_t*)&Q[j].x[1])[NWORDS_FIELD-1] >> (sizeof(digit_t)*8 - 2);
+            } else {
+                sign_dec = ((digit_t*)&Q[j].x[0])[NWORDS_FIELD-1] >> (sizeof(digit_t)*8 - 2);
+            }
+            if (sign != (unsigned int)sign_dec) {               // If sign of x-coordinate decoded != input sign bit, then negate x-coordinate
+                fpneg1271(Q[j].x[0]);
+                fpneg1271(Q[j].x[1]);
+            }
+
+            Status[i+j] = ECCRYPTO_SUCCESS;                     // Final point validation, which fails if u/v is not a square
+            point_setup(&Q[j], R);
+            if (ecc_point_validate(R) == false) {
+                Status[i+j] = ECCRYPTO_ERROR;
+                METRICS_EVENT(METRICS_DECODE_FAILURE);
+            }
+        }
+    }
+}
+
+
 void to_Montgomery(const digit_t* ma, digit_t* c)
 { // Converting to Montgomery representation
 
@@ -235,4 +361,4 @@ const char* FourQ_get_error_message(ECCRYPTO_STATUS Status)
     } else {
         return mapping[Status].string;
     }
-};
\ No newline at end of file
+};
\ No newline at end of file
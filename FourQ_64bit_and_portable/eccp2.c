@@ -12,6 +12,9 @@
 ************************************************************************************/
 
 #include "FourQ_internal.h"
+#if defined(SCA_PROTECTION)
+    #include "../random/random.h"
+#endif
 
 
 #if (USE_ENDO == true)
@@ -61,6 +64,26 @@ static uint64_t ell2[4] = {0xD1BA1D84DD627AFB, 0x2BD235580F468D8D, 0x8FD4B04CAA6
 static uint64_t ell3[4] = {0x9B291A33678C203C, 0xC42BD6C965DCA902, 0xD038BF8D0BFFBAF6, 0x00};
 static uint64_t ell4[4] = {0x12E5666B77E7FDC0, 0x81CBDC3714983D82, 0x1B073877A22D8410, 0x03};
 
+#if defined(SCA_PROTECTION)
+// Fixed integer constants for scalar randomization: short vectors (pj1,pj2,pj3,pj4) of the lattice of decompositions of 0
+static uint64_t p11 = {0x190BE2D7F2E68811};   
+static uint64_t p12 = {0x2E5EBE12E05824E0};                                              
+static uint64_t p13 = {0x27C2D7D95E7F1AEB};                                              
+static uint64_t p14 = {0x02684DFF36C48F4F};   
+static uint64_t p21 = {0x36553EC277E34AE5};
+static uint64_t p22 = {0x2E5EBE12E05824DF};
+static uint64_t p23 = {0x27C2D7D95E7F1AEC};
+static uint64_t p24 = {0x284413BBC495F71F};
+static uint64_t p31 = {0x39BE8F1CF6A62CA9};
+static uint64_t p32 = {0x1DBEF6CB01B6D191};
+static uint64_t p33 = {0x00B81641C21F595B};
+static uint64_t p34 = {0x04B749AA70397695};
+static uint64_t p41 = {0x3F5C3DEA5883EC7B};
+static uint64_t p42 = {0x1AFAD5B01E2DF73F};
+static uint64_t p43 = {0x2F05380B4B471DFB};
+static uint64_t p44 = {0x1FF4A0223DDC10CE};
+#endif
+
 
 /***********************************************/
 /**********  CURVE/SCALAR FUNCTIONS  ***********/
@@ -418,6 +441,170 @@ void recode(uint64_t* scalars, unsigned int* digits, unsigned int* sign_masks)
 }
 
 
+#if defined(SCA_PROTECTION)
+
+static __inline uint64_t is_lessthan64_ct(uint64_t x, uint64_t y)
+{ // Constant-time comparison of 64-bit values, returns 1 if x < y and 0 otherwise
+    return (x ^ ((x ^ y) | ((x - y) ^ y))) >> 63;
+}
+
+
+static __inline void muladd_8x64(uint64_t* a, uint64_t r, uint64_t p)
+{ // Multiply-accumulate (a[1],a[0]) = (a[1],a[0]) + r*p, where r < 2^8
+    uint64_t lo = (p & 0xFFFFFFFF)*r, hi = (p >> 32)*r, t;
+
+    t = lo + (hi << 32);
+    a[1] += (hi >> 32) + is_lessthan64_ct(t, lo);
+    a[0] += t;
+    a[1] += is_lessthan64_ct(a[0], t);
+}
+
+
+static void randomize(uint64_t* scalars, unsigned char* r, uint64_t* random_scalars)
+{ // Scalar randomization for the variable-base scalar multiplication, adding the combination r0*p1 + r1*p2 + r2*p3 + r3*p4 of lattice vectors
+  // Input: 4 64-bit sub-scalars, which are obtained after calling decompose(), and 4 even 8-bit random values.
+  // Output: 4 72-bit sub-scalars, stored as (low, high) 64-bit word pairs. Since the random values are even, the first sub-scalar remains odd.
+    uint64_t r0 = (uint64_t)r[0], r1 = (uint64_t)r[1], r2 = (uint64_t)r[2], r3 = (uint64_t)r[3];
+
+    random_scalars[0] = scalars[0]; random_scalars[1] = 0;
+    random_scalars[2] = scalars[1]; random_scalars[3] = 0;
+    random_scalars[4] = scalars[2]; random_scalars[5] = 0;
+    random_scalars[6] = scalars[3]; random_scalars[7] = 0;
+
+    muladd_8x64(&random_scalars[0], r0, p11); muladd_8x64(&random_scalars[0], r1, p21);
+    muladd_8x64(&random_scalars[0], r2, p31); muladd_8x64(&random_scalars[0], r3, p41);
+    muladd_8x64(&random_scalars[2], r0, p12); muladd_8x64(&random_scalars[2], r1, p22);
+    muladd_8x64(&random_scalars[2], r2, p32); muladd_8x64(&random_scalars[2], r3, p42);
+    muladd_8x64(&random_scalars[4], r0, p13); muladd_8x64(&random_scalars[4], r1, p23);
+    muladd_8x64(&random_scalars[4], r2, p33); muladd_8x64(&random_scalars[4], r3, p43);
+    muladd_8x64(&random_scalars[6], r0, p14); muladd_8x64(&random_scalars[6], r1, p24);
+    muladd_8x64(&random_scalars[6], r2, p34); muladd_8x64(&random_scalars[6], r3, p44);
+}
+
+
+static void recode_randomized(uint64_t* scalars, unsigned int* digits, unsigned int* sign_masks)
+{ // Recoding of randomized sub-scalars for use in the variable-base scalar multiplication, using the same GLV-SAC representation as recode()
+  // Input: 4 72-bit sub-scalars passed through "scalars" as (low, high) 64-bit word pairs, which are obtained after calling randomize().
+  // Outputs: "digits" and "sign_masks" arrays with NDIGITS_VARBASE = 73 entries each.
+    unsigned int i, j, bit, bit0, carry;
+    sign_masks[NDIGITS_VARBASE-1] = (unsigned int)-1; 
+
+    for (i = 0; i < NDIGITS_VARBASE-1; i++)
+    {
+        scalars[0] = (scalars[0] >> 1) | (scalars[1] << 63);
+        scalars[1] >>= 1;
+        bit0 = (unsigned int)scalars[0] & 1;
+        sign_masks[i] = 0 - bit0;
+        digits[i] = 0;
+
+        for (j = 1; j < 4; j++) {
+            bit = (unsigned int)scalars[2*j] & 1;
+            carry = (bit0 | bit) ^ bit0; 
+            scalars[2*j] = ((scalars[2*j] >> 1) | (scalars[2*j+1] << 63)) + (uint64_t)carry;
+            scalars[2*j+1] = (scalars[2*j+1] >> 1) + is_lessthan64_ct(scalars[2*j], (uint64_t)carry);
+            digits[i] += (bit << (j-1));
+        }
+    }
+    digits[NDIGITS_VARBASE-1] = (unsigned int)(scalars[2] + (scalars[4] << 1) + (scalars[6] << 2));
+}
+
+#endif
+
+
+bool ecc_mul_prepare(digit_t* k, unsigned int* digits, unsigned int* sign_masks)
+{ // Scalar preparation for the variable-base scalar multiplication: 4-dimensional decomposition and recoding
+  // Input:   scalar "k" in [0, 2^256-1]
+  // Outputs: digits and sign_masks, NDIGITS_VARBASE entries each, to be used by ecc_mul_prepared()
+  // With SCA_PROTECTION, the sub-scalars are randomized with a random combination of lattice vectors before recoding, using random values
+  // drawn on every call. Returns false if the random number generator fails.
+    uint64_t scalars[NWORDS64_ORDER];
+#if defined(SCA_PROTECTION)
+    uint64_t random_scalars[2*NWORDS64_ORDER];
+    unsigned char r[4];
+    unsigned int i;
+
+    if (RandomBytesFunction(r, 4) != ECCRYPTO_SUCCESS) {
+        return false;
+    }
+    for (i = 0; i < 4; i++) {
+        r[i] &= 0xFE;                                         // Even 8-bit random values
+    }
+    decompose((uint64_t*)k, scalars);                         // Scalar decomposition
+    randomize(scalars, r, random_scalars);                    // Scalar randomization
+    recode_randomized(random_scalars, digits, sign_masks);    // Scalar recoding
+
+    clear_words((void*)random_scalars, 2*NWORDS64_ORDER*(sizeof(uint64_t)/sizeof(unsigned int)));
+    clear_words((void*)r, 1);
+#else
+    decompose((uint64_t*)k, scalars);                         // Scalar decomposition
+    recode(scalars, digits, sign_masks);                      // Scalar recoding
+#endif
+    
+#ifdef TEMP_ZEROING
+    clear_words((void*)scalars, NWORDS64_ORDER*(sizeof(uint64_t)/sizeof(unsigned int)));
+#endif
+    return true;
+}
+
+
+bool ecc_mul_prepared(point_extproj_t P, unsigned int* digits, unsigned int* sign_masks)
+{ // Variable-base scalar multiplication P = k*P using a scalar k prepared with ecc_mul_prepare()
+  // Input:  P = (X1,Y1,Z1,Ta,Tb), where T1 = Ta*Tb, corresponding to (X1:Y1:Z1:T1) in extended twisted Edwards coordinates
+  // Output: P = k*P = (Xfinal,Yfinal,Zfinal,Tafinal,Tbfinal), where Tfinal = Tafinal*Tbfinal
+  // This function does not perform point validation or cofactor clearing.
+  // With SCA_PROTECTION, the table is computed from randomized coordinates of P, the coordinates of the accumulator are randomized at every other
+  // doubling, and the computation is executed as P = (k*P + 2^(NDIGITS_VARBASE-1)*R) - 2^(NDIGITS_VARBASE-1)*R with the blinding point R.
+  // The SCA_MASKS_VARBASE masks are drawn on every call. Returns false, without computing P, if the random number generator fails.
+    point_extproj_precomp_t S, Table[8];
+    int i;
+#if defined(SCA_PROTECTION)
+    sca_state* state = sca_get_state();
+    felm_t masks[SCA_MASKS_VARBASE];
+    digit_t bit;
+
+    if (state == NULL || sca_draw_masks(masks, SCA_MASKS_VARBASE, &bit) == false) {
+        return false;
+    }
+    ecc_randomize(P, masks[SCA_MASKS_VARBASE-1]);            // Randomization of P's coordinates and, thereby, of the table
+#endif
+
+    ecc_precomp(P, Table);                                    // Precomputation
+    table_lookup_1x8(Table, S, digits[NDIGITS_VARBASE-1], sign_masks[NDIGITS_VARBASE-1]);  // Extract initial point in (X+Y,Y-X,2Z,2dT) representation
+#if defined(SCA_PROTECTION)
+    ecccopy(state->blind_var, P);
+    eccadd(S, P);                                             // P = R+S with the blinding point R
+#else
+    R2_to_R4(S, P);                                           // Conversion to representation (2X,2Y,2Z)
+#endif
+    
+    for (i = NDIGITS_VARBASE-2; i >= 0; i--)
+    {
+        table_lookup_1x8(Table, S, digits[i], sign_masks[i]); // Extract point S in (X+Y,Y-X,2Z,2dT) representation
+#if defined(SCA_PROTECTION)
+        if ((i & 1) == 0) {                                   // P = 2*P with randomization of P's coordinates at every other doubling
+            eccdouble_randomized(P, masks[i/2]);
+        } else {
+            eccdouble(P);
+        }
+#else
+        eccdouble(P);                                         // P = 2*P using representations (X,Y,Z,Ta,Tb) <- 2*(X,Y,Z)
+#endif
+        eccadd(S, P);                                         // P = P+S using representations (X,Y,Z,Ta,Tb) <- (X,Y,Z,Ta,Tb) + (X+Y,Y-X,2Z,2dT)
+    }
+#if defined(SCA_PROTECTION)
+    R1_to_R2(state->unblind_var, S);
+    eccadd(S, P);                                             // P = P-2^(NDIGITS_VARBASE-1)*R
+    sca_next_blinding_var(state, bit);                        // Next blinding point ((-1)^bit*3)*R and its correction
+    clear_words((void*)masks, SCA_MASKS_VARBASE*(sizeof(felm_t)/sizeof(unsigned int)));
+#endif
+    
+#ifdef TEMP_ZEROING
+    clear_words((void*)S, sizeof(point_extproj_precomp_t)/sizeof(unsigned int));
+#endif
+    return true;
+}
+
+
 bool ecc_mul(point_t P, digit_t* k, point_t Q, bool clear_cofactor)
 { // Variable-base scalar multiplication Q = k*P using a 4-dimensional decomposition
   // Inputs: scalar "k" in [0, 2^256-1],
@@ -425,44 +612,38 @@ bool ecc_mul(point_t P, digit_t* k, point_t Q, bool clear_cofactor)
   //         clear_cofactor = 1 (TRUE) or 0 (FALSE) whether cofactor clearing is required or not, respectively.
   // Output: Q = k*P in affine coordinates (x,y).
   // This function performs point validation and (if selected) cofactor clearing.
+  // Returns false if P is not on the curve, or if the side-channel countermeasures (SCA_PROTECTION) cannot draw random values.
     point_extproj_t R;
-    point_extproj_precomp_t S, Table[8];
-    uint64_t scalars[NWORDS64_ORDER];
-    unsigned int digits[65], sign_masks[65];
-    int i;
+    unsigned int digits[NDIGITS_VARBASE], sign_masks[NDIGITS_VARBASE];
+    bool valid;
 
     point_setup(P, R);                                        // Convert to representation (X,Y,1,Ta,Tb)
-    decompose((uint64_t*)k, scalars);                         // Scalar decomposition
+    if (ecc_mul_prepare(k, digits, sign_masks) == false) {    // Scalar decomposition and recoding
+        return false;
+    }
     
     if (ecc_point_validate(R) == false) {                     // Check if point lies on the curve
+        METRICS_EVENT(METRICS_INVALID_POINT);
         return false;
     }
     
     if (clear_cofactor == true) {
         cofactor_clearing(R);
     }
-    recode(scalars, digits, sign_masks);                      // Scalar recoding
-    ecc_precomp(R, Table);                                    // Precomputation
-    table_lookup_1x8(Table, S, digits[64], sign_masks[64]);   // Extract initial point in (X+Y,Y-X,2Z,2dT) representation
-    R2_to_R4(S, R);                                           // Conversion to representation (2X,2Y,2Z)
-    
-    for (i = 63; i >= 0; i--)
-    {
-        table_lookup_1x8(Table, S, digits[i], sign_masks[i]); // Extract point S in (X+Y,Y-X,2Z,2dT) representation
-        eccdouble(R);                                         // P = 2*P using representations (X,Y,Z,Ta,Tb) <- 2*(X,Y,Z)
-        eccadd(S, R);                                         // P = P+S using representations (X,Y,Z,Ta,Tb) <- (X,Y,Z,Ta,Tb) + (X+Y,Y-X,2Z,2dT)
+    valid = ecc_mul_prepared(R, digits, sign_masks);
+    if (valid == true) {
+        eccnorm(R, Q);                                        // Conversion to affine coordinates (x,y) and modular correction. 
     }
-    eccnorm(R, Q);                                            // Conversion to affine coordinates (x,y) and modular correction. 
     
 #ifdef TEMP_ZEROING
-    clear_words((void*)digits, 65);
-    clear_words((void*)sign_masks, 65);
-    clear_words((void*)S, sizeof(point_extproj_precomp_t)/sizeof(unsigned int));
+    clear_words((void*)digits, NDIGITS_VARBASE);
+    clear_words((void*)sign_masks, NDIGITS_VARBASE);
 #endif
-    return true;
+    return valid;
 }
 
 
+
 void cofactor_clearing(point_extproj_t P)
 { // Co-factor clearing
   // Input: P = (X1,Y1,Z1,Ta,Tb), where T1 = Ta*Tb, corresponding to (X1:Y1:Z1:T1) in extended twisted Edwards coordinates
@@ -0,0 +1,216 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: batched scalar multiplications
+*
+* Batches are computed X8_LANES scalar multiplications at a time by the AVX-512 IFMA
+* engine of eccp2_x8.c, when the library is built with IFMA support and the processor
+* reports AVX-512F and AVX-512 IFMA. Otherwise every item is computed with the scalar
+* functions. Precomputation, scalar recoding and normalization are scalar in both cases.
+************************************************************************************/
+
+#include "FourQ_internal.h"
+#if defined(IFMA_SUPPORT)
+    #include <cpuid.h>
+#endif
+
+
+bool ecc_batch_uses_ifma(void)
+{ // Returns true if the library is built with IFMA support, and the processor and the OS support AVX-512F and AVX-512 IFMA
+#if defined(IFMA_SUPPORT)
+    unsigned int eax, ebx, ecx, edx, xcr0, xcr0_hi;
+
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0 || (ecx & (1 << 27)) == 0) {       // OSXSAVE
+        return false;
+    }
+    __asm__ __volatile__ ("xgetbv" : "=a"(xcr0), "=d"(xcr0_hi) : "c"(0));
+    if ((xcr0 & 0xE6) != 0xE6) {                                                         // SSE, AVX, opmask and ZMM states enabled by the OS
+        return false;
+    }
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) == 0) {
+        return false;
+    }
+    return ((ebx & (1 << 16)) != 0) && ((ebx & (1 << 21)) != 0);                        // AVX512F and AVX512IFMA
+#else
+    return false;
+#endif
+}
+
+
+#if defined(IFMA_SUPPORT)
+
+static void fixed_base_recode_x8(digit_t* k, unsigned int n, unsigned int* digits)
+{ // mLSB-set recoding of the scalars k_j, j = 0,...,n-1, stored consecutively in k, as in ecc_mul_fixed_ext()
+  // Output: X8_LANES rows of NDIGITS_FIXEDBASE digits. Unused lanes repeat the first scalar
+    digit_t temp[NWORDS_ORDER];
+    unsigned int j;
+
+    for (j = 0; j < X8_LANES; j++) {
+        modulo_order(k + ((j < n) ? j : 0)*NWORDS_ORDER, temp);   // temp = k mod (order)
+        conversion_to_odd(temp, temp);                              // Converting scalar to odd using the prime subgroup order
+        mLSB_set_recode((uint64_t*)temp, digits + j*NDIGITS_FIXEDBASE);
+    }
+
+#ifdef TEMP_ZEROING
+    clear_words((void*)temp, NWORDS_ORDER*(sizeof(digit_t)/sizeof(unsigned int)));
+#endif
+}
+
+
+#if (USE_ENDO == true)
+
+static bool ecc_precomp_x8(point_affine* P, digit_t* k, unsigned int n, bool clear_cofactor, point_extproj_precomp_t* tables, unsigned int* digits, unsigned int* sign_masks)
+{ // Precomputation and scalar preparation for ecc_mul_table_x8_ifma(), for the points P[j] and the scalars k_j, j = 0,...,n-1
+  // Outputs: X8_LANES rows of 8 points computed by ecc_precomp(), and X8_LANES rows of NDIGITS_VARBASE digits and sign masks computed
+  //          by ecc_mul_prepare(). Unused lanes repeat the first point and scalar. Returns false if a point does not lie on the curve or
+  //          if ecc_mul_prepare() fails
+    point_extproj_t R;
+    unsigned int j, i;
+
+    for (j = 0; j < X8_LANES; j++) {
+        i = (j < n) ? j : 0;
+        point_setup(&P[i], R);                                      // Convert to representation (X,Y,1,Ta,Tb)
+        if (ecc_point_validate(R) == false) {                       // Check if point lies on the curve
+            METRICS_EVENT(METRICS_INVALID_POINT);
+            return false;
+        }
+        if (clear_cofactor == true) {
+            cofactor_clearing(R);
+        }
+        ecc_precomp(R, tables + 8*j);                               // Precomputation
+        if (ecc_mul_prepare(k + i*NWORDS_ORDER, digits + j*NDIGITS_VARBASE, sign_masks + j*NDIGITS_VARBASE) == false) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#endif
+#endif
+
+
+bool ecc_mul_fixed_batch(digit_t* k, point_affine* Q, unsigned int npoints)
+{ // Batched fixed-base scalar multiplications Q[i] = k_i*G, i = 0,...,npoints-1, where G is the generator
+  // Inputs: npoints scalars k_i in [0, 2^256-1], stored consecutively in k (NWORDS_ORDER digits each)
+  // Output: Q[i] = k_i*G in affine coordinates (x,y)
+  // With SCA_PROTECTION, the scalar ecc_mul_fixed_ext() with its countermeasures is always used, and the function returns false if
+  // it fails to draw random values.
+    point_extproj R[X8_LANES];
+    unsigned int i, j, n;
+#if defined(IFMA_SUPPORT) && !defined(SCA_PROTECTION)
+    point_precomp_t table[NPOINTS_FIXEDBASE];
+    unsigned int digits[X8_LANES*NDIGITS_FIXEDBASE] = {0};
+
+    if (ecc_batch_uses_ifma() == true) {
+        ecc_fixed_base_points(table);
+        for (i = 0; i < npoints; i += n) {
+            n = (npoints-i < X8_LANES) ? (npoints-i) : X8_LANES;
+            fixed_base_recode_x8(k + i*NWORDS_ORDER, n, digits);
+            ecc_mul_fixed_x8_ifma(table, digits, R);
+            eccnorm_batch(R, Q + i, n);                             // Conversion to affine coordinates (x,y) and modular correction
+        }
+#ifdef TEMP_ZEROING
+        clear_words((void*)digits, X8_LANES*NDIGITS_FIXEDBASE);
+#endif
+        return true;
+    }
+#endif
+
+    for (i = 0; i < npoints; i += n) {
+        n = (npoints-i < X8_LANES) ? (npoints-i) : X8_LANES;
+        for (j = 0; j < n; j++) {
+            if (ecc_mul_fixed_ext(k + (i+j)*NWORDS_ORDER, &R[j]) == false) {
+                return false;
+            }
+        }
+        eccnorm_batch(R, Q + i, n);
+    }
+    return true;
+}
+
+
+bool ecc_mul_batch(point_affine* P, digit_t* k, point_affine* Q, unsigned int npoints, bool clear_cofactor)
+{ // Batched variable-base scalar multiplications Q[i] = k_i*P[i], i = 0,...,npoints-1
+  // Inputs: points P[i] in affine coordinates,
+  //         npoints scalars k_i in [0, 2^256-1], stored consecutively in k (NWORDS_ORDER digits each),
+  //         clear_cofactor = 1 (TRUE) or 0 (FALSE) whether cofactor clearing is required or not, respectively.
+  // Output: Q[i] = k_i*P[i] in affine coordinates (x,y). Q may alias P.
+  // Returns false if a point does not lie on the curve, in which case the contents of Q are undefined.
+  // With SCA_PROTECTION, the scalar ecc_mul() with its countermeasures is always used.
+    unsigned int i;
+#if defined(IFMA_SUPPORT) && (USE_ENDO == true) && !defined(SCA_PROTECTION)
+    point_extproj R[X8_LANES];
+    point_extproj_precomp_t tables[8*X8_LANES];
+    unsigned int n, digits[X8_LANES*NDIGITS_VARBASE], sign_masks[X8_LANES*NDIGITS_VARBASE];
+    bool valid = true;
+
+    if (ecc_batch_uses_ifma() == true) {
+        for (i = 0; i < npoints && valid == true; i += n) {
+            n = (npoints-i < X8_LANES) ? (npoints-i) : X8_LANES;
+            valid = ecc_precomp_x8(P + i, k + i*NWORDS_ORDER, n, clear_cofactor, tables, digits, sign_masks);
+            if (valid == true) {
+                ecc_mul_table_x8_ifma(tables, digits, sign_masks, R);
+                eccnorm_batch(R, Q + i, n);                         // Conversion to affine coordinates (x,y) and modular correction
+            }
+        }
+#ifdef TEMP_ZEROING
+        clear_words((void*)digits, X8_LANES*NDIGITS_VARBASE);
+        clear_words((void*)sign_masks, X8_LANES*NDIGITS_VARBASE);
+#endif
+        return valid;
+    }
+#endif
+
+    for (i = 0; i < npoints; i++) {
+        if (ecc_mul(&P[i], k + i*NWORDS_ORDER, &Q[i], clear_cofactor) == false) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+bool ecc_mul_double_batch(digit_t* k, point_affine* Q, digit_t* l, point_affine* R, unsigned int npoints)
+{ // Batched double scalar multiplications R[i] = k_i*G + l_i*Q[i], i = 0,...,npoints-1, where G is the generator
+  // Inputs: points Q[i] in affine coordinates,
+  //         npoints scalars k_i and l_i in [0, 2^256-1], stored consecutively in k and l (NWORDS_ORDER digits each).
+  // Output: R[i] = k_i*G + l_i*Q[i] in affine coordinates (x,y). R may alias Q.
+  // Returns false if a point does not lie on the curve, in which case the contents of R are undefined.
+  // SECURITY NOTE: as ecc_mul_double(), this function is intended for public inputs such as those of signature verification.
+    unsigned int i;
+#if defined(IFMA_SUPPORT) && (USE_ENDO == true)
+    point_extproj S[X8_LANES], T[X8_LANES];
+    point_extproj_precomp_t U, tables[8*X8_LANES];
+    point_precomp_t table[NPOINTS_FIXEDBASE];
+    unsigned int j, n, digits[X8_LANES*NDIGITS_VARBASE], sign_masks[X8_LANES*NDIGITS_VARBASE];
+    unsigned int fixed_digits[X8_LANES*NDIGITS_FIXEDBASE] = {0};
+
+    if (ecc_batch_uses_ifma() == true) {
+        ecc_fixed_base_points(table);
+        for (i = 0; i < npoints; i += n) {
+            n = (npoints-i < X8_LANES) ? (npoints-i) : X8_LANES;
+            if (ecc_precomp_x8(Q + i, l + i*NWORDS_ORDER, n, false, tables, digits, sign_masks) == false) {
+                return false;
+            }
+            fixed_base_recode_x8(k + i*NWORDS_ORDER, n, fixed_digits);
+            ecc_mul_fixed_x8_ifma(table, fixed_digits, S);          // S[j] = k_j*G
+            ecc_mul_table_x8_ifma(tables, digits, sign_masks, T);  // T[j] = l_j*Q[j]
+            for (j = 0; j < n; j++) {
+                R1_to_R2(&S[j], U);
+                eccadd(U, &T[j]);                                   // T[j] = k_j*G + l_j*Q[j]
+            }
+            eccnorm_batch(T, R + i, n);                             // Conversion to affine coordinates (x,y) and modular correction
+        }
+        return true;
+    }
+#endif
+
+    for (i = 0; i < npoints; i++) {
+        if (ecc_mul_double(k + i*NWORDS_ORDER, &Q[i], l + i*NWORDS_ORDER, &R[i]) == false) {
+            return false;
+        }
+    }
+    return true;
+}
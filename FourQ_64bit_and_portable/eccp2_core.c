@@ -14,15 +14,47 @@
 #include "FourQ_internal.h"
 #include "FourQ_params.h"
 #include "FourQ_tables.h"
+#include <string.h>
 #if defined(GENERIC_IMPLEMENTATION)
     #include "generic/fp.h"
 #elif (TARGET == TARGET_AMD64)
     #include "AMD64/fp_x64.h"
 #elif (TARGET == TARGET_ARM64)
     #include "ARM64/fp_arm64.h"
+#elif (TARGET == TARGET_RV64)
+    #include "RV64/fp_rv64.h"
+#endif
+#if defined(SCA_PROTECTION)
+    #include "../random/random.h"
 #endif
 
 
+/***********************************************/
+/************* OPERATION COUNTERS **************/
+
+#if defined(FOURQ_COUNT_OPS)
+THREAD_LOCAL op_counts_t op_counts;
+#endif
+
+
+void FourQ_GetOpCounts(op_counts_t* Counts)
+{ // Snapshot of the operation counters of the calling thread. All counters read zero unless FOURQ_COUNT_OPS is defined
+#if defined(FOURQ_COUNT_OPS)
+    *Counts = op_counts;
+#else
+    memset(Counts, 0, sizeof(op_counts_t));
+#endif
+}
+
+
+void FourQ_ResetOpCounts(void)
+{ // Reset the operation counters of the calling thread
+#if defined(FOURQ_COUNT_OPS)
+    memset(&op_counts, 0, sizeof(op_counts_t));
+#endif
+}
+
+
 /***********************************************/
 /************* GF(p^2) FUNCTIONS ***************/
 
@@ -49,6 +81,7 @@ void fp2neg1271(f2elm_t a)
 
 void fp2sqr1271(f2elm_t a, f2elm_t c)
 {// GF(p^2) squaring, c = a^2 in GF((2^127-1)^2)
+    COUNT_OP(fp2sqr);
 
 #ifdef ASM_SUPPORT
     fp2sqr1271_a(a, c);
@@ -71,6 +104,7 @@ void fp2sqr1271(f2elm_t a, f2elm_t c)
 
 void fp2mul1271(f2elm_t a, f2elm_t b, f2elm_t c)
 {// GF(p^2) multiplication, c = a*b in GF((2^127-1)^2)
+    COUNT_OP(fp2mul);
 
 #if defined(ASM_SUPPORT)        
     fp2mul1271_a(a, b, c);
@@ -125,6 +159,7 @@ void fp2inv1271(f2elm_t a)
 {// GF(p^2) inversion, a = (a0-i*a1)/(a0^2+a1^2)
     f2elm_t t1;
 
+    COUNT_OP(fp2inv);
     fpsqr1271(a[0], t1[0]);             // t10 = a0^2
     fpsqr1271(a[1], t1[1]);             // t11 = a1^2
     fpadd1271(t1[0], t1[1], t1[0]);     // t10 = a0^2+a1^2
@@ -138,6 +173,75 @@ void fp2inv1271(f2elm_t a)
 }
 
 
+void fpsqrn1271_x(felm_t* a, unsigned int nsqr, unsigned int nlanes)
+{ // Interleaved repeated squaring over GF(p), a[j] = a[j]^(2^nsqr) for j = 0,...,nlanes-1
+  // The independent squaring chains are computed in lockstep so that their latencies overlap.
+    unsigned int i, j;
+
+    for (i = 0; i < nsqr; i++) {
+        for (j = 0; j < nlanes; j++) {
+            fpsqr1271(a[j], a[j]);
+        }
+    }
+}
+
+
+void fpexp1251_x(felm_t* a, felm_t* af, unsigned int nlanes)
+{ // Interleaved exponentiation over GF(p), af[j] = a[j]^(2^125-1) for j = 0,...,nlanes-1 (nlanes <= FP_LANES)
+  // Same addition chain as fpexp1251(), computed in lockstep for nlanes independent inputs.
+    unsigned int j;
+    felm_t t1[FP_LANES], t2[FP_LANES], t3[FP_LANES], t4[FP_LANES], t5[FP_LANES];
+
+    for (j = 0; j < nlanes; j++) {
+        fpsqr1271(a[j], t2[j]);
+        fpmul1271(a[j], t2[j], t2[j]);
+        fpsqr1271(t2[j], t3[j]);
+    }
+    fpsqrn1271_x(t3, 1, nlanes);
+    for (j = 0; j < nlanes; j++) {
+        fpmul1271(t2[j], t3[j], t3[j]);
+        fpsqr1271(t3[j], t4[j]);
+    }
+    fpsqrn1271_x(t4, 3, nlanes);
+    for (j = 0; j < nlanes; j++) {
+        fpmul1271(t3[j], t4[j], t4[j]);
+        fpsqr1271(t4[j], t5[j]);
+    }
+    fpsqrn1271_x(t5, 7, nlanes);
+    for (j = 0; j < nlanes; j++) {
+        fpmul1271(t4[j], t5[j], t5[j]);
+        fpsqr1271(t5[j], t2[j]);
+    }
+    fpsqrn1271_x(t2, 15, nlanes);
+    for (j = 0; j < nlanes; j++) {
+        fpmul1271(t5[j], t2[j], t2[j]);
+        fpsqr1271(t2[j], t1[j]);
+    }
+    fpsqrn1271_x(t1, 31, nlanes);
+    for (j = 0; j < nlanes; j++) {
+        fpmul1271(t2[j], t1[j], t1[j]);
+    }
+    fpsqrn1271_x(t1, 32, nlanes);
+    for (j = 0; j < nlanes; j++) {
+        fpmul1271(t1[j], t2[j], t1[j]);
+    }
+    fpsqrn1271_x(t1, 16, nlanes);
+    for (j = 0; j < nlanes; j++) {
+        fpmul1271(t5[j], t1[j], t1[j]);
+    }
+    fpsqrn1271_x(t1, 8, nlanes);
+    for (j = 0; j < nlanes; j++) {
+        fpmul1271(t4[j], t1[j], t1[j]);
+    }
+    fpsqrn1271_x(t1, 4, nlanes);
+    for (j = 0; j < nlanes; j++) {
+        fpmul1271(t3[j], t1[j], t1[j]);
+        fpsqr1271(t1[j], t1[j]);
+        fpmul1271(a[j], t1[j], af[j]);
+    }
+}
+
+
 void clear_words(void* mem, unsigned int nwords)
 { // Clear integer-size digits from memory. "nwords" indicates the number of integer digits to be zeroed.
   // This function uses the volatile type qualifier to inform the compiler not to optimize out the memory clearing.
@@ -176,6 +280,39 @@ void eccnorm(point_extproj_t P, point_t Q)
 }
 
 
+void eccnorm_batch(point_extproj* P, point_affine* Q, unsigned int npoints)
+{ // Normalize "npoints" projective points (Xi:Yi:Zi) using a single inversion (Montgomery's simultaneous inversion), including full reduction
+  // Input:  P[i] = (Xi:Yi:Zi) in twisted Edwards coordinates, i = 0,...,npoints-1. Zi != 0
+  // Output: Q[i] = (Xi/Zi,Yi/Zi), corresponding to (Xi:Yi:Zi:Ti) in extended twisted Edwards coordinates
+    f2elm_t t0, t1;
+    unsigned int i;
+
+    if (npoints == 0) {
+        return;
+    }
+
+    fp2copy1271(P[0].z, Q[0].x);
+    for (i = 1; i < npoints; i++) {
+        fp2mul1271(Q[i-1].x, P[i].z, Q[i].x);     // Q[i].x = Z0*...*Zi
+    }
+    fp2copy1271(Q[npoints-1].x, t0);
+    fp2inv1271(t0);                               // t0 = (Z0*...*Z(n-1))^-1
+
+    for (i = npoints-1; i > 0; i--) {
+        fp2mul1271(t0, Q[i-1].x, t1);             // t1 = Zi^-1
+        fp2mul1271(t0, P[i].z, t0);               // t0 = (Z0*...*Z(i-1))^-1
+        fp2mul1271(P[i].x, t1, Q[i].x);           // Xi = Xi/Zi
+        fp2mul1271(P[i].y, t1, Q[i].y);           // Yi = Yi/Zi
+        mod1271(Q[i].x[0]); mod1271(Q[i].x[1]); 
+        mod1271(Q[i].y[0]); mod1271(Q[i].y[1]); 
+    }
+    fp2mul1271(P[0].x, t0, Q[0].x);
+    fp2mul1271(P[0].y, t0, Q[0].y);
+    mod1271(Q[0].x[0]); mod1271(Q[0].x[1]); 
+    mod1271(Q[0].y[0]); mod1271(Q[0].y[1]); 
+}
+
+
 __inline void R1_to_R2(point_extproj_t P, point_extproj_precomp_t Q) 
 { // Conversion from representation (X,Y,Z,Ta,Tb) to (X+Y,Y-X,2Z,2dT), where T = Ta*Tb
   // Input:  P = (X1,Y1,Z1,Ta,Tb), where T1 = Ta*Tb, corresponding to (X1:Y1:Z1:T1) in extended twisted Edwards coordinates
@@ -220,6 +357,7 @@ __inline void eccdouble(point_extproj_t P)
   //         corresponding to (Xfinal:Yfinal:Zfinal:Tfinal) in extended twisted Edwards coordinates
     f2elm_t t1, t2;  
 
+    COUNT_OP(eccdouble);
     fp2sqr1271(P->x, t1);                  // t1 = X1^2
     fp2sqr1271(P->y, t2);                  // t2 = Y1^2
     fp2add1271(P->x, P->y, P->x);          // t3 = X1+Y1
@@ -239,6 +377,56 @@ __inline void eccdouble(point_extproj_t P)
 }
 
 
+#if defined(SCA_PROTECTION)
+
+void ecc_randomize(point_extproj_t P, felm_t mask)
+{ // Randomization of the projective coordinates of a point using a GF(p) mask
+  // Input: P = (X1,Y1,Z1,Ta,Tb), where T1 = Ta*Tb, and a nonzero mask
+  // Output: P = (mask*X1,mask*Y1,mask*Z1,mask*Ta,Tb), which represents the same point
+    fpmul1271(P->x[0], mask, P->x[0]);
+    fpmul1271(P->x[1], mask, P->x[1]);
+    fpmul1271(P->y[0], mask, P->y[0]);
+    fpmul1271(P->y[1], mask, P->y[1]);
+    fpmul1271(P->z[0], mask, P->z[0]);
+    fpmul1271(P->z[1], mask, P->z[1]);
+    fpmul1271(P->ta[0], mask, P->ta[0]);
+    fpmul1271(P->ta[1], mask, P->ta[1]);
+}
+
+
+void eccdouble_randomized(point_extproj_t P, felm_t mask)
+{ // Point doubling 2P with randomization of the output coordinates
+  // Input: P = (X1:Y1:Z1) in twisted Edwards coordinates, and a nonzero mask
+  // Output: 2P = (Xfinal,Yfinal,Zfinal,Tafinal,Tbfinal), where all of Xfinal, Yfinal, Zfinal and Tfinal = Tafinal*Tbfinal are 
+  //         multiplied by the mask. Scaling Ta and Y1^2-X1^2 before the last multiplications costs 4 GF(p) multiplications
+    f2elm_t t1, t2;  
+
+    COUNT_OP(eccdouble);
+    fp2sqr1271(P->x, t1);                  // t1 = X1^2
+    fp2sqr1271(P->y, t2);                  // t2 = Y1^2
+    fp2add1271(P->x, P->y, P->x);          // t3 = X1+Y1
+    fp2add1271(t1, t2, P->tb);             // Tbfinal = X1^2+Y1^2      
+    fp2sub1271(t2, t1, t1);                // t1 = Y1^2-X1^2      
+    fp2sqr1271(P->x, P->ta);               // Ta = (X1+Y1)^2 
+    fp2sqr1271(P->z, t2);                  // t2 = Z1^2  
+    fp2sub1271(P->ta, P->tb, P->ta);       // Ta = 2X1*Y1 = (X1+Y1)^2-(X1^2+Y1^2)  
+    fp2addsub1271(t2, t1, t2);             // t2 = 2Z1^2-(Y1^2-X1^2) 
+    fpmul1271(t1[0], mask, t1[0]);         // t1 = mask*(Y1^2-X1^2)
+    fpmul1271(t1[1], mask, t1[1]);
+    fpmul1271(P->ta[0], mask, P->ta[0]);   // Tafinal = mask*2X1*Y1
+    fpmul1271(P->ta[1], mask, P->ta[1]);
+    fp2mul1271(t1, P->tb, P->y);           // Yfinal = mask*(X1^2+Y1^2)(Y1^2-X1^2)  
+    fp2mul1271(t2, P->ta, P->x);           // Xfinal = mask*2X1*Y1*[2Z1^2-(Y1^2-X1^2)]
+    fp2mul1271(t1, t2, P->z);              // Zfinal = mask*(Y1^2-X1^2)[2Z1^2-(Y1^2-X1^2)]
+#ifdef TEMP_ZEROING
+    clear_words((void*)t1, sizeof(f2elm_t)/sizeof(unsigned int));
+    clear_words((void*)t2, sizeof(f2elm_t)/sizeof(unsigned int));
+#endif
+}
+
+#endif
+
+
 __inline void eccadd_core(point_extproj_precomp_t P, point_extproj_precomp_t Q, point_extproj_t R)      
 { // Basic point addition R = P+Q or R = P+P
   // Inputs: P = (X1+Y1,Y1-X1,2Z1,2dT1) corresponding to (X1:Y1:Z1:T1) in extended twisted Edwards coordinates
@@ -247,6 +435,7 @@ __inline void eccadd_core(point_extproj_precomp_t P, point_extproj_precomp_t Q,
   //         corresponding to (Xfinal:Yfinal:Zfinal:Tfinal) in extended twisted Edwards coordinates
     f2elm_t t1, t2; 
           
+    COUNT_OP(eccadd);
     fp2mul1271(P->t2, Q->t2, R->z);        // Z = 2dT1*T2 
     fp2mul1271(P->z2, Q->z2, t1);          // t1 = 2Z1*Z2  
     fp2mul1271(P->xy, Q->xy, R->x);        // X = (X1+Y1)(X2+Y2) 
@@ -353,6 +542,7 @@ static __inline void eccmadd(point_precomp_t Q, point_extproj_t P)
   //         corresponding to (Xfinal:Yfinal:Zfinal:Tfinal) in extended twisted Edwards coordinates
     f2elm_t t1, t2;
     
+    COUNT_OP(eccmadd);
     fp2mul1271(P->ta, P->tb, P->ta);        // Ta = T1
     fp2add1271(P->z, P->z, t1);             // t1 = 2Z1        
     fp2mul1271(P->ta, Q->t2, P->ta);        // Ta = 2dT1*t2 
@@ -380,18 +570,78 @@ void eccmadd_ni(point_precomp_t Q, point_extproj_t P)
 }
 
 
-bool ecc_mul_fixed(digit_t* k, point_t Q)
-{ // Fixed-base scalar multiplication Q = k*G, where G is the generator. FIXED_BASE_TABLE stores v*2^(w-1) = 80 multiples of G.
+void ecc_static_tables(const uint64_t** Tables, size_t* Sizes)
+{ // Static precomputed tables, copied by ecc_tables_place()
+    Tables[TABLE_FIXED_BASE] = FIXED_BASE_TABLE;
+    Sizes[TABLE_FIXED_BASE] = sizeof(FIXED_BASE_TABLE);
+#if (USE_ENDO == true)
+    Tables[TABLE_DOUBLE_SCALAR] = DOUBLE_SCALAR_TABLE;
+    Sizes[TABLE_DOUBLE_SCALAR] = sizeof(DOUBLE_SCALAR_TABLE);
+#else
+    Tables[TABLE_DOUBLE_SCALAR] = NULL;
+    Sizes[TABLE_DOUBLE_SCALAR] = 0;
+#endif
+}
+
+
+#if (USE_ENDO == true)
+static __inline point_table_t* double_scalar_table(void)
+{ // DOUBLE_SCALAR_TABLE, or its copy on the local NUMA node if the tables were placed with ecc_tables_place()
+    const uint64_t* table = ecc_placed_table(TABLE_DOUBLE_SCALAR);
+
+    return (point_table_t*)((table != NULL) ? table : DOUBLE_SCALAR_TABLE);
+}
+#endif
+
+
+static __inline point_table_t* fixed_base_table(void)
+{ // FIXED_BASE_TABLE, or its copy on the local NUMA node if the tables were placed with ecc_tables_place()
+    const uint64_t* table = ecc_placed_table(TABLE_FIXED_BASE);
+
+    return (point_table_t*)((table != NULL) ? table : FIXED_BASE_TABLE);
+}
+
+
+void ecc_fixed_base_points(point_precomp_t* T)
+{ // Expansion of FIXED_BASE_TABLE to NPOINTS_FIXEDBASE points in representation (x+y,y-x,2dt), for the batch engine of eccp2_x8.c
+  // Output: T[i] = i-th point of the table, i = 0,...,NPOINTS_FIXEDBASE-1
+    point_table_t* table = fixed_base_table();
+    unsigned int i;
+
+    for (i = 0; i < NPOINTS_FIXEDBASE; i++) {
+        fp2copy1271(table[i]->xy, T[i]->xy);
+        fp2copy1271(table[i]->yx, T[i]->yx);
+#if defined(COMPACT_TABLES)
+        eccprecomp_t2(T[i]);                                    // 2dt is recomputed from x+y and y-x
+#else
+        fp2copy1271(table[i]->t2, T[i]->t2);
+#endif
+    }
+}
+
+
+#if defined(SCA_PROTECTION)
+static void ecc_mul_fixed_comb(digit_t* k, point_extproj_t R, sca_state* state, felm_t* masks)
+#else
+static void ecc_mul_fixed_comb(digit_t* k, point_extproj_t R)
+#endif
+{ // Fixed-base scalar multiplication R = k*G without normalization, where G is the generator. FIXED_BASE_TABLE stores v*2^(w-1) = 80 multiples of G.
   // Inputs: scalar "k" in [0, 2^256-1].
-  // Output: Q = k*G in affine coordinates (x,y).
+  // Output: R = k*G = (X,Y,Z,Ta,Tb), where T = Ta*Tb, corresponding to (X:Y:Z:T) in extended twisted Edwards coordinates.
   // The function is based on the modified LSB-set comb method, which converts the scalar to an odd signed representation
   // with (bitlength(order)+w*v) digits.
+  // With SCA_PROTECTION and a non-NULL state, the computation is executed as R = (k*G + 2^(e-1)*R') - 2^(e-1)*R' with the blinding point R'
+  // of the state, and the coordinates of the accumulator are randomized after the first lookup and at every doubling with the SCA_MASKS_FIXEDBASE masks.
     unsigned int j, w = W_FIXEDBASE, v = V_FIXEDBASE, d = D_FIXEDBASE, e = E_FIXEDBASE;
     unsigned int digit = 0, digits[NBITS_ORDER_PLUS_ONE+(W_FIXEDBASE*V_FIXEDBASE)-1] = {0}; 
+    point_table_t* table = fixed_base_table();
     digit_t temp[NWORDS_ORDER];
-    point_extproj_t R;
     point_precomp_t S;
+    point_extproj_t T;
     int i, ii;
+#if defined(SCA_PROTECTION)
+    point_extproj_precomp_t U;
+#endif
 
 	modulo_order(k, temp);                                      // temp = k mod (order) 
 	conversion_to_odd(temp, temp);                              // Converting scalar to odd using the prime subgroup order
@@ -404,8 +654,15 @@ bool ecc_mul_fixed(digit_t* k, point_t Q)
         digit = 2*digit + digits[i];
     }
     // Initialize R = (x+y,y-x,2dt) with a point from the table
-	table_lookup_fixed_base(((point_precomp_t*)&FIXED_BASE_TABLE)+(v-1)*(1 << (w-1)), S, digit, digits[d-1]);
-    R5_to_R1(S, R);                                             // Converting to representation (X:Y:1:Ta:Tb)
+	table_lookup_fixed_base(table+(v-1)*(1 << (w-1)), S, digit, digits[d-1]);
+    R5_to_R1(S, T);                                             // Converting to representation (X:Y:1:Ta:Tb)
+#if defined(SCA_PROTECTION)
+    if (state != NULL) {
+        R1_to_R2(state->blind_fixed, U);
+        eccadd(U, T);                                           // R = R+R' with the blinding point R'
+        ecc_randomize(T, masks[0]);                             // Randomization of R's coordinates
+    }
+#endif
 
     for (j = 0; j < (v-1); j++)
     {
@@ -415,13 +672,21 @@ bool ecc_mul_fixed(digit_t* k, point_t Q)
             digit = 2*digit + digits[i];
         }
         // Extract point in (x+y,y-x,2dt) representation
-        table_lookup_fixed_base(((point_precomp_t*)&FIXED_BASE_TABLE)+(v-j-2)*(1 << (w-1)), S, digit, digits[d-(j+1)*e-1]);
-        eccmadd(S, R);                                          // R = R+S using representations (X,Y,Z,Ta,Tb) <- (X,Y,Z,Ta,Tb) + (x+y,y-x,2dt) 
+        table_lookup_fixed_base(table+(v-j-2)*(1 << (w-1)), S, digit, digits[d-(j+1)*e-1]);
+        eccmadd(S, T);                                          // R = R+S using representations (X,Y,Z,Ta,Tb) <- (X,Y,Z,Ta,Tb) + (x+y,y-x,2dt) 
     }
 
     for (ii = (e-2); ii >= 0; ii--)
     {
-        eccdouble(R);                                           // R = 2*R using representations (X,Y,Z,Ta,Tb) <- 2*(X,Y,Z)
+#if defined(SCA_PROTECTION)
+        if (state != NULL) {
+            eccdouble_randomized(T, masks[ii+1]);               // R = 2*R with randomization of R's coordinates
+        } else {
+            eccdouble(T);
+        }
+#else
+        eccdouble(T);                                           // R = 2*R using representations (X,Y,Z,Ta,Tb) <- 2*(X,Y,Z)
+#endif
         for (j = 0; j < v; j++)
         {
             digit = digits[w*d-j*e+ii-e];
@@ -430,16 +695,182 @@ bool ecc_mul_fixed(digit_t* k, point_t Q)
                 digit = 2*digit + digits[i];
             }
             // Extract point in (x+y,y-x,2dt) representation
-            table_lookup_fixed_base(((point_precomp_t*)&FIXED_BASE_TABLE)+(v-j-1)*(1 << (w-1)), S, digit, digits[d-j*e+ii-e]);
-            eccmadd(S, R);                                      // R = R+S using representations (X,Y,Z,Ta,Tb) <- (X,Y,Z,Ta,Tb) + (x+y,y-x,2dt)
+            table_lookup_fixed_base(table+(v-j-1)*(1 << (w-1)), S, digit, digits[d-j*e+ii-e]);
+            eccmadd(S, T);                                      // R = R+S using representations (X,Y,Z,Ta,Tb) <- (X,Y,Z,Ta,Tb) + (x+y,y-x,2dt)
         }        
     }     
-    eccnorm(R, Q);                                              // Conversion to affine coordinates (x,y) and modular correction. 
+#if defined(SCA_PROTECTION)
+    if (state != NULL) {
+        R1_to_R2(state->unblind_fixed, U);
+        eccadd(U, T);                                           // R = R-2^(e-1)*R'
+    }
+#endif
+    ecccopy(T, R);
     
 #ifdef TEMP_ZEROING
+    clear_words((void*)temp, NWORDS_ORDER*(sizeof(digit_t)/sizeof(unsigned int)));
     clear_words((void*)digits, NBITS_ORDER_PLUS_ONE+(W_FIXEDBASE*V_FIXEDBASE)-1);
     clear_words((void*)S, sizeof(point_precomp_t)/sizeof(unsigned int));
+    clear_words((void*)T, sizeof(point_extproj_t)/sizeof(unsigned int));
+#endif
+}
+
+
+#if defined(SCA_PROTECTION)
+
+static THREAD_LOCAL sca_state sca_thread_state;                 // Zero-initialized, which triggers a refresh on the first use
+
+
+static void eccneg_ct(point_extproj_t P, digit_t bit)
+{ // Constant-time conditional point negation: P = -P = (-X,Y,Z,-Ta,Tb) if bit = 1, and P is unchanged if bit = 0
+    digit_t mask = 0 - bit;
+    f2elm_t x, ta;
+    unsigned int i;
+
+    fp2copy1271(P->x, x);
+    fp2copy1271(P->ta, ta);
+    fp2neg1271(x);
+    fp2neg1271(ta);
+    for (i = 0; i < 2*NWORDS_FIELD; i++) {
+        ((digit_t*)P->x)[i] ^= (((digit_t*)P->x)[i] ^ ((digit_t*)x)[i]) & mask;
+        ((digit_t*)P->ta)[i] ^= (((digit_t*)P->ta)[i] ^ ((digit_t*)ta)[i]) & mask;
+    }
+}
+
+
+static void ecctriple(point_extproj_t P)
+{ // Point tripling 3P using representations (X,Y,Z,Ta,Tb) <- 2*(X,Y,Z) + (X+Y,Y-X,2Z,2dT)
+    point_extproj_precomp_t Q;
+
+    R1_to_R2(P, Q);
+    eccdouble(P);
+    eccadd(Q, P);
+}
+
+
+static bool sca_refresh(sca_state* state)
+{ // Draws new blinding points R = r*G and R' = r'*G for random r and r', and computes -2^(NDIGITS_VARBASE-1)*R and -2^(e-1)*R'
+  // Returns false if the random number generator fails, in which case the state is left to be refreshed on the next use
+    digit_t r[2*NWORDS_ORDER];
+    point_extproj_t P;
+    unsigned int i;
+
+    if (RandomBytesFunction((unsigned char*)r, sizeof(r)) != ECCRYPTO_SUCCESS) {
+        return false;
+    }
+
+    ecc_mul_fixed_comb(r, P, NULL, NULL);                       // R = r*G
+    ecccopy(P, state->blind_var);
+    for (i = 0; i < NDIGITS_VARBASE-1; i++) {
+        eccdouble(P);
+    }
+    eccneg_ct(P, 1);
+    ecccopy(P, state->unblind_var);
+
+    ecc_mul_fixed_comb(r + NWORDS_ORDER, P, NULL, NULL);        // R' = r'*G
+    ecccopy(P, state->blind_fixed);
+    for (i = 0; i < E_FIXEDBASE-1; i++) {
+        eccdouble(P);
+    }
+    eccneg_ct(P, 1);
+    ecccopy(P, state->unblind_fixed);
+    state->uses = 0;
+
+    clear_words((void*)r, 2*NWORDS_ORDER*(sizeof(digit_t)/sizeof(unsigned int)));
+    clear_words((void*)P, sizeof(point_extproj_t)/sizeof(unsigned int));
+    return true;
+}
+
+
+sca_state* sca_get_state(void)
+{ // Countermeasure state of the calling thread. The blinding points are redrawn every SCA_REFRESH_INTERVAL uses; in between, they are
+  // updated after every use with sca_next_blinding(). Returns NULL if the random number generator fails
+    sca_state* state = &sca_thread_state;
+
+    if (state->uses == 0 && sca_refresh(state) == false) {
+        return NULL;
+    }
+    state->uses = (state->uses + 1) % SCA_REFRESH_INTERVAL;
+    return state;
+}
+
+
+bool sca_draw_masks(felm_t* masks, unsigned int nmasks, digit_t* bit)
+{ // Draws "nmasks" fresh GF(p) masks with a single call to the random number generator. Each mask is even and in [2, 2^127-2], so it is
+  // nonzero modulo p and is not 1. The top bit of the first random value, which is cleared in the mask, is returned in "bit"
+  // Returns false if the random number generator fails
+    unsigned int i;
+
+    if (RandomBytesFunction((unsigned char*)masks, nmasks*sizeof(felm_t)) != ECCRYPTO_SUCCESS) {
+        return false;
+    }
+    *bit = masks[0][NWORDS_FIELD-1] >> (RADIX-1);
+    for (i = 0; i < nmasks; i++) {
+        masks[i][0] = (masks[i][0] | 2) & ~(digit_t)1;
+        masks[i][NWORDS_FIELD-1] &= (digit_t)(-1) >> 1;
+    }
+    return true;
+}
+
+
+static void sca_next_blinding(point_extproj_t R, point_extproj_t U, digit_t bit)
+{ // Update of a blinding point R and its correction U = -2^n*R to ((-1)^bit*3)*R and ((-1)^bit*3)*U, as in ecc_mul_SCA_secure() of FourQ_ARM_side_channel
+    ecctriple(R);
+    ecctriple(U);
+    eccneg_ct(R, bit);
+    eccneg_ct(U, bit);
+}
+
+
+void sca_next_blinding_var(sca_state* state, digit_t bit)
+{ // Update of the blinding point R of ecc_mul_prepared() and its correction -2^(NDIGITS_VARBASE-1)*R
+    sca_next_blinding(state->blind_var, state->unblind_var, bit);
+}
+
+
+bool ecc_mul_fixed_ext(digit_t* k, point_extproj_t R)
+{ // Fixed-base scalar multiplication R = k*G without normalization, protected with point blinding and coordinate randomization
+  // Inputs: scalar "k" in [0, 2^256-1].
+  // Output: R = k*G = (X,Y,Z,Ta,Tb), where T = Ta*Tb, corresponding to (X:Y:Z:T) in extended twisted Edwards coordinates.
+  // Returns false, without computing R, if the random number generator fails.
+    sca_state* state = sca_get_state();
+    felm_t masks[SCA_MASKS_FIXEDBASE];
+    digit_t bit;
+
+    if (state == NULL || sca_draw_masks(masks, SCA_MASKS_FIXEDBASE, &bit) == false) {
+        return false;
+    }
+    ecc_mul_fixed_comb(k, R, state, masks);
+    sca_next_blinding(state->blind_fixed, state->unblind_fixed, bit);
+
+    clear_words((void*)masks, SCA_MASKS_FIXEDBASE*(sizeof(felm_t)/sizeof(unsigned int)));
+    return true;
+}
+
+#else
+
+bool ecc_mul_fixed_ext(digit_t* k, point_extproj_t R)
+{ // Fixed-base scalar multiplication R = k*G without normalization
+  // Inputs: scalar "k" in [0, 2^256-1].
+  // Output: R = k*G = (X,Y,Z,Ta,Tb), where T = Ta*Tb, corresponding to (X:Y:Z:T) in extended twisted Edwards coordinates.
+    ecc_mul_fixed_comb(k, R);
+    return true;
+}
+
 #endif
+
+
+bool ecc_mul_fixed(digit_t* k, point_t Q)
+{ // Fixed-base scalar multiplication Q = k*G, where G is the generator
+  // Inputs: scalar "k" in [0, 2^256-1].
+  // Output: Q = k*G in affine coordinates (x,y).
+  // Returns false if the side-channel countermeasures (SCA_PROTECTION) cannot draw random values.
+    point_extproj_t R;
+
+    if (ecc_mul_fixed_ext(k, R) == false) {
+        return false;
+    }
+    eccnorm(R, Q);                                              // Conversion to affine coordinates (x,y) and modular correction. 
     return true;
 }
 
@@ -521,6 +952,36 @@ static __inline void eccneg_precomp(point_precomp_t P, point_precomp_t Q)
 }
 
 
+static __inline void eccmadd_table(point_table_t Q, point_extproj_t P)
+{ // Mixed point addition P = P+Q with a point Q from DOUBLE_SCALAR_TABLE
+#if defined(COMPACT_TABLES)
+    point_precomp_t V;
+
+    fp2copy1271(Q->xy, V->xy);
+    fp2copy1271(Q->yx, V->yx);
+    eccprecomp_t2(V);
+    eccmadd(V, P);
+#else
+    eccmadd(Q, P);
+#endif
+}
+
+
+static __inline void eccmsub_table(point_table_t Q, point_extproj_t P)
+{ // Mixed point subtraction P = P-Q with a point Q from DOUBLE_SCALAR_TABLE
+    point_precomp_t V;
+
+#if defined(COMPACT_TABLES)
+    fp2copy1271(Q->xy, V->yx);                 // V = -Q = (y-x,x+y,-2dt)
+    fp2copy1271(Q->yx, V->xy);
+    eccprecomp_t2(V);
+#else
+    eccneg_precomp(Q, V);
+#endif
+    eccmadd(V, P);
+}
+
+
 bool ecc_mul_double(digit_t* k, point_t Q, digit_t* l, point_t R)
 { // Double scalar multiplication R = k*G + l*Q, where the G is the generator. Uses DOUBLE_SCALAR_TABLE, which contains multiples of G, Phi(G), Psi(G) and Phi(Psi(G)).
   // Inputs: point Q in affine coordinates,
@@ -534,14 +995,15 @@ bool ecc_mul_double(digit_t* k, point_t Q, digit_t* l, point_t R)
     unsigned int position;
     int i, digits_k1[65] = {0}, digits_k2[65] = {0}, digits_k3[65] = {0}, digits_k4[65] = {0};
     int digits_l1[65] = {0}, digits_l2[65] = {0}, digits_l3[65] = {0}, digits_l4[65] = {0};
-	point_precomp_t V;
     point_extproj_t Q1, Q2, Q3, Q4, T; 
     point_extproj_precomp_t U, Q_table1[NPOINTS_DOUBLEMUL_WQ], Q_table2[NPOINTS_DOUBLEMUL_WQ], Q_table3[NPOINTS_DOUBLEMUL_WQ], Q_table4[NPOINTS_DOUBLEMUL_WQ];
+    point_table_t* table = double_scalar_table();
     uint64_t k_scalars[4], l_scalars[4];
     
     point_setup(Q, Q1);                                        // Convert to representation (X,Y,1,Ta,Tb)
     
     if (ecc_point_validate(Q1) == false) {                     // Check if point lies on the curve
+        METRICS_EVENT(METRICS_INVALID_POINT);
         return false;
     }
     
@@ -610,35 +1072,31 @@ bool ecc_mul_double(digit_t* k, point_t Q, digit_t* l, point_t R)
 
         if (digits_k1[i] < 0) {
             position = (-digits_k1[i])/2;                      
-            eccneg_precomp(((point_precomp_t*)&DOUBLE_SCALAR_TABLE)[position], V);    // Load and negate V = (X_V,Y_V,Z_V,Td_V) <- -(x+y,y-x,2dt) from a point in the precomputed table 
-            eccmadd(V, T);                                                            // T = T+V = (X_T,Y_T,Z_T,Ta_T,Tb_T) = (X_T,Y_T,Z_T,Ta_T,Tb_T) + (X_V,Y_V,Z_V,Td_V) 
+            eccmsub_table(table[position], T);                                        // T = T-V, where V = (x+y,y-x,2dt) is a point in the precomputed table 
         } else if (digits_k1[i] > 0) {            
             position = (digits_k1[i])/2;                                              // Take V = (X_V,Y_V,Z_V,Td_V) <- (x+y,y-x,2dt) from a point in the precomputed table
-            eccmadd(((point_precomp_t*)&DOUBLE_SCALAR_TABLE)[position], T);           // T = T+V = (X_T,Y_T,Z_T,Ta_T,Tb_T) = (X_T,Y_T,Z_T,Ta_T,Tb_T) + (X_V,Y_V,Z_V,Td_V) 
+            eccmadd_table(table[position], T);                                        // T = T+V = (X_T,Y_T,Z_T,Ta_T,Tb_T) = (X_T,Y_T,Z_T,Ta_T,Tb_T) + (X_V,Y_V,Z_V,Td_V) 
         }
         if (digits_k2[i] < 0) {
             position = (-digits_k2[i])/2;                      
-            eccneg_precomp(((point_precomp_t*)&DOUBLE_SCALAR_TABLE)[NPOINTS_DOUBLEMUL_WP+position], V);
-            eccmadd(V, T);                              
+            eccmsub_table(table[NPOINTS_DOUBLEMUL_WP+position], T);
         } else if (digits_k2[i] > 0) {            
             position = (digits_k2[i])/2;                       
-            eccmadd(((point_precomp_t*)&DOUBLE_SCALAR_TABLE)[NPOINTS_DOUBLEMUL_WP+position], T);
+            eccmadd_table(table[NPOINTS_DOUBLEMUL_WP+position], T);
         }
         if (digits_k3[i] < 0) {
             position = (-digits_k3[i])/2;                      
-            eccneg_precomp(((point_precomp_t*)&DOUBLE_SCALAR_TABLE)[2*NPOINTS_DOUBLEMUL_WP+position], V);
-            eccmadd(V, T);                              
+            eccmsub_table(table[2*NPOINTS_DOUBLEMUL_WP+position], T);
         } else if (digits_k3[i] > 0) {            
             position = (digits_k3[i])/2;                       
-            eccmadd(((point_precomp_t*)&DOUBLE_SCALAR_TABLE)[2*NPOINTS_DOUBLEMUL_WP+position], T);
+            eccmadd_table(table[2*NPOINTS_DOUBLEMUL_WP+position], T);
         }
         if (digits_k4[i] < 0) {
             position = (-digits_k4[i])/2;                      
-            eccneg_precomp(((point_precomp_t*)&DOUBLE_SCALAR_TABLE)[3*NPOINTS_DOUBLEMUL_WP+position], V);
-            eccmadd(V, T);                              
+            eccmsub_table(table[3*NPOINTS_DOUBLEMUL_WP+position], T);
         } else if (digits_k4[i] > 0) {            
             position = (digits_k4[i])/2;                       
-            eccmadd(((point_precomp_t*)&DOUBLE_SCALAR_TABLE)[3*NPOINTS_DOUBLEMUL_WP+position], T);
+            eccmadd_table(table[3*NPOINTS_DOUBLEMUL_WP+position], T);
         }
     }
 
@@ -653,7 +1111,9 @@ bool ecc_mul_double(digit_t* k, point_t Q, digit_t* l, point_t R)
     point_setup(A, T);
     R1_to_R2(T, S);
 
-    ecc_mul_fixed(k, A);
+    if (ecc_mul_fixed(k, A) == false) {
+        return false;
+    }
     point_setup(A, T);
     eccadd(S, T);
 #endif
@@ -0,0 +1,174 @@
+/**********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: projective point arithmetic API
+*
+* Points are kept in extended twisted Edwards coordinates (X:Y:Z:Ta:Tb), with
+* T = Ta*Tb, so that sequences of additions, doublings and scalar multiplications
+* only pay for a normalization when the caller asks for an affine point or an
+* encoding.
+***********************************************************************************/
+
+#include "FourQ_internal.h"
+#include "FourQ_params.h"
+
+
+void ecc_point_neutral(point_extproj_t P)
+{ // Set P to the neutral point (0:1:1:0:1)
+
+    fp2zero1271(P->x);
+    fp2zero1271(P->y); P->y[0][0] = 1;
+    fp2zero1271(P->z); P->z[0][0] = 1;
+    fp2zero1271(P->ta);
+    fp2zero1271(P->tb); P->tb[0][0] = 1;
+}
+
+
+void ecc_point_generator(point_extproj_t P)
+{ // Set P to the generator G = (x:y:1:x:y)
+    point_t G;
+
+    eccset(G);
+    point_setup(G, P);
+}
+
+
+bool ecc_point_from_affine(point_t P, point_extproj_t Q)
+{ // Conversion of an affine point P = (x,y) to Q = (x:y:1:x:y)
+  // Returns false if P is not on the curve. P is not checked to lie in the prime-order subgroup
+
+    point_setup(P, Q);
+    return ecc_point_validate(Q);
+}
+
+
+ECCRYPTO_STATUS ecc_point_decode(const unsigned char* Pencoded, point_extproj_t P)
+{ // Decode a 32-byte encoding to P in extended coordinates
+  // P is on the curve, but is not checked to lie in the prime-order subgroup
+  // SECURITY NOTE: this function does not run in constant time.
+    point_t A;
+    ECCRYPTO_STATUS Status;
+
+    Status = decode(Pencoded, A);
+    if (Status == ECCRYPTO_SUCCESS) {
+        point_setup(A, P);
+    }
+    return Status;
+}
+
+
+void ecc_point_to_affine(point_extproj_t P, point_t Q)
+{ // Normalization Q = (X/Z,Y/Z). P is not modified
+    point_extproj_t R;
+
+    ecccopy(P, R);
+    eccnorm(R, Q);
+}
+
+
+void ecc_point_encode(point_extproj_t P, unsigned char* Pencoded)
+{ // Normalization and 32-byte encoding of P. P is not modified
+    point_t A;
+
+    ecc_point_to_affine(P, A);
+    encode(A, Pencoded);
+}
+
+
+void ecc_point_add(point_extproj_t P, point_extproj_t Q, point_extproj_t R)
+{ // Complete point addition R = P+Q. R may alias P or Q
+    point_extproj_precomp_t S;
+
+    R1_to_R2(Q, S);                      // Converting from (X,Y,Z,Ta,Tb) to (X+Y,Y-X,2Z,2dT)
+    ecccopy(P, R);
+    eccadd(S, R);                        // R = R+S using representations (X,Y,Z,Ta,Tb) <- (X,Y,Z,Ta,Tb) + (X+Y,Y-X,2Z,2dT)
+}
+
+
+void ecc_point_double(point_extproj_t P, point_extproj_t R)
+{ // Point doubling R = 2*P. R may alias P
+
+    ecccopy(P, R);
+    eccdouble(R);
+}
+
+
+void ecc_point_neg(point_extproj_t P, point_extproj_t R)
+{ // Point negation R = -P = (-X:Y:Z:-Ta:Tb). R may alias P
+
+    ecccopy(P, R);
+    fp2neg1271(R->x);
+    fp2neg1271(R->ta);
+}
+
+
+bool ecc_point_equals(point_extproj_t P, point_extproj_t Q)
+{ // Constant-time point comparison, returns true if P = Q, i.e., X1*Z2 = X2*Z1 and Y1*Z2 = Y2*Z1
+    f2elm_t t0, t1;
+    unsigned int equal;
+
+    fp2mul1271(P->x, Q->z, t0);
+    fp2mul1271(Q->x, P->z, t1);
+    fp2sub1271(t0, t1, t0);
+    mod1271(t0[0]); mod1271(t0[1]);
+    equal = (unsigned int)is_zero_ct((digit_t*)t0, 2*NWORDS_FIELD);
+    fp2mul1271(P->y, Q->z, t0);
+    fp2mul1271(Q->y, P->z, t1);
+    fp2sub1271(t0, t1, t0);
+    mod1271(t0[0]); mod1271(t0[1]);
+    equal &= (unsigned int)is_zero_ct((digit_t*)t0, 2*NWORDS_FIELD);
+
+    return (equal == 1);
+}
+
+
+void ecc_point_clear_cofactor(point_extproj_t P, point_extproj_t Q)
+{ // Co-factor clearing Q = 392*P, which maps any point on the curve to the prime-order subgroup. Q may alias P
+
+    ecccopy(P, Q);
+    cofactor_clearing(Q);
+}
+
+
+bool ecc_point_in_subgroup(point_extproj_t P)
+{ // Returns true if P lies in the prime-order subgroup, i.e., if N*P is the neutral point, where N is the order of the subgroup
+  // P must be on the curve. The cofactor 392 is coprime to N, so N*P is not neutral for any other point on the curve
+  // SECURITY NOTE: this function does not run in constant time. It is meant for public points, e.g., decoded public keys
+    point_extproj_precomp_t S;
+    point_extproj_t R, O;
+    int i;
+
+    R1_to_R2(P, S);                      // Converting from (X,Y,Z,Ta,Tb) to (X+Y,Y-X,2Z,2dT)
+    ecc_point_neutral(R);
+    for (i = 255; i >= 0; i--) {         // Left-to-right double-and-add over the bits of N, using the complete formulas
+        eccdouble(R);
+        if (((curve_order[i/64] >> (i%64)) & 1) == 1) {
+            eccadd(S, R);
+        }
+    }
+    ecc_point_neutral(O);
+    return ecc_point_equals(R, O);
+}
+
+
+bool ecc_point_mul(point_extproj_t P, digit_t* k, point_extproj_t Q)
+{ // Variable-base scalar multiplication Q = k*P without normalization
+  // Inputs: scalar "k" in [0, 2^256-1] and point P in the prime-order subgroup. Q may alias P
+  // Returns false if the side-channel countermeasures (SCA_PROTECTION) cannot draw random values
+    unsigned int digits[NDIGITS_VARBASE] = {0}, sign_masks[NDIGITS_VARBASE] = {0};
+    bool valid;
+
+    valid = ecc_mul_prepare(k, digits, sign_masks);
+    if (valid == true) {
+        ecccopy(P, Q);
+        valid = ecc_mul_prepared(Q, digits, sign_masks);
+    }
+
+#ifdef TEMP_ZEROING
+    clear_words((void*)digits, NDIGITS_VARBASE);
+    clear_words((void*)sign_masks, NDIGITS_VARBASE);
+#endif
+    return valid;
+}
@@ -107,6 +107,52 @@ void cofactor_clearing(point_extproj_t P)
 }
 
 
+bool ecc_mul_prepare(digit_t* k, unsigned int* digits, unsigned int* sign_masks)
+{ // Scalar preparation for the variable-base scalar multiplication: reduction, conversion to odd and fixed window recoding
+  // Input:   scalar "k" in [0, 2^256-1]
+  // Outputs: digits and sign_masks, NDIGITS_VARBASE entries each, to be used by ecc_mul_prepared()
+    digit_t k_odd[NWORDS_ORDER];
+
+    modulo_order(k, k_odd);                                    // k_odd = k mod (order)      
+    conversion_to_odd(k_odd, k_odd);                           // Converting scalar to odd using the prime subgroup order 
+    fixed_window_recode((uint64_t*)k_odd, digits, sign_masks); // Scalar recoding
+    
+#ifdef TEMP_ZEROING
+    clear_words((void*)k_odd, NWORDS_ORDER*(sizeof(digit_t)/sizeof(unsigned int)));
+#endif
+    return true;
+}
+
+
+bool ecc_mul_prepared(point_extproj_t P, unsigned int* digits, unsigned int* sign_masks)
+{ // Scalar multiplication P = k*P using a scalar k prepared with ecc_mul_prepare()
+  // Input:  P = (X1,Y1,Z1,Ta,Tb), where T1 = Ta*Tb, corresponding to (X1:Y1:Z1:T1) in extended twisted Edwards coordinates
+  // Output: P = k*P = (Xfinal,Yfinal,Zfinal,Tafinal,Tbfinal), where Tfinal = Tafinal*Tbfinal
+  // This function does not perform point validation or cofactor clearing.
+    point_extproj_precomp_t S, Table[NPOINTS_VARBASE];
+    int i;
+
+    ecc_precomp(P, Table);                                     // Precomputation of points T[0],...,T[npoints-1] 
+    table_lookup_1x8(Table, S, digits[t_VARBASE], sign_masks[t_VARBASE]);       
+    R2_to_R4(S, P);                                            // Conversion to representation (2X,2Y,2Z)
+    
+    for (i = (t_VARBASE-1); i >= 0; i--)
+    {
+        eccdouble(P);
+        table_lookup_1x8(Table, S, digits[i], sign_masks[i]);  // Extract point in (X+Y,Y-X,2Z,2dT) representation
+        eccdouble(P);
+        eccdouble(P);
+        eccdouble(P);                                          // P = 2*P using representations (X,Y,Z,Ta,Tb) <- 2*(X,Y,Z)
+        eccadd(S, P);                                          // P = P+S using representations (X,Y,Z,Ta,Tb) <- (X,Y,Z,Ta,Tb) + (X+Y,Y-X,2Z,2dT)
+    }
+    
+#ifdef TEMP_ZEROING
+    clear_words((void*)S, sizeof(point_extproj_precomp_t)/sizeof(unsigned int));
+#endif
+    return true;
+}
+
+
 bool ecc_mul(point_t P, digit_t* k, point_t Q, bool clear_cofactor)
 { // Scalar multiplication Q = k*P
   // Inputs: scalar "k" in [0, 2^256-1],
@@ -115,14 +161,12 @@ bool ecc_mul(point_t P, digit_t* k, point_t Q, bool clear_cofactor)
   // Output: Q = k*P in affine coordinates (x,y).
   // This function performs point validation and (if selected) cofactor clearing.
     point_extproj_t R;
-    point_extproj_precomp_t S, Table[NPOINTS_VARBASE];
-    unsigned int digits[t_VARBASE+1] = {0}, sign_masks[t_VARBASE+1] = {0};
-    digit_t k_odd[NWORDS_ORDER];
-    int i;
+    unsigned int digits[NDIGITS_VARBASE] = {0}, sign_masks[NDIGITS_VARBASE] = {0};
 
     point_setup(P, R);                                         // Convert to representation (X,Y,1,Ta,Tb)
 
     if (ecc_point_validate(R) == false) {                      // Check if point lies on the curve
+        METRICS_EVENT(METRICS_INVALID_POINT);
         return false;
     }
 
@@ -130,29 +174,13 @@ bool ecc_mul(point_t P, digit_t* k, point_t Q, bool clear_cofactor)
         cofactor_clearing(R);
     }
 
-    modulo_order(k, k_odd);                                    // k_odd = k mod (order)      
-    conversion_to_odd(k_odd, k_odd);                           // Converting scalar to odd using the prime subgroup order 
-    ecc_precomp(R, Table);                                     // Precomputation of points T[0],...,T[npoints-1] 
-    fixed_window_recode((uint64_t*)k_odd, digits, sign_masks); // Scalar recoding
-    table_lookup_1x8(Table, S, digits[t_VARBASE], sign_masks[t_VARBASE]);       
-    R2_to_R4(S, R);                                            // Conversion to representation (2X,2Y,2Z)
-    
-    for (i = (t_VARBASE-1); i >= 0; i--)
-    {
-        eccdouble(R);
-        table_lookup_1x8(Table, S, digits[i], sign_masks[i]);  // Extract point in (X+Y,Y-X,2Z,2dT) representation
-        eccdouble(R);
-        eccdouble(R);
-        eccdouble(R);                                          // P = 2*P using representations (X,Y,Z,Ta,Tb) <- 2*(X,Y,Z)
-        eccadd(S, R);                                          // P = P+S using representations (X,Y,Z,Ta,Tb) <- (X,Y,Z,Ta,Tb) + (X+Y,Y-X,2Z,2dT)
-    }
+    ecc_mul_prepare(k, digits, sign_masks);
+    ecc_mul_prepared(R, digits, sign_masks);
     eccnorm(R, Q);                                             // Convert to affine coordinates (x,y) 
     
 #ifdef TEMP_ZEROING
-    clear_words((void*)k_odd, NWORDS_ORDER*(sizeof(digit_t)/sizeof(unsigned int)));
-    clear_words((void*)digits, t_VARBASE+1);
-    clear_words((void*)sign_masks, t_VARBASE+1);
-    clear_words((void*)S, sizeof(point_extproj_precomp_t)/sizeof(unsigned int));
+    clear_words((void*)digits, NDIGITS_VARBASE);
+    clear_words((void*)sign_masks, NDIGITS_VARBASE);
 #endif
     return true;
 }
@@ -0,0 +1,720 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: eight-lane engine for batches of scalar multiplications
+*
+* Every lane computes one scalar multiplication. GF(p) elements are split into three
+* limbs of 52, 52 and 23 bits (radix 2^52), so that all products are computed with the
+* 52-bit multiply-accumulate instructions VPMADD52LUQ/VPMADD52HUQ of AVX-512 IFMA.
+* This file is compiled twice: with _IFMA_LANES_ a lane vector is a 512-bit register,
+* otherwise the same instructions are emulated with portable 64-bit arithmetic. Both
+* versions compute exactly the same limbs.
+************************************************************************************/
+
+#include "FourQ_internal.h"
+#if defined(_IFMA_LANES_)
+    #include <immintrin.h>
+#endif
+
+
+#define MASK23    (uint64_t)0x7FFFFF
+#define MASK26    (uint64_t)0x3FFFFFF
+#define MASK52    (uint64_t)0xFFFFFFFFFFFFF
+#define MASK63    (uint64_t)0x7FFFFFFFFFFFFFFF
+
+
+/******************** Lane primitives ********************/
+
+#if defined(_IFMA_LANES_)
+
+typedef __m512i v8_t;                                     // X8_LANES 64-bit words
+
+#define v8_set1(x)            _mm512_set1_epi64((long long)(x))
+#define v8_load(a)            _mm512_loadu_si512((const void*)(a))
+#define v8_store(c, a)        _mm512_storeu_si512((void*)(c), a)
+#define v8_add(a, b)          _mm512_add_epi64(a, b)
+#define v8_sub(a, b)          _mm512_sub_epi64(a, b)
+#define v8_and(a, b)          _mm512_and_si512(a, b)
+#define v8_srli(a, n)         _mm512_srli_epi64(a, n)
+#define v8_slli(a, n)         _mm512_slli_epi64(a, n)
+#define v8_madd52lo(c, a, b)  _mm512_madd52lo_epu64(c, a, b)                 // c + (a*b mod 2^52), using the low 52 bits of a and b
+#define v8_madd52hi(c, a, b)  _mm512_madd52hi_epu64(c, a, b)                 // c + (a*b >> 52), using the low 52 bits of a and b
+#define v8_select(m, x, y)    _mm512_ternarylogic_epi64(m, x, y, 0xCA)       // (m & x) | (~m & y)
+#define v8_eqmask(a, b)       _mm512_maskz_set1_epi64(_mm512_cmpeq_epi64_mask(a, b), -1)
+
+#define X8_NAME(name)         name##_ifma
+
+#else
+
+typedef struct { uint64_t w[X8_LANES]; } v8_t;            // X8_LANES 64-bit words
+
+static __inline v8_t v8_set1(uint64_t x)
+{
+    v8_t c;
+    unsigned int j;
+
+    for (j = 0; j < X8_LANES; j++) c.w[j] = x;
+    return c;
+}
+
+static __inline v8_t v8_load(const uint64_t* a)
+{
+    v8_t c;
+    unsigned int j;
+
+    for (j = 0; j < X8_LANES; j++) c.w[j] = a[j];
+    return c;
+}
+
+static __inline void v8_store(uint64_t* c, v8_t a)
+{
+    unsigned int j;
+
+    for (j = 0; j < X8_LANES; j++) c[j] = a.w[j];
+}
+
+static __inline v8_t v8_add(v8_t a, v8_t b)
+{
+    unsigned int j;
+
+    for (j = 0; j < X8_LANES; j++) a.w[j] += b.w[j];
+    return a;
+}
+
+static __inline v8_t v8_sub(v8_t a, v8_t b)
+{
+    unsigned int j;
+
+    for (j = 0; j < X8_LANES; j++) a.w[j] -= b.w[j];
+    return a;
+}
+
+static __inline v8_t v8_and(v8_t a, v8_t b)
+{
+    unsigned int j;
+
+    for (j = 0; j < X8_LANES; j++) a.w[j] &= b.w[j];
+    return a;
+}
+
+static __inline v8_t v8_srli(v8_t a, unsigned int n)
+{
+    unsigned int j;
+
+    for (j = 0; j < X8_LANES; j++) a.w[j] >>= n;
+    return a;
+}
+
+static __inline v8_t v8_slli(v8_t a, unsigned int n)
+{
+    unsigned int j;
+
+    for (j = 0; j < X8_LANES; j++) a.w[j] <<= n;
+    return a;
+}
+
+static __inline void mul52(uint64_t a, uint64_t b, uint64_t* lo, uint64_t* hi)
+{ // 52x52-bit product (hi:lo) = a*b split at bit 52, using 26-bit halves of the low 52 bits of a and b
+    uint64_t al = a & MASK26, ah = (a >> 26) & MASK26, bl = b & MASK26, bh = (b >> 26) & MASK26;
+    uint64_t mid = al*bh + ah*bl, t = al*bl + ((mid & MASK26) << 26);
+
+    *lo = t & MASK52;
+    *hi = ah*bh + (mid >> 26) + (t >> 52);
+}
+
+static __inline v8_t v8_madd52lo(v8_t c, v8_t a, v8_t b)
+{ // Emulation of VPMADD52LUQ, c + (a*b mod 2^52)
+    uint64_t lo, hi;
+    unsigned int j;
+
+    for (j = 0; j < X8_LANES; j++) {
+        mul52(a.w[j], b.w[j], &lo, &hi);
+        c.w[j] += lo;
+    }
+    return c;
+}
+
+static __inline v8_t v8_madd52hi(v8_t c, v8_t a, v8_t b)
+{ // Emulation of VPMADD52HUQ, c + (a*b >> 52)
+    uint64_t lo, hi;
+    unsigned int j;
+
+    for (j = 0; j < X8_LANES; j++) {
+        mul52(a.w[j], b.w[j], &lo, &hi);
+        c.w[j] += hi;
+    }
+    return c;
+}
+
+static __inline v8_t v8_select(v8_t m, v8_t x, v8_t y)
+{ // (m & x) | (~m & y)
+    unsigned int j;
+
+    for (j = 0; j < X8_LANES; j++) y.w[j] = (m.w[j] & (x.w[j] ^ y.w[j])) ^ y.w[j];
+    return y;
+}
+
+static __inline v8_t v8_eqmask(v8_t a, v8_t b)
+{ // 0xFF...FF in the lanes where a = b, 0 otherwise
+    uint64_t x;
+    unsigned int j;
+
+    for (j = 0; j < X8_LANES; j++) {
+        x = a.w[j] ^ b.w[j];
+        a.w[j] = ((x | (0-x)) >> 63) - 1;
+    }
+    return a;
+}
+
+#define X8_NAME(name)         name##_emu
+
+#endif
+
+
+/******************** Field arithmetic in radix 2^52 ********************/
+// Limbs are kept below 2^52, 2^52 and 2^24, respectively. Values are not reduced modulo p until the conversion back to radix 2^64.
+
+typedef v8_t felm_x8_t[3];                                // GF(p) element of every lane
+typedef felm_x8_t f2elm_x8_t[2];                          // GF(p^2) element of every lane
+
+typedef struct { f2elm_x8_t x; f2elm_x8_t y; f2elm_x8_t z; f2elm_x8_t ta; f2elm_x8_t tb; } point_extproj_x8;   // (X:Y:Z:Ta:Tb) of every lane
+typedef struct { f2elm_x8_t xy; f2elm_x8_t yx; f2elm_x8_t z2; f2elm_x8_t t2; } point_extproj_precomp_x8;      // (X+Y,Y-X,2Z,2dT) of every lane
+typedef struct { f2elm_x8_t xy; f2elm_x8_t yx; f2elm_x8_t t2; } point_precomp_x8;                             // (x+y,y-x,2dt) of every lane
+
+
+static __inline void fpnorm_x8(v8_t r0, v8_t r1, v8_t r2, felm_x8_t c)
+{ // Carry propagation c = r0 + r1*2^52 + r2*2^104 mod p, folding the bits above 2^127 with 2^127 = 1 mod p
+
+    r0 = v8_add(r0, v8_srli(r2, 23));
+    r2 = v8_and(r2, v8_set1(MASK23));
+    r1 = v8_add(r1, v8_srli(r0, 52));
+    c[0] = v8_and(r0, v8_set1(MASK52));
+    c[2] = v8_add(r2, v8_srli(r1, 52));
+    c[1] = v8_and(r1, v8_set1(MASK52));
+}
+
+
+static __inline void fpadd_x8(felm_x8_t a, felm_x8_t b, felm_x8_t c)
+{ // Field addition, c = a+b mod p
+
+    fpnorm_x8(v8_add(a[0], b[0]), v8_add(a[1], b[1]), v8_add(a[2], b[2]), c);
+}
+
+
+static __inline void fpsub_x8(felm_x8_t a, felm_x8_t b, felm_x8_t c)
+{ // Field subtraction, c = a+4p-b mod p. The limbs of 4p are larger than those of b
+
+    fpnorm_x8(v8_add(a[0], v8_sub(v8_set1(4*MASK52), b[0])),
+              v8_add(a[1], v8_sub(v8_set1(4*MASK52), b[1])),
+              v8_add(a[2], v8_sub(v8_set1(4*MASK23), b[2])), c);
+}
+
+
+static __inline void fpneg_x8(felm_x8_t a, felm_x8_t c)
+{ // Field negation, c = 4p-a mod p
+
+    fpnorm_x8(v8_sub(v8_set1(4*MASK52), a[0]), v8_sub(v8_set1(4*MASK52), a[1]), v8_sub(v8_set1(4*MASK23), a[2]), c);
+}
+
+
+static __inline void fpmul_cols_x8(felm_x8_t a, felm_x8_t b, v8_t* z)
+{ // Accumulation of the columns of a*b at 2^0, 2^52, ..., 2^208 in z[0],...,z[4]
+  // The high half of a[2]*b[2] is zero, since both limbs are below 2^24
+
+    z[0] = v8_madd52lo(z[0], a[0], b[0]);
+    z[1] = v8_madd52hi(z[1], a[0], b[0]);
+    z[1] = v8_madd52lo(z[1], a[0], b[1]);
+    z[1] = v8_madd52lo(z[1], a[1], b[0]);
+    z[2] = v8_madd52hi(z[2], a[0], b[1]);
+    z[2] = v8_madd52hi(z[2], a[1], b[0]);
+    z[2] = v8_madd52lo(z[2], a[0], b[2]);
+    z[2] = v8_madd52lo(z[2], a[1], b[1]);
+    z[2] = v8_madd52lo(z[2], a[2], b[0]);
+    z[3] = v8_madd52hi(z[3], a[0], b[2]);
+    z[3] = v8_madd52hi(z[3], a[1], b[1]);
+    z[3] = v8_madd52hi(z[3], a[2], b[0]);
+    z[3] = v8_madd52lo(z[3], a[1], b[2]);
+    z[3] = v8_madd52lo(z[3], a[2], b[1]);
+    z[4] = v8_madd52hi(z[4], a[1], b[2]);
+    z[4] = v8_madd52hi(z[4], a[2], b[1]);
+    z[4] = v8_madd52lo(z[4], a[2], b[2]);
+}
+
+
+static __inline void fpreduce_x8(v8_t* z, felm_x8_t c)
+{ // Reduction of the columns z[0],...,z[4] (each below 2^56) modulo p, c = z mod p
+  // 2^156 = 2^29 and 2^208 = 2^81 mod p, so columns 3 and 4 are split at bit 23 and folded into columns 0 to 2
+    v8_t m23 = v8_set1(MASK23);
+
+    fpnorm_x8(v8_add(v8_add(z[0], v8_slli(v8_and(z[3], m23), 29)), v8_srli(z[2], 23)),
+              v8_add(v8_add(z[1], v8_srli(z[3], 23)), v8_slli(v8_and(z[4], m23), 29)),
+              v8_add(v8_and(z[2], m23), v8_srli(z[4], 23)), c);
+}
+
+
+static __inline void fpmul_x8(felm_x8_t a, felm_x8_t b, felm_x8_t c)
+{ // Field multiplication, c = a*b mod p, with 17 multiply-accumulate instructions
+    v8_t z[5];
+
+    z[0] = z[1] = z[2] = z[3] = z[4] = v8_set1(0);
+    fpmul_cols_x8(a, b, z);
+    fpreduce_x8(z, c);
+}
+
+
+static __inline void fpsqr_x8(felm_x8_t a, felm_x8_t c)
+{ // Field squaring, c = a^2 mod p, with 11 multiply-accumulate instructions
+  // The cross products are accumulated first and doubled with a shift, since 2*a[i] may not fit in 52 bits
+    v8_t z[5];
+
+    z[0] = z[1] = z[2] = z[3] = z[4] = v8_set1(0);
+    z[1] = v8_madd52lo(z[1], a[0], a[1]);
+    z[2] = v8_madd52hi(z[2], a[0], a[1]);
+    z[2] = v8_madd52lo(z[2], a[0], a[2]);
+    z[3] = v8_madd52hi(z[3], a[0], a[2]);
+    z[3] = v8_madd52lo(z[3], a[1], a[2]);
+    z[4] = v8_madd52hi(z[4], a[1], a[2]);
+    z[1] = v8_slli(z[1], 1);
+    z[2] = v8_slli(z[2], 1);
+    z[3] = v8_slli(z[3], 1);
+    z[4] = v8_slli(z[4], 1);
+    z[0] = v8_madd52lo(z[0], a[0], a[0]);
+    z[1] = v8_madd52hi(z[1], a[0], a[0]);
+    z[2] = v8_madd52lo(z[2], a[1], a[1]);
+    z[3] = v8_madd52hi(z[3], a[1], a[1]);
+    z[4] = v8_madd52lo(z[4], a[2], a[2]);
+    fpreduce_x8(z, c);
+}
+
+
+static __inline void fp2copy_x8(f2elm_x8_t a, f2elm_x8_t c)
+{ // Copy of a GF(p^2) element, c = a
+    unsigned int i;
+
+    for (i = 0; i < 3; i++) {
+        c[0][i] = a[0][i];
+        c[1][i] = a[1][i];
+    }
+}
+
+
+static __inline void fp2add_x8(f2elm_x8_t a, f2elm_x8_t b, f2elm_x8_t c)
+{ // GF(p^2) addition, c = a+b in GF((2^127-1)^2)
+
+    fpadd_x8(a[0], b[0], c[0]);
+    fpadd_x8(a[1], b[1], c[1]);
+}
+
+
+static __inline void fp2sub_x8(f2elm_x8_t a, f2elm_x8_t b, f2elm_x8_t c)
+{ // GF(p^2) subtraction, c = a-b in GF((2^127-1)^2)
+
+    fpsub_x8(a[0], b[0], c[0]);
+    fpsub_x8(a[1], b[1], c[1]);
+}
+
+
+static __inline void fp2addsub_x8(f2elm_x8_t a, f2elm_x8_t b, f2elm_x8_t c)
+{ // GF(p^2) addition followed by subtraction, c = 2a-b in GF((2^127-1)^2)
+    f2elm_x8_t t;
+
+    fp2add_x8(a, a, t);
+    fp2sub_x8(t, b, c);
+}
+
+
+static __inline void fp2mul_x8(f2elm_x8_t a, f2elm_x8_t b, f2elm_x8_t c)
+{ // GF(p^2) multiplication, c = a*b in GF((2^127-1)^2)
+  // The schoolbook products are reduced once per coordinate: c0 = a0*b0 + a1*(-b1), c1 = a0*b1 + a1*b0
+    felm_x8_t t;
+    v8_t z0[5], z1[5];
+    unsigned int i;
+
+    fpneg_x8(b[1], t);
+    for (i = 0; i < 5; i++) {
+        z0[i] = z1[i] = v8_set1(0);
+    }
+    fpmul_cols_x8(a[0], b[0], z0);
+    fpmul_cols_x8(a[1], t, z0);
+    fpmul_cols_x8(a[0], b[1], z1);
+    fpmul_cols_x8(a[1], b[0], z1);
+    fpreduce_x8(z0, c[0]);
+    fpreduce_x8(z1, c[1]);
+}
+
+
+static __inline void fp2sqr_x8(f2elm_x8_t a, f2elm_x8_t c)
+{ // GF(p^2) squaring, c = a^2 in GF((2^127-1)^2), as c0 = (a0+a1)(a0-a1) and c1 = 2a0*a1
+    felm_x8_t t1, t2, t3;
+
+    fpadd_x8(a[0], a[1], t1);
+    fpsub_x8(a[0], a[1], t2);
+    fpmul_x8(a[0], a[1], t3);
+    fpmul_x8(t1, t2, c[0]);
+    fpadd_x8(t3, t3, c[1]);
+}
+
+
+/******************** Conversions ********************/
+
+static __inline uint64_t lt64_ct(uint64_t x, uint64_t y)
+{ // Constant-time comparison, returns 1 if x < y and 0 otherwise
+    return (x ^ ((x ^ y) | ((x - y) ^ y))) >> 63;
+}
+
+
+static void fp_to_limbs(const uint64_t* a, uint64_t* c)
+{ // Conversion of a 128-bit value to three limbs of 52, 52 and 24 bits
+
+    c[0] = a[0] & MASK52;
+    c[1] = ((a[0] >> 52) | (a[1] << 12)) & MASK52;
+    c[2] = a[1] >> 40;
+}
+
+
+static void fp_from_limbs(const uint64_t* a, uint64_t* c)
+{ // Conversion of three limbs to a value in [0, 2^127-1], c = a mod p
+    uint64_t w0, w1, t;
+    unsigned int i;
+
+    w0 = a[0] | (a[1] << 52);
+    w1 = (a[1] >> 12) | (a[2] << 40);
+    for (i = 0; i < 2; i++) {                       // The input is below 2^128, so two folds of bit 127 suffice
+        t = w1 >> 63;
+        w1 &= MASK63;
+        w0 += t;
+        w1 += lt64_ct(w0, t);
+    }
+    c[0] = w0;
+    c[1] = w1;
+}
+
+
+static void fp2_to_x8(const uint64_t* a, unsigned int stride, f2elm_x8_t c)
+{ // Conversion of the GF(p^2) elements at a + j*stride, j = 0,...,X8_LANES-1, to radix 2^52. The stride is given in 64-bit words
+    uint64_t limbs[6][X8_LANES], t[3];
+    unsigned int i, j;
+
+    for (j = 0; j < X8_LANES; j++) {
+        for (i = 0; i < 2; i++) {
+            fp_to_limbs(a + j*stride + 2*i, t);
+            limbs[3*i][j] = t[0];
+            limbs[3*i+1][j] = t[1];
+            limbs[3*i+2][j] = t[2];
+        }
+    }
+    for (i = 0; i < 3; i++) {
+        c[0][i] = v8_load(limbs[i]);
+        c[1][i] = v8_load(limbs[3+i]);
+    }
+}
+
+
+static void fp2_from_x8(f2elm_x8_t a, uint64_t* c, unsigned int stride)
+{ // Conversion of a GF(p^2) element of every lane to radix 2^64, stored at c + j*stride, j = 0,...,X8_LANES-1
+    uint64_t limbs[6][X8_LANES], t[3];
+    unsigned int i, j;
+
+    for (i = 0; i < 3; i++) {
+        v8_store(limbs[i], a[0][i]);
+        v8_store(limbs[3+i], a[1][i]);
+    }
+    for (j = 0; j < X8_LANES; j++) {
+        for (i = 0; i < 2; i++) {
+            t[0] = limbs[3*i][j];
+            t[1] = limbs[3*i+1][j];
+            t[2] = limbs[3*i+2][j];
+            fp_from_limbs(t, c + j*stride + 2*i);
+        }
+    }
+}
+
+
+static void point_from_x8(point_extproj_x8* P, point_extproj* R)
+{ // Conversion of the point (X:Y:Z:Ta:Tb) of every lane j to R[j]
+    unsigned int stride = sizeof(point_extproj)/sizeof(uint64_t);
+
+    fp2_from_x8(P->x, (uint64_t*)R[0].x, stride);
+    fp2_from_x8(P->y, (uint64_t*)R[0].y, stride);
+    fp2_from_x8(P->z, (uint64_t*)R[0].z, stride);
+    fp2_from_x8(P->ta, (uint64_t*)R[0].ta, stride);
+    fp2_from_x8(P->tb, (uint64_t*)R[0].tb, stride);
+}
+
+
+/******************** Point arithmetic ********************/
+// The following functions compute the same formulas as their scalar counterparts in eccp2_core.c
+
+static void eccdouble_x8(point_extproj_x8* P)
+{ // Point doubling 2P
+    f2elm_x8_t t1, t2;
+
+    fp2sqr_x8(P->x, t1);                   // t1 = X1^2
+    fp2sqr_x8(P->y, t2);                   // t2 = Y1^2
+    fp2add_x8(P->x, P->y, P->x);           // t3 = X1+Y1
+    fp2add_x8(t1, t2, P->tb);              // Tbfinal = X1^2+Y1^2
+    fp2sub_x8(t2, t1, t1);                 // t1 = Y1^2-X1^2
+    fp2sqr_x8(P->x, P->ta);                // Ta = (X1+Y1)^2
+    fp2sqr_x8(P->z, t2);                   // t2 = Z1^2
+    fp2sub_x8(P->ta, P->tb, P->ta);        // Tafinal = 2X1*Y1 = (X1+Y1)^2-(X1^2+Y1^2)
+    fp2addsub_x8(t2, t1, t2);              // t2 = 2Z1^2-(Y1^2-X1^2)
+    fp2mul_x8(t1, P->tb, P->y);            // Yfinal = (X1^2+Y1^2)(Y1^2-X1^2)
+    fp2mul_x8(t2, P->ta, P->x);            // Xfinal = 2X1*Y1*[2Z1^2-(Y1^2-X1^2)]
+    fp2mul_x8(t1, t2, P->z);               // Zfinal = (Y1^2-X1^2)[2Z1^2-(Y1^2-X1^2)]
+}
+
+
+static void eccadd_x8(point_extproj_precomp_x8* Q, point_extproj_x8* P)
+{ // Complete point addition P = P+Q or P = P+P, with Q = (X2+Y2,Y2-X2,2Z2,2dT2)
+    point_extproj_precomp_x8 R;
+    f2elm_x8_t t1, t2;
+
+    fp2add_x8(P->x, P->y, R.xy);           // R = (X1+Y1,Y1-X1,Z1,T1)
+    fp2sub_x8(P->y, P->x, R.yx);
+    fp2mul_x8(P->ta, P->tb, R.t2);
+    fp2copy_x8(P->z, R.z2);
+
+    fp2mul_x8(Q->t2, R.t2, P->z);          // Z = 2dT1*T2
+    fp2mul_x8(Q->z2, R.z2, t1);            // t1 = 2Z1*Z2
+    fp2mul_x8(Q->xy, R.xy, P->x);          // X = (X1+Y1)(X2+Y2)
+    fp2mul_x8(Q->yx, R.yx, P->y);          // Y = (Y1-X1)(Y2-X2)
+    fp2sub_x8(t1, P->z, t2);               // t2 = theta
+    fp2add_x8(t1, P->z, t1);               // t1 = alpha
+    fp2sub_x8(P->x, P->y, P->tb);          // Tbfinal = beta
+    fp2add_x8(P->x, P->y, P->ta);          // Tafinal = omega
+    fp2mul_x8(P->tb, t2, P->x);            // Xfinal = beta*theta
+    fp2mul_x8(t1, t2, P->z);               // Zfinal = theta*alpha
+    fp2mul_x8(P->ta, t1, P->y);            // Yfinal = alpha*omega
+}
+
+
+static void eccmadd_x8(point_precomp_x8* Q, point_extproj_x8* P)
+{ // Mixed point addition P = P+Q or P = P+P, with Q = (x2+y2,y2-x2,2dt2)
+    f2elm_x8_t t1, t2;
+
+    fp2mul_x8(P->ta, P->tb, P->ta);        // Ta = T1
+    fp2add_x8(P->z, P->z, t1);             // t1 = 2Z1
+    fp2mul_x8(P->ta, Q->t2, P->ta);        // Ta = 2dT1*t2
+    fp2add_x8(P->x, P->y, P->z);           // Z = (X1+Y1)
+    fp2sub_x8(P->y, P->x, P->tb);          // Tb = (Y1-X1)
+    fp2sub_x8(t1, P->ta, t2);              // t2 = theta
+    fp2add_x8(t1, P->ta, t1);              // t1 = alpha
+    fp2mul_x8(Q->xy, P->z, P->ta);         // Ta = (X1+Y1)(x2+y2)
+    fp2mul_x8(Q->yx, P->tb, P->x);         // X = (Y1-X1)(y2-x2)
+    fp2mul_x8(t1, t2, P->z);               // Zfinal = theta*alpha
+    fp2sub_x8(P->ta, P->x, P->tb);         // Tbfinal = beta
+    fp2add_x8(P->ta, P->x, P->ta);         // Tafinal = omega
+    fp2mul_x8(P->tb, t2, P->x);            // Xfinal = beta*theta
+    fp2mul_x8(P->ta, t1, P->y);            // Yfinal = alpha*omega
+}
+
+
+static void R5_to_R1_x8(point_precomp_x8* P, point_extproj_x8* Q)
+{ // Conversion from representation (x+y,y-x,2dt) to (X,Y,Z,Ta,Tb) = (x,y,1,x,y)
+  // The halving is a multiplication by 2^126 = 1/2 mod p
+    felm_x8_t half;
+
+    half[0] = half[1] = v8_set1(0);
+    half[2] = v8_set1((uint64_t)1 << 22);
+    fp2sub_x8(P->xy, P->yx, Q->x);         // 2*x1
+    fp2add_x8(P->xy, P->yx, Q->y);         // 2*y1
+    fpmul_x8(Q->x[0], half, Q->x[0]);      // XQ = x1
+    fpmul_x8(Q->x[1], half, Q->x[1]);
+    fpmul_x8(Q->y[0], half, Q->y[0]);      // YQ = y1
+    fpmul_x8(Q->y[1], half, Q->y[1]);
+    Q->z[0][0] = v8_set1(1);               // ZQ = 1
+    Q->z[0][1] = Q->z[0][2] = v8_set1(0);
+    Q->z[1][0] = Q->z[1][1] = Q->z[1][2] = v8_set1(0);
+    fp2copy_x8(Q->x, Q->ta);               // TaQ = x1
+    fp2copy_x8(Q->y, Q->tb);               // TbQ = y1
+}
+
+
+static void R2_to_R4_x8(point_extproj_precomp_x8* P, point_extproj_x8* Q)
+{ // Conversion from representation (X+Y,Y-X,2Z,2dT) to (2X,2Y,2Z)
+
+    fp2sub_x8(P->xy, P->yx, Q->x);         // XQ = 2*X1
+    fp2add_x8(P->xy, P->yx, Q->y);         // YQ = 2*Y1
+    fp2copy_x8(P->z2, Q->z);               // ZQ = 2*Z1
+}
+
+
+/******************** Table lookups ********************/
+
+#define LIMBS_PRECOMP_X8    18                            // Number of limbs of a point (x+y,y-x,2dt)
+#define LIMBS_EXTPROJ_X8    24                            // Number of limbs of a point (X+Y,Y-X,2Z,2dT)
+
+
+static void table_lookup_fixed_base_x8(uint64_t* table, v8_t digit, v8_t sign, point_precomp_x8* P)
+{ // Constant-time lookup of P_j = table[digit_j] if sign_j = 0, or P_j = -table[digit_j] if sign_j = 0xFF...FF, for every lane j
+  // The table contains VPOINTS_FIXEDBASE points (x+y,y-x,2dt) of LIMBS_PRECOMP_X8 limbs, shared by all lanes
+    v8_t mask, *p = (v8_t*)P, t2[LIMBS_PRECOMP_X8/3];
+    unsigned int i, k;
+
+    for (k = 0; k < LIMBS_PRECOMP_X8; k++) {
+        p[k] = v8_set1(table[k]);
+    }
+    for (i = 1; i < VPOINTS_FIXEDBASE; i++) {
+        mask = v8_eqmask(digit, v8_set1(i));
+        for (k = 0; k < LIMBS_PRECOMP_X8; k++) {
+            p[k] = v8_select(mask, v8_set1(table[LIMBS_PRECOMP_X8*i+k]), p[k]);
+        }
+    }
+
+    fpneg_x8(P->t2[0], t2);                                         // -P = (y-x,x+y,-2dt)
+    fpneg_x8(P->t2[1], t2+3);
+    for (k = 0; k < LIMBS_PRECOMP_X8/3; k++) {
+        mask = p[k];
+        p[k] = v8_select(sign, p[LIMBS_PRECOMP_X8/3+k], mask);
+        p[LIMBS_PRECOMP_X8/3+k] = v8_select(sign, mask, p[LIMBS_PRECOMP_X8/3+k]);
+        p[2*LIMBS_PRECOMP_X8/3+k] = v8_select(sign, t2[k], p[2*LIMBS_PRECOMP_X8/3+k]);
+    }
+}
+
+
+static void table_lookup_1x8_x8(point_extproj_precomp_x8* table, v8_t digit, v8_t sign_mask, point_extproj_precomp_x8* P)
+{ // Constant-time lookup of P_j = table[digit_j] if sign_mask_j = 0xFF...FF, or P_j = -table[digit_j] if sign_mask_j = 0, for every lane j
+  // Each lane has its own table of 8 points (X+Y,Y-X,2Z,2dT)
+    v8_t mask, *p = (v8_t*)P, t2[LIMBS_EXTPROJ_X8/4];
+    unsigned int i, k;
+
+    for (k = 0; k < LIMBS_EXTPROJ_X8; k++) {
+        p[k] = ((v8_t*)&table[0])[k];
+    }
+    for (i = 1; i < 8; i++) {
+        mask = v8_eqmask(digit, v8_set1(i));
+        for (k = 0; k < LIMBS_EXTPROJ_X8; k++) {
+            p[k] = v8_select(mask, ((v8_t*)&table[i])[k], p[k]);
+        }
+    }
+
+    fpneg_x8(P->t2[0], t2);                                         // -P = (Y-X,X+Y,2Z,-2dT)
+    fpneg_x8(P->t2[1], t2+3);
+    for (k = 0; k < LIMBS_EXTPROJ_X8/4; k++) {
+        mask = p[k];
+        p[k] = v8_select(sign_mask, mask, p[LIMBS_EXTPROJ_X8/4+k]);
+        p[LIMBS_EXTPROJ_X8/4+k] = v8_select(sign_mask, p[LIMBS_EXTPROJ_X8/4+k], mask);
+        p[3*LIMBS_EXTPROJ_X8/4+k] = v8_select(sign_mask, p[3*LIMBS_EXTPROJ_X8/4+k], t2[k]);
+    }
+}
+
+
+/******************** Scalar multiplications ********************/
+
+static void comb_digits_x8(unsigned int* digits, int offset, v8_t* digit, v8_t* sign)
+{ // Digit and sign of the fixed-base comb for every lane, at the given offset of the recoded scalars
+  // This is the computation of ecc_mul_fixed_ext(), whose first lookup corresponds to offset 0
+    unsigned int j, t, w = W_FIXEDBASE, d = D_FIXEDBASE, *k;
+    uint64_t dj[X8_LANES], sj[X8_LANES];
+    int i;
+
+    for (j = 0; j < X8_LANES; j++) {
+        k = digits + j*NDIGITS_FIXEDBASE;
+        t = k[(int)(w*d-1)+offset];
+        for (i = (int)((w-1)*d-1)+offset; i >= (int)(2*d-1)+offset; i = i-d)
+        {
+            t = 2*t + k[i];
+        }
+        dj[j] = t;
+        sj[j] = 0 - (uint64_t)(k[(int)(d-1)+offset] & 1);
+    }
+    *digit = v8_load(dj);
+    *sign = v8_load(sj);
+}
+
+
+void X8_NAME(ecc_mul_fixed_x8)(point_precomp_t* table, unsigned int* digits, point_extproj* R)
+{ // X8_LANES fixed-base scalar multiplications R[j] = k_j*G without normalization, where G is the generator
+  // Inputs: table with the NPOINTS_FIXEDBASE points of FIXED_BASE_TABLE in representation (x+y,y-x,2dt), see ecc_fixed_base_points(),
+  //         digits = X8_LANES rows of NDIGITS_FIXEDBASE digits, the mLSB-set representation of the odd scalars k_j mod (order).
+  // Output: R[j] = k_j*G = (X,Y,Z,Ta,Tb), where T = Ta*Tb, corresponding to (X:Y:Z:T) in extended twisted Edwards coordinates.
+  // The lookups, additions and doublings are those of ecc_mul_fixed_ext().
+    unsigned int j, w = W_FIXEDBASE, v = V_FIXEDBASE, e = E_FIXEDBASE;
+    uint64_t T[NPOINTS_FIXEDBASE*LIMBS_PRECOMP_X8];
+    v8_t digit, sign;
+    point_precomp_x8 S;
+    point_extproj_x8 P;
+    int ii;
+
+    for (j = 0; j < NPOINTS_FIXEDBASE; j++) {                       // Conversion of the table to radix 2^52
+        fp_to_limbs((uint64_t*)table[j]->xy[0], T + LIMBS_PRECOMP_X8*j);
+        fp_to_limbs((uint64_t*)table[j]->xy[1], T + LIMBS_PRECOMP_X8*j + 3);
+        fp_to_limbs((uint64_t*)table[j]->yx[0], T + LIMBS_PRECOMP_X8*j + 6);
+        fp_to_limbs((uint64_t*)table[j]->yx[1], T + LIMBS_PRECOMP_X8*j + 9);
+        fp_to_limbs((uint64_t*)table[j]->t2[0], T + LIMBS_PRECOMP_X8*j + 12);
+        fp_to_limbs((uint64_t*)table[j]->t2[1], T + LIMBS_PRECOMP_X8*j + 15);
+    }
+
+    comb_digits_x8(digits, 0, &digit, &sign);
+    table_lookup_fixed_base_x8(T + LIMBS_PRECOMP_X8*(v-1)*(1 << (w-1)), digit, sign, &S);
+    R5_to_R1_x8(&S, &P);
+
+    for (j = 0; j < (v-1); j++)
+    {
+        comb_digits_x8(digits, -(int)((j+1)*e), &digit, &sign);
+        table_lookup_fixed_base_x8(T + LIMBS_PRECOMP_X8*(v-j-2)*(1 << (w-1)), digit, sign, &S);
+        eccmadd_x8(&S, &P);
+    }
+
+    for (ii = (e-2); ii >= 0; ii--)
+    {
+        eccdouble_x8(&P);
+        for (j = 0; j < v; j++)
+        {
+            comb_digits_x8(digits, ii-(int)((j+1)*e)+1, &digit, &sign);
+            table_lookup_fixed_base_x8(T + LIMBS_PRECOMP_X8*(v-j-1)*(1 << (w-1)), digit, sign, &S);
+            eccmadd_x8(&S, &P);
+        }
+    }
+    point_from_x8(&P, R);
+
+#ifdef TEMP_ZEROING
+    clear_words((void*)&S, sizeof(point_precomp_x8)/sizeof(unsigned int));
+    clear_words((void*)&P, sizeof(point_extproj_x8)/sizeof(unsigned int));
+#endif
+}
+
+
+void X8_NAME(ecc_mul_table_x8)(point_extproj_precomp_t* tables, unsigned int* digits, unsigned int* sign_masks, point_extproj* R)
+{ // X8_LANES variable-base scalar multiplications R[j] = k_j*P_j without normalization
+  // Inputs: tables = X8_LANES rows of the 8 points computed by ecc_precomp() from P_j,
+  //         digits and sign_masks = X8_LANES rows of NDIGITS_VARBASE entries computed by ecc_mul_prepare() from k_j.
+  // Output: R[j] = k_j*P_j = (X,Y,Z,Ta,Tb), where T = Ta*Tb, corresponding to (X:Y:Z:T) in extended twisted Edwards coordinates.
+  // The lookups, additions and doublings are those of ecc_mul_prepared().
+    unsigned int i, j, stride = 8*sizeof(point_extproj_precomp)/sizeof(uint64_t);
+    uint64_t dj[X8_LANES], sj[X8_LANES];
+    point_extproj_precomp_x8 T[8], S;
+    point_extproj_x8 P;
+    int ii;
+
+    for (i = 0; i < 8; i++) {                                       // Conversion of the tables to radix 2^52
+        fp2_to_x8((uint64_t*)tables[i]->xy, stride, T[i].xy);
+        fp2_to_x8((uint64_t*)tables[i]->yx, stride, T[i].yx);
+        fp2_to_x8((uint64_t*)tables[i]->z2, stride, T[i].z2);
+        fp2_to_x8((uint64_t*)tables[i]->t2, stride, T[i].t2);
+    }
+
+    for (ii = NDIGITS_VARBASE-1; ii >= 0; ii--)
+    {
+        for (j = 0; j < X8_LANES; j++) {
+            dj[j] = digits[j*NDIGITS_VARBASE+ii];
+            sj[j] = 0 - (uint64_t)(sign_masks[j*NDIGITS_VARBASE+ii] & 1);
+        }
+        table_lookup_1x8_x8(T, v8_load(dj), v8_load(sj), &S);       // Extract point S in (X+Y,Y-X,2Z,2dT) representation
+        if (ii == NDIGITS_VARBASE-1) {
+            R2_to_R4_x8(&S, &P);                                    // Conversion to representation (2X,2Y,2Z)
+        } else {
+            eccdouble_x8(&P);                                       // P = 2*P using representations (X,Y,Z,Ta,Tb) <- 2*(X,Y,Z)
+            eccadd_x8(&S, &P);                                      // P = P+S using representations (X,Y,Z,Ta,Tb) <- (X,Y,Z,Ta,Tb) + (X+Y,Y-X,2Z,2dT)
+        }
+    }
+    point_from_x8(&P, R);
+
+#ifdef TEMP_ZEROING
+    clear_words((void*)T, sizeof(T)/sizeof(unsigned int));
+    clear_words((void*)&S, sizeof(point_extproj_precomp_x8)/sizeof(unsigned int));
+    clear_words((void*)&P, sizeof(point_extproj_x8)/sizeof(unsigned int));
+#endif
+}
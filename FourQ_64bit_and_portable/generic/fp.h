@@ -127,6 +127,7 @@ void fpmul1271(felm_t a, felm_t b, felm_t c)
     digit_t t[2*NWORDS_FIELD] = {0};
     unsigned int carry = 0;
     
+    COUNT_OP(fpmul);
     for (i = 0; i < NWORDS_FIELD; i++) {
          u = 0;
          for (j = 0; j < NWORDS_FIELD; j++) {
@@ -159,6 +160,7 @@ void fpmul1271(felm_t a, felm_t b, felm_t c)
 void fpsqr1271(felm_t a, felm_t c)
 { // Field squaring using schoolbook method, c = a^2 mod p  
     
+    COUNT_OP(fpsqr);
     fpmul1271(a, a, c);
 }
 
@@ -260,6 +262,7 @@ void fpinv1271(felm_t a)
   // Hardcoded for p = 2^127-1
     felm_t t;
 
+    COUNT_OP(fpinv);
     fpexp1251(a, t);    
     fpsqr1271(t, t);     
     fpsqr1271(t, t);                             
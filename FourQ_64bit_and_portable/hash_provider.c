@@ -0,0 +1,88 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: hash providers used by SchnorrQ
+************************************************************************************/
+
+#include "FourQ_internal.h"
+#include "../sha512/sha512.h"
+#include "../blake2b/blake2b.h"
+#if (OS_TARGET == OS_WIN)
+    #include <windows.h>
+#endif
+
+
+// The streaming states of the built-in providers must fit in hash_ctx_t
+typedef char sha512_state_size_check[(sizeof(crypto_sha512_state) <= sizeof(hash_ctx_t)) ? 1 : -1];
+typedef char blake2b_state_size_check[(sizeof(crypto_blake2b_state) <= sizeof(hash_ctx_t)) ? 1 : -1];
+
+
+static int sha512_init(hash_ctx_t* ctx)
+{
+    return crypto_sha512_init((crypto_sha512_state*)ctx);
+}
+
+
+static int sha512_update(hash_ctx_t* ctx, const unsigned char* in, unsigned long long inlen)
+{
+    return crypto_sha512_update((crypto_sha512_state*)ctx, in, inlen);
+}
+
+
+static int sha512_final(hash_ctx_t* ctx, unsigned char* out)
+{
+    return crypto_sha512_final((crypto_sha512_state*)ctx, out);
+}
+
+
+static int blake2b_init(hash_ctx_t* ctx)
+{
+    return crypto_blake2b_init((crypto_blake2b_state*)ctx);
+}
+
+
+static int blake2b_update(hash_ctx_t* ctx, const unsigned char* in, unsigned long long inlen)
+{
+    return crypto_blake2b_update((crypto_blake2b_state*)ctx, in, inlen);
+}
+
+
+static int blake2b_final(hash_ctx_t* ctx, unsigned char* out)
+{
+    return crypto_blake2b_final((crypto_blake2b_state*)ctx, out);
+}
+
+
+const hash_provider_t HashProviderSHA512  = { HASH_PROVIDER_SHA512, "SHA-512", crypto_sha512, sha512_init, sha512_update, sha512_final };
+const hash_provider_t HashProviderBLAKE2b = { HASH_PROVIDER_BLAKE2B, "BLAKE2b", crypto_blake2b, blake2b_init, blake2b_update, blake2b_final };
+
+static const hash_provider_t* hash_provider = &HashProviderSHA512;              // Read and written with ATOMIC_LOAD_PTR() and ATOMIC_STORE_PTR()
+
+
+ECCRYPTO_STATUS FourQ_SetHashProvider(const hash_provider_t* Provider)
+{ // Selection of the hash provider used by SchnorrQ
+  // Input: Provider, or NULL to restore the default (SHA-512)
+  // The IDs of the built-in providers are reserved to them: SchnorrQ omits the domain separator for HASH_PROVIDER_SHA512, and the
+  // cache of verified signatures tags its entries with the ID, so another provider with one of these IDs would pass for a built-in one.
+    if (Provider == NULL) {
+        ATOMIC_STORE_PTR(hash_provider, &HashProviderSHA512);
+        return ECCRYPTO_SUCCESS;
+    }
+    if (Provider->hash == NULL || Provider->init == NULL || Provider->update == NULL || Provider->final == NULL) {
+        return ECCRYPTO_ERROR_INVALID_PARAMETER;
+    }
+    if ((Provider->id == HASH_PROVIDER_SHA512 && Provider != &HashProviderSHA512) || (Provider->id == HASH_PROVIDER_BLAKE2B && Provider != &HashProviderBLAKE2b)) {
+        return ECCRYPTO_ERROR_INVALID_PARAMETER;
+    }
+
+    ATOMIC_STORE_PTR(hash_provider, Provider);
+    return ECCRYPTO_SUCCESS;
+}
+
+
+const hash_provider_t* FourQ_GetHashProvider(void)
+{ // Hash provider currently used by SchnorrQ
+    return (const hash_provider_t*)ATOMIC_LOAD_PTR(hash_provider);
+}
@@ -0,0 +1,367 @@
+/**********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: hashing to FourQ
+*
+* Messages are hashed to GF(p^2) with expand_message_xmd using SHA-512 and mapped
+* to the curve with a constant-time Elligator 2 map, following the hash_to_curve
+* construction of RFC 9380. The map is evaluated on the Montgomery curve
+* y^2 = x^3 + A*x^2 + B*x birationally equivalent to FourQ, where A = (d-1)/2 and
+* B = (1+d)^2/16, and the output is moved to the prime-order subgroup by cofactor
+* clearing.
+***********************************************************************************/
+
+#include "FourQ_internal.h"
+#include "FourQ_params.h"
+#include "../sha512/sha512.h"
+#include <stdlib.h>
+#include <string.h>
+
+
+#define HASH_BYTES        64     // Output length of the hash function used by expand_message_xmd
+#define HASH_BLOCK_BYTES  128    // Input block length of the hash function used by expand_message_xmd
+#define FIELD_BYTES       32     // Bytes per GF(p) element produced by hash_to_field, ceil((127+128)/8)
+#define MAX_DST_BYTES     255
+#define BATCH_POINTS      16     // Points normalized together by HashToCurveEvaluateBatch()
+
+// Non-square in GF(p^2) used by the Elligator 2 map, Z = 2+i
+static const uint64_t PARAMETER_Z[4] = { 0x0000000000000002, 0x0000000000000000, 0x0000000000000001, 0x0000000000000000 };
+
+
+static __inline void fp2select(f2elm_t a, f2elm_t b, f2elm_t c, digit_t mask)
+{ // Constant-time selection, c = a if mask = 0, c = b if mask = all ones
+    unsigned int i;
+    digit_t *pa = (digit_t*)a, *pb = (digit_t*)b, *pc = (digit_t*)c;
+
+    for (i = 0; i < 2*NWORDS_FIELD; i++) {
+        pc[i] = pa[i] ^ (mask & (pa[i] ^ pb[i]));
+    }
+}
+
+
+static __inline unsigned int fp2sgn0(f2elm_t a)
+{ // Sign of a GF(p^2) element as defined by sgn0() in RFC 9380
+  // Input: a in [0, 2^127-1]^2
+    unsigned int sign0 = (unsigned int)(a[0][0] & 1), sign1 = (unsigned int)(a[1][0] & 1);
+
+    return sign0 | ((unsigned int)is_zero_ct(a[0], NWORDS_FIELD) & sign1);
+}
+
+
+unsigned int fp2issquare1271(f2elm_t a)
+{ // Constant-time quadratic residuosity test over GF((2^127-1)^2)
+  // Returns 1 if a is a square (including a = 0), 0 otherwise. a is a square iff its norm a0^2+a1^2 is a square in GF(p).
+    felm_t n, r, one = {0};
+
+    one[0] = 1;
+    fpsqr1271(a[0], n);
+    fpsqr1271(a[1], r);
+    fpadd1271(n, r, n);                             // n = a0^2+a1^2
+    fpexp1251(n, r);
+    fpsqr1271(r, r);
+    fpmul1271(n, r, r);                             // r = n^(2^126-1) = n^((p-1)/2), i.e., 1, 0 or -1
+    fpadd1271(r, one, r);
+    mod1271(r);
+
+    return 1 ^ (unsigned int)is_zero_ct(r, NWORDS_FIELD);
+}
+
+
+void fp2sqrt1271(f2elm_t a, f2elm_t c)
+{ // Constant-time square root over GF((2^127-1)^2), c = sqrt(a)
+  // Input: a square a. The output is undefined if a is not a square.
+  // Output: c such that c^2 = a
+    felm_t n, t, t0, t1, r;
+    digit_t mask;
+    unsigned int i;
+
+    fpsqr1271(a[0], t0);
+    fpsqr1271(a[1], t1);
+    fpadd1271(t0, t1, n);                           // n = a0^2+a1^2
+    for (i = 0; i < 125; i++) {                     // n = n^(2^125) = sqrt(a0^2+a1^2)
+        fpsqr1271(n, n);
+    }
+
+    fpadd1271(a[0], n, t);                          // t = a0+n
+    fpsub1271(a[0], n, t0);                         // t0 = a0-n
+    mod1271(t);
+    mask = 0 - (digit_t)is_zero_ct(t, NWORDS_FIELD);
+    for (i = 0; i < NWORDS_FIELD; i++) {            // If t = 0 then t = a0-n
+        t[i] ^= mask & (t[i] ^ t0[i]);
+    }
+    fpadd1271(t, t, t);                             // t = 2*t
+    fpexp1251(t, r);                                // r = t^(2^125-1)
+    fpmul1271(t, r, t0);                            // t0 = t*r, sqrt(t) or sqrt(-t)
+    fpmul1271(a[1], r, t1);                         // t1 = a1*r
+    fpsqr1271(t0, r);
+    fpsub1271(t, r, r);
+    mod1271(r);
+    fpdiv1271(t0);                                  // t0 = t0/2
+    mod1271(t0); mod1271(t1);
+    fpcopy1271(t0, n);
+    fpneg1271(n);
+    mod1271(n);                                     // n = -t0
+
+    mask = 0 - (digit_t)(1 ^ is_zero_ct(r, NWORDS_FIELD));
+    for (i = 0; i < NWORDS_FIELD; i++) {            // If t0^2 != t then c = t1 - t0*i, otherwise c = t0 + t1*i
+        c[0][i] = t0[i] ^ (mask & (t0[i] ^ t1[i]));
+        c[1][i] = t1[i] ^ (mask & (t1[i] ^ n[i]));
+    }
+}
+
+
+void ecc_map_to_curve(f2elm_t u, point_extproj_t P)
+{ // Constant-time Elligator 2 map from GF(p^2) to FourQ
+  // Input:  field element u
+  // Output: P = (X,Y,Z,Ta,Tb), where T = Ta*Tb, corresponding to (X:Y:Z:T) in extended twisted Edwards coordinates.
+  //         P is not in the prime-order subgroup, cofactor clearing is required.
+    f2elm_t A, B, c, x1, x2, gx1, gx2, x, y, t0, t1, one = {0};
+    digit_t mask;
+
+    one[0][0] = 1;
+    fp2add1271((felm_t*)&PARAMETER_d, one, c);       // c = 1+d
+    fp2sub1271((felm_t*)&PARAMETER_d, one, A);
+    fpdiv1271(A[0]); fpdiv1271(A[1]);               // A = (d-1)/2
+    fp2sqr1271(c, B);
+    fpdiv1271(B[0]); fpdiv1271(B[0]); fpdiv1271(B[0]); fpdiv1271(B[0]);
+    fpdiv1271(B[1]); fpdiv1271(B[1]); fpdiv1271(B[1]); fpdiv1271(B[1]);   // B = (1+d)^2/16
+
+    fp2sqr1271(u, t0);
+    fp2mul1271(t0, (felm_t*)&PARAMETER_Z, t0);
+    fp2add1271(t0, one, t0);                        // t0 = 1+Z*u^2
+    mod1271(t0[0]); mod1271(t0[1]);
+    mask = 0 - (digit_t)is_zero_ct((digit_t*)t0, 2*NWORDS_FIELD);
+    fp2inv1271(t0);                                 // t0 = 1/(1+Z*u^2), or 0 if 1+Z*u^2 = 0
+    fp2mul1271(A, t0, x1);
+    fp2neg1271(x1);                                 // x1 = -A/(1+Z*u^2)
+    fp2copy1271(A, t0);
+    fp2neg1271(t0);
+    fp2select(x1, t0, x1, mask);                    // If 1+Z*u^2 = 0 then x1 = -A
+    fp2add1271(x1, A, x2);
+    fp2neg1271(x2);                                 // x2 = -x1-A
+
+    fp2add1271(x1, A, gx1);
+    fp2mul1271(gx1, x1, gx1);
+    fp2add1271(gx1, B, gx1);
+    fp2mul1271(gx1, x1, gx1);                       // gx1 = x1^3 + A*x1^2 + B*x1
+    fp2add1271(x2, A, gx2);
+    fp2mul1271(gx2, x2, gx2);
+    fp2add1271(gx2, B, gx2);
+    fp2mul1271(gx2, x2, gx2);                       // gx2 = x2^3 + A*x2^2 + B*x2
+
+    mask = 0 - (digit_t)fp2issquare1271(gx1);
+    fp2select(x2, x1, x, mask);
+    fp2select(gx2, gx1, t0, mask);
+    fp2sqrt1271(t0, y);                             // y = sqrt(gx1) if gx1 is square, y = sqrt(gx2) otherwise
+    fp2copy1271(y, t0);
+    fp2neg1271(t0);
+    mod1271(t0[0]); mod1271(t0[1]);
+    fp2select(y, t0, y, (0 - (digit_t)fp2sgn0(y)) ^ mask);   // sgn0(y) = 1 if gx1 is square, sgn0(y) = 0 otherwise
+
+    // Birational map to twisted Edwards coordinates: (X:Y:Z) = (x*(1+d-4x) : -y*(1+d+4x) : y*(1+d-4x))
+    fp2add1271(x, x, t0);
+    fp2add1271(t0, t0, t0);                         // t0 = 4x
+    fp2sub1271(c, t0, t1);                          // t1 = 1+d-4x
+    fp2add1271(c, t0, t0);
+    fp2neg1271(t0);                                 // t0 = -(1+d+4x)
+    fp2mul1271(x, t1, P->ta);                       // Ta = X
+    fp2mul1271(y, t0, P->tb);                       // Tb = Y
+    fp2mul1271(t1, y, t1);                          // t1 = Z
+    mod1271(t1[0]); mod1271(t1[1]);
+    mask = 0 - (digit_t)is_zero_ct((digit_t*)t1, 2*NWORDS_FIELD);
+    fp2zero1271(t0);
+    fp2select(P->ta, t0, P->ta, mask);              // If Z = 0 then output the neutral point (0:1:1)
+    fp2select(P->tb, one, P->tb, mask);
+    fp2select(t1, one, t1, mask);
+    fp2mul1271(P->ta, t1, P->x);                    // Conversion to (X*Z,Y*Z,Z^2,X,Y)
+    fp2mul1271(P->tb, t1, P->y);
+    fp2sqr1271(t1, P->z);
+}
+
+
+static ECCRYPTO_STATUS expand_message_xmd(const unsigned char* Message, const unsigned int SizeMessage, const unsigned char* DST, const unsigned int SizeDST, unsigned char* Output, const unsigned int SizeOutput)
+{ // expand_message_xmd from RFC 9380 using SHA-512
+  // Inputs: Message of size SizeMessage in bytes, domain separation tag DST of size SizeDST in bytes (1 <= SizeDST <= 255)
+  // Output: SizeOutput bytes in Output (SizeOutput <= 2*HASH_BYTES)
+    unsigned char b0[HASH_BYTES], bi[HASH_BYTES + 1 + MAX_DST_BYTES + 1], *temp = NULL;
+    unsigned int i, j, ell = (SizeOutput + HASH_BYTES - 1)/HASH_BYTES, SizeTemp = HASH_BLOCK_BYTES + SizeMessage + 3 + SizeDST + 1;
+    ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+
+    if (SizeDST == 0 || SizeDST > MAX_DST_BYTES || SizeOutput == 0 || ell > 2) {
+        return ECCRYPTO_ERROR_INVALID_PARAMETER;
+    }
+
+    temp = (unsigned char*)calloc(1, SizeTemp);     // msg_prime = Z_pad || Message || I2OSP(SizeOutput, 2) || I2OSP(0, 1) || DST || I2OSP(SizeDST, 1)
+    if (temp == NULL) {
+        return ECCRYPTO_ERROR_NO_MEMORY;
+    }
+    memmove(temp + HASH_BLOCK_BYTES, Message, SizeMessage);
+    temp[HASH_BLOCK_BYTES + SizeMessage] = (unsigned char)(SizeOutput >> 8);
+    temp[HASH_BLOCK_BYTES + SizeMessage + 1] = (unsigned char)SizeOutput;
+    memmove(temp + HASH_BLOCK_BYTES + SizeMessage + 3, DST, SizeDST);
+    temp[SizeTemp - 1] = (unsigned char)SizeDST;
+    if (CryptoHashFunction(temp, SizeTemp, b0) != 0) {
+        Status = ECCRYPTO_ERROR;
+        goto cleanup;
+    }
+
+    memmove(bi, b0, HASH_BYTES);                    // b_1 = H(b_0 || I2OSP(1, 1) || DST_prime)
+    memmove(bi + HASH_BYTES + 1, DST, SizeDST);
+    bi[HASH_BYTES + 1 + SizeDST] = (unsigned char)SizeDST;
+    for (i = 1; i <= ell; i++) {                    // b_i = H((b_0 xor b_(i-1)) || I2OSP(i, 1) || DST_prime)
+        bi[HASH_BYTES] = (unsigned char)i;
+        if (CryptoHashFunction(bi, HASH_BYTES + 1 + SizeDST + 1, bi) != 0) {
+            Status = ECCRYPTO_ERROR;
+            goto cleanup;
+        }
+        memmove(Output + (i-1)*HASH_BYTES, bi, (i < ell) ? HASH_BYTES : (SizeOutput - (i-1)*HASH_BYTES));
+        for (j = 0; j < HASH_BYTES; j++) {
+            bi[j] ^= b0[j];
+        }
+    }
+    Status = ECCRYPTO_SUCCESS;
+
+cleanup:
+    free(temp);
+    clear_words((unsigned int*)b0, HASH_BYTES/sizeof(unsigned int));
+    clear_words((unsigned int*)bi, HASH_BYTES/sizeof(unsigned int));
+
+    return Status;
+}
+
+
+static void fp_from_bytes(const unsigned char* in, felm_t a)
+{ // Reduction of a 32-byte big-endian integer modulo p = 2^127-1
+  // Input:  FIELD_BYTES bytes in big-endian order
+  // Output: a = OS2IP(in) mod p in [0, 2^127-1]
+    unsigned char le[FIELD_BYTES], t[16];
+    felm_t t0;
+    unsigned int i;
+
+    for (i = 0; i < FIELD_BYTES; i++) {
+        le[i] = in[FIELD_BYTES - 1 - i];
+    }
+    memmove((unsigned char*)a, le, 16);             // Bits [0,126]
+    ((unsigned char*)a)[15] &= 0x7F;
+    for (i = 0; i < 16; i++) {                      // Bits [127,253]
+        t[i] = (unsigned char)((le[15 + i] >> 7) | (le[16 + i] << 1));
+    }
+    t[15] &= 0x7F;
+    memmove((unsigned char*)t0, t, 16);
+    fpadd1271(a, t0, a);
+    memset((unsigned char*)t0, 0, 16);              // Bits [254,255]
+    ((unsigned char*)t0)[0] = (unsigned char)(le[31] >> 6);
+    fpadd1271(a, t0, a);
+    mod1271(a);
+}
+
+
+static ECCRYPTO_STATUS hash_to_curve_ext(const unsigned char* Message, const unsigned int SizeMessage, const unsigned char* DST, const unsigned int SizeDST, point_extproj_t P, bool random_oracle)
+{ // Hashing to the prime-order subgroup, P = H(Message), in extended twisted Edwards coordinates
+  // If random_oracle = true, two field elements are mapped and added (hash_to_curve), otherwise a single one is mapped (encode_to_curve)
+    unsigned char bytes[2*2*FIELD_BYTES];
+    unsigned int count = (random_oracle == true) ? 2 : 1;
+    f2elm_t u;
+    point_extproj_t R;
+    point_extproj_precomp_t S;
+    ECCRYPTO_STATUS Status;
+
+    Status = expand_message_xmd(Message, SizeMessage, DST, SizeDST, bytes, count*2*FIELD_BYTES);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+
+    fp_from_bytes(bytes, u[0]);
+    fp_from_bytes(bytes + FIELD_BYTES, u[1]);
+    ecc_map_to_curve(u, P);
+    if (random_oracle == true) {
+        fp_from_bytes(bytes + 2*FIELD_BYTES, u[0]);
+        fp_from_bytes(bytes + 3*FIELD_BYTES, u[1]);
+        ecc_map_to_curve(u, R);
+        R1_to_R2(R, S);
+        eccadd(S, P);                               // P = P+R
+    }
+    cofactor_clearing(P);
+
+    return ECCRYPTO_SUCCESS;
+}
+
+
+ECCRYPTO_STATUS HashToCurve(const unsigned char* Message, const unsigned int SizeMessage, const unsigned char* DST, const unsigned int SizeDST, point_t P)
+{ // Hashing to the curve
+  // It produces P = H(Message) in FourQ's prime-order subgroup using expand_message_xmd with SHA-512 and two evaluations of the Elligator 2 map.
+  // Inputs: Message of size SizeMessage in bytes and domain separation tag DST of size SizeDST in bytes (1 <= SizeDST <= 255)
+  // Output: point P = (x,y) in affine coordinates
+    point_extproj_t R;
+    ECCRYPTO_STATUS Status;
+    METRICS_BEGIN(METRICS_HASHTOCURVE);
+
+    Status = hash_to_curve_ext(Message, SizeMessage, DST, SizeDST, R, true);
+    if (Status == ECCRYPTO_SUCCESS) {
+        eccnorm(R, P);
+    }
+    METRICS_RETURN(Status);
+}
+
+
+ECCRYPTO_STATUS EncodeToCurve(const unsigned char* Message, const unsigned int SizeMessage, const unsigned char* DST, const unsigned int SizeDST, point_t P)
+{ // Encoding to the curve
+  // It produces P = H(Message) in FourQ's prime-order subgroup using expand_message_xmd with SHA-512 and a single evaluation of the Elligator 2 map.
+  // The output distribution is not uniform. Use HashToCurve() whenever a random oracle is required.
+  // Inputs: Message of size SizeMessage in bytes and domain separation tag DST of size SizeDST in bytes (1 <= SizeDST <= 255)
+  // Output: point P = (x,y) in affine coordinates
+    point_extproj_t R;
+    ECCRYPTO_STATUS Status;
+    METRICS_BEGIN(METRICS_ENCODETOCURVE);
+
+    Status = hash_to_curve_ext(Message, SizeMessage, DST, SizeDST, R, false);
+    if (Status == ECCRYPTO_SUCCESS) {
+        eccnorm(R, P);
+    }
+    METRICS_RETURN(Status);
+}
+
+
+ECCRYPTO_STATUS HashToCurveEvaluateBatch(const unsigned char* SecretKey, const unsigned char** Messages, const unsigned int* SizeMessages, const unsigned int NumMessages, const unsigned char* DST, const unsigned int SizeDST, unsigned char* Outputs)
+{ // Batched evaluation of SecretKey*H(Messages[i]), for i = 0,...,NumMessages-1
+  // The scalar is decomposed and recoded once for the whole batch, and the results are normalized using a single inversion per BATCH_POINTS points.
+  // Inputs: 32-byte SecretKey, NumMessages messages Messages[i] of size SizeMessages[i] in bytes, and domain separation tag DST of size SizeDST in bytes
+  // Output: NumMessages 32-byte encodings of SecretKey*H(Messages[i]) in Outputs
+    point_extproj R[BATCH_POINTS];
+    point_affine Q[BATCH_POINTS];
+    unsigned int digits[NDIGITS_VARBASE], sign_masks[NDIGITS_VARBASE];
+    unsigned int i, j, n;
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+    METRICS_BEGIN(METRICS_HASHTOCURVEEVALUATEBATCH);
+
+    if (ecc_mul_prepare((digit_t*)SecretKey, digits, sign_masks) == false) {
+        Status = ECCRYPTO_ERROR;
+        goto cleanup;
+    }
+
+    for (i = 0; i < NumMessages; i += n) {
+        n = (NumMessages - i < BATCH_POINTS) ? (NumMessages - i) : BATCH_POINTS;
+        for (j = 0; j < n; j++) {
+            Status = hash_to_curve_ext(Messages[i + j], SizeMessages[i + j], DST, SizeDST, &R[j], true);
+            if (Status != ECCRYPTO_SUCCESS) {
+                goto cleanup;
+            }
+            if (ecc_mul_prepared(&R[j], digits, sign_masks) == false) {
+                Status = ECCRYPTO_ERROR;
+                goto cleanup;
+            }
+        }
+        eccnorm_batch(R, Q, n);
+        for (j = 0; j < n; j++) {
+            encode(&Q[j], Outputs + 32*(i + j));
+        }
+    }
+
+cleanup:
+    clear_words((void*)digits, NDIGITS_VARBASE);
+    clear_words((void*)sign_masks, NDIGITS_VARBASE);
+
+    METRICS_RETURN(Status);
+}
@@ -34,11 +34,14 @@ ECCRYPTO_STATUS CompressedPublicKeyGeneration(const unsigned char* SecretKey, un
   // Input:  32-byte SecretKey
   // Output: 32-byte PublicKey
     point_t P;
+    METRICS_BEGIN(METRICS_COMPRESSEDPUBLICKEYGENERATION);
     
-    ecc_mul_fixed((digit_t*)SecretKey, P);  // Compute public key                                       
+    if (ecc_mul_fixed((digit_t*)SecretKey, P) == false) {  // Compute public key
+        METRICS_RETURN(ECCRYPTO_ERROR);
+    }
 	encode(P, PublicKey);                   // Encode public key
 
-    return ECCRYPTO_SUCCESS;
+    METRICS_RETURN(ECCRYPTO_SUCCESS);
 }
 
 
@@ -47,6 +50,7 @@ ECCRYPTO_STATUS CompressedKeyGeneration(unsigned char* SecretKey, unsigned char*
   // It produces a private key SecretKey and a public key PublicKey, which is the encoding of P = SecretKey*G (G is the generator).
   // Outputs: 32-byte SecretKey and 32-byte PublicKey 
     ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+    METRICS_BEGIN(METRICS_COMPRESSEDKEYGENERATION);
 
 	Status = RandomBytesFunction(SecretKey, 32);
 	if (Status != ECCRYPTO_SUCCESS) {
@@ -58,13 +62,13 @@ ECCRYPTO_STATUS CompressedKeyGeneration(unsigned char* SecretKey, unsigned char*
         goto cleanup;
     }
 
-    return ECCRYPTO_SUCCESS;
+    METRICS_RETURN(ECCRYPTO_SUCCESS);
 
 cleanup:
     clear_words((unsigned int*)SecretKey, 256/(sizeof(unsigned int)*8));
     clear_words((unsigned int*)PublicKey, 256/(sizeof(unsigned int)*8));
 
-    return Status;
+    METRICS_RETURN(Status);
 }
 
 
@@ -75,6 +79,7 @@ ECCRYPTO_STATUS CompressedSecretAgreement(const unsigned char* SecretKey, const
   // Output: 32-byte SharedSecret
     point_t A;
     ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+    METRICS_BEGIN(METRICS_COMPRESSEDSECRETAGREEMENT);
 
     if ((PublicKey[15] & 0x80) != 0) {  // Is bit128(PublicKey) = 0?
 		Status = ECCRYPTO_ERROR_INVALID_PARAMETER;
@@ -98,12 +103,77 @@ ECCRYPTO_STATUS CompressedSecretAgreement(const unsigned char* SecretKey, const
   
 	memmove(SharedSecret, (unsigned char*)A->y, 32);
 
-	return ECCRYPTO_SUCCESS;
+	METRICS_RETURN(ECCRYPTO_SUCCESS);
     
 cleanup:
     clear_words((unsigned int*)SharedSecret, 256/(sizeof(unsigned int)*8));
     
-    return Status;
+    METRICS_RETURN(Status);
+}
+
+
+ECCRYPTO_STATUS EphemeralKeyAgreement(const unsigned char* PublicKey, unsigned char* SecretKey, unsigned char* EphemeralPublicKey, unsigned char* SharedSecret)
+{ // Ephemeral keypair generation fused with secret agreement against a static, compressed 32-byte public key
+  // It produces a fresh SecretKey e, the ephemeral public key EphemeralPublicKey, which is the encoding of e*G, and SharedSecret, which is the 
+  // y-coordinate of e*A, where A is the decoding of PublicKey. The outputs are the same as CompressedKeyGeneration() followed by CompressedSecretAgreement().
+  // The scalar e is reduced modulo the order once, inside ecc_mul_fixed_ext(). ecc_mul_prepare() decomposes the full 256-bit e directly, 
+  // as ecc_mul() does. Both results are normalized with a single inversion.
+  // Input:   32-byte PublicKey
+  // Outputs: 32-byte SecretKey, 32-byte EphemeralPublicKey and 32-byte SharedSecret
+    point_t A;
+    point_extproj R[2];
+    point_affine Q[2];
+    unsigned int digits[NDIGITS_VARBASE], sign_masks[NDIGITS_VARBASE];
+    ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+    METRICS_BEGIN(METRICS_EPHEMERALKEYAGREEMENT);
+
+    if ((PublicKey[15] & 0x80) != 0) {  // Is bit128(PublicKey) = 0?
+		Status = ECCRYPTO_ERROR_INVALID_PARAMETER;
+		goto cleanup;
+    }
+
+	Status = decode(PublicKey, A);    // Also verifies that A is on the curve. If it is not, it fails
+	if (Status != ECCRYPTO_SUCCESS) {
+		goto cleanup;
+	}
+
+	Status = RandomBytesFunction(SecretKey, 32);
+	if (Status != ECCRYPTO_SUCCESS) {
+		goto cleanup;
+	}
+
+    point_setup(A, &R[1]);
+    cofactor_clearing(&R[1]);
+    if (ecc_mul_fixed_ext((digit_t*)SecretKey, &R[0]) == false ||                   // R[0] = e*G
+        ecc_mul_prepare((digit_t*)SecretKey, digits, sign_masks) == false ||
+        ecc_mul_prepared(&R[1], digits, sign_masks) == false) {                     // R[1] = e*A
+		Status = ECCRYPTO_ERROR;
+		goto cleanup;
+    }
+    eccnorm_batch(R, Q, 2);
+
+    if (is_neutral_point(&Q[1])) {  // Is shared secret = neutral point (0,1)?
+		Status = ECCRYPTO_ERROR_SHARED_KEY;
+		goto cleanup;
+    }
+
+	encode(&Q[0], EphemeralPublicKey);
+	memmove(SharedSecret, (unsigned char*)Q[1].y, 32);
+	Status = ECCRYPTO_SUCCESS;
+
+cleanup:
+    if (Status != ECCRYPTO_SUCCESS) {
+        clear_words((unsigned int*)SecretKey, 256/(sizeof(unsigned int)*8));
+        clear_words((unsigned int*)EphemeralPublicKey, 256/(sizeof(unsigned int)*8));
+        clear_words((unsigned int*)SharedSecret, 256/(sizeof(unsigned int)*8));
+    }
+    clear_words((void*)A, sizeof(point_t)/sizeof(unsigned int));
+    clear_words((void*)R, sizeof(R)/sizeof(unsigned int));
+    clear_words((void*)Q, sizeof(Q)/sizeof(unsigned int));
+    clear_words((void*)digits, NDIGITS_VARBASE);
+    clear_words((void*)sign_masks, NDIGITS_VARBASE);
+
+    METRICS_RETURN(Status);
 }
 
 
@@ -114,10 +184,13 @@ ECCRYPTO_STATUS PublicKeyGeneration(const unsigned char* SecretKey, unsigned cha
   // It produces the public key PublicKey = SecretKey*G, where G is the generator.
   // Input:  32-byte SecretKey
   // Output: 64-byte PublicKey
+	METRICS_BEGIN(METRICS_PUBLICKEYGENERATION);
 
-	ecc_mul_fixed((digit_t*)SecretKey, (point_affine*)PublicKey);  // Compute public key
+	if (ecc_mul_fixed((digit_t*)SecretKey, (point_affine*)PublicKey) == false) {  // Compute public key
+		METRICS_RETURN(ECCRYPTO_ERROR);
+	}
 
-	return ECCRYPTO_SUCCESS;
+	METRICS_RETURN(ECCRYPTO_SUCCESS);
 }
 
 
@@ -126,6 +199,7 @@ ECCRYPTO_STATUS KeyGeneration(unsigned char* SecretKey, unsigned char* PublicKey
   // It produces a private key SecretKey and computes the public key PublicKey = SecretKey*G, where G is the generator.
   // Outputs: 32-byte SecretKey and 64-byte PublicKey 
 	ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+	METRICS_BEGIN(METRICS_KEYGENERATION);
 
 	Status = RandomBytesFunction(SecretKey, 32);
 	if (Status != ECCRYPTO_SUCCESS) {
@@ -137,13 +211,13 @@ ECCRYPTO_STATUS KeyGeneration(unsigned char* SecretKey, unsigned char* PublicKey
 		goto cleanup;
 	}
 
-	return ECCRYPTO_SUCCESS;
+	METRICS_RETURN(ECCRYPTO_SUCCESS);
 
 cleanup:
 	clear_words((unsigned int*)SecretKey, 256/(sizeof(unsigned int)*8));
 	clear_words((unsigned int*)PublicKey, 512/(sizeof(unsigned int)*8));
 
-	return Status;
+	METRICS_RETURN(Status);
 }
 
 
@@ -154,6 +228,7 @@ ECCRYPTO_STATUS SecretAgreement(const unsigned char* SecretKey, const unsigned c
   // Output: 32-byte SharedSecret
 	point_t A;
 	ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+	METRICS_BEGIN(METRICS_SECRETAGREEMENT);
 
     if (((PublicKey[15] & 0x80) != 0) || ((PublicKey[31] & 0x80) != 0) || ((PublicKey[47] & 0x80) != 0) || ((PublicKey[63] & 0x80) != 0)) {  // Are PublicKey_x[i] and PublicKey_y[i] < 2^127?
 		Status = ECCRYPTO_ERROR_INVALID_PARAMETER;
@@ -172,10 +247,10 @@ ECCRYPTO_STATUS SecretAgreement(const unsigned char* SecretKey, const unsigned c
   
 	memmove(SharedSecret, (unsigned char*)A->y, 32);
 
-	return ECCRYPTO_SUCCESS;
+	METRICS_RETURN(ECCRYPTO_SUCCESS);
 
 cleanup:
 	clear_words((unsigned int*)SharedSecret, 256/(sizeof(unsigned int)*8));
 
-	return Status;
+	METRICS_RETURN(Status);
 }
\ No newline at end of file
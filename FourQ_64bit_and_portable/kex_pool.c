@@ -0,0 +1,490 @@
+/**********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: pool of pre-generated ephemeral keypairs for key exchange
+*
+* Keypairs are generated ahead of time by background threads, in batches that
+* share the fixed-base multiplications and a single inversion, and are kept in a
+* bounded ring. Foreground threads take them with a lock-free pop. Every keypair
+* is handed out once and its slot is cleared before it can be refilled.
+***********************************************************************************/
+
+#include "FourQ_internal.h"
+#include "../random/random.h"
+#include <stdlib.h>
+#include <string.h>
+#if (OS_TARGET == OS_WIN)
+    #include <windows.h>
+#else
+    #include <pthread.h>
+    #include <semaphore.h>
+#endif
+
+
+#define POOL_BATCH          64                   // Keypairs generated per call to ecc_mul_fixed_batch()
+#define POOL_MAX_CAPACITY   (1 << 24)
+#define POOL_MAX_THREADS    64
+#define POOL_CACHE_LINE     64
+
+typedef struct {
+    uint64_t sequence;                           // Position at which the slot can next be written (empty) or read (full, sequence = position + 1)
+    unsigned char secret_key[32];
+    unsigned char public_key[32];
+} pool_slot;
+
+struct ephemeral_pool {                         // Fields written by pops and by the refill threads are kept on separate cache lines
+    uint64_t enqueue_pos;
+    unsigned char pad0[POOL_CACHE_LINE - sizeof(uint64_t)];
+    uint64_t dequeue_pos;
+    unsigned char pad1[POOL_CACHE_LINE - sizeof(uint64_t)];
+    uint64_t pops;                               // Written by every pop
+    unsigned char pad2[POOL_CACHE_LINE - sizeof(uint64_t)];
+    uint64_t exhausted, refills;                 // Written by pops that find the pool empty or at its low-water mark
+    unsigned char pad3[POOL_CACHE_LINE - 2*sizeof(uint64_t)];
+    uint64_t refill_pending;                     // Set by a pop that leaves the pool at or below its low-water mark, cleared by the refill threads once the pool is full
+    unsigned char pad4[POOL_CACHE_LINE - sizeof(uint64_t)];
+    uint64_t generated, discarded, refill_failures;   // Written by the refill threads
+    unsigned char pad5[POOL_CACHE_LINE - 3*sizeof(uint64_t)];
+    uint64_t stop;
+    pool_slot* slots;
+    uint64_t mask;                               // Number of slots minus 1. The number of slots is a power of 2 not smaller than the capacity
+    unsigned int capacity, low_water, nthreads;
+    unsigned int fork_generation;
+#if (OS_TARGET == OS_WIN)
+    HANDLE wakeup;
+    HANDLE threads[POOL_MAX_THREADS];
+#else
+    sem_t wakeup;
+    pthread_t threads[POOL_MAX_THREADS];
+#endif
+};
+
+
+// Atomic operations on the positions, sequences and counters of a pool
+
+#if (OS_TARGET == OS_WIN)
+
+static __inline uint64_t atomic_load64(uint64_t* p)
+{
+    return (uint64_t)InterlockedOr64((volatile LONG64*)p, 0);
+}
+
+static __inline void atomic_store64(uint64_t* p, uint64_t value)
+{
+    InterlockedExchange64((volatile LONG64*)p, (LONG64)value);
+}
+
+static __inline bool atomic_cas64(uint64_t* p, uint64_t* expected, uint64_t desired)
+{ // If *p = *expected then *p = desired and returns true. Otherwise *expected = *p and returns false
+    uint64_t old = (uint64_t)InterlockedCompareExchange64((volatile LONG64*)p, (LONG64)desired, (LONG64)*expected);
+
+    if (old == *expected) return true;
+    *expected = old;
+    return false;
+}
+
+static __inline void atomic_add64(uint64_t* p, uint64_t value)
+{
+    InterlockedExchangeAdd64((volatile LONG64*)p, (LONG64)value);
+}
+
+#else
+
+static __inline uint64_t atomic_load64(uint64_t* p)
+{
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+static __inline void atomic_store64(uint64_t* p, uint64_t value)
+{
+    __atomic_store_n(p, value, __ATOMIC_RELEASE);
+}
+
+static __inline bool atomic_cas64(uint64_t* p, uint64_t* expected, uint64_t desired)
+{ // If *p = *expected then *p = desired and returns true. Otherwise *expected = *p and returns false
+    return __atomic_compare_exchange_n(p, expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+static __inline void atomic_add64(uint64_t* p, uint64_t value)
+{
+    __atomic_fetch_add(p, value, __ATOMIC_RELAXED);
+}
+
+#endif
+
+
+// Keypairs inherited through fork() are also held by the parent, so a child never takes them from the pool
+
+#if (OS_TARGET == OS_WIN)
+
+static unsigned int current_fork_generation(void)
+{
+    return 0;
+}
+
+#else
+
+static unsigned int fork_generation;
+static pthread_once_t fork_handler_once = PTHREAD_ONCE_INIT;
+
+static void fork_child(void)
+{
+    fork_generation++;
+}
+
+static void register_fork_handler(void)
+{
+    pthread_atfork(NULL, NULL, fork_child);
+}
+
+static unsigned int current_fork_generation(void)
+{
+    return __atomic_load_n(&fork_generation, __ATOMIC_RELAXED);
+}
+
+#endif
+
+
+static __inline uint64_t pool_available(ephemeral_pool_t* pool)
+{ // Number of keypairs in the pool, exact when no other thread is pushing or popping
+    uint64_t dequeue_pos = atomic_load64(&pool->dequeue_pos);
+    uint64_t enqueue_pos = atomic_load64(&pool->enqueue_pos);
+
+    return (enqueue_pos > dequeue_pos) ? enqueue_pos - dequeue_pos : 0;
+}
+
+
+static bool pool_push(ephemeral_pool_t* pool, const unsigned char* secret_key, const unsigned char* public_key)
+{ // Store a keypair in the first free slot and count it as generated. Returns false if the pool is full
+    uint64_t pos = atomic_load64(&pool->enqueue_pos), sequence;
+    pool_slot* slot;
+
+    for (;;) {
+        slot = &pool->slots[pos & pool->mask];
+        sequence = atomic_load64(&slot->sequence);
+        if (sequence == pos) {
+            if (atomic_cas64(&pool->enqueue_pos, &pos, pos + 1)) break;
+        } else if ((int64_t)(sequence - pos) < 0) {
+            return false;
+        } else {
+            pos = atomic_load64(&pool->enqueue_pos);
+        }
+    }
+    memcpy(slot->secret_key, secret_key, 32);
+    memcpy(slot->public_key, public_key, 32);
+    atomic_add64(&pool->generated, 1);           // Counted before it is published, so a reader that sees the keypair also sees it counted
+    atomic_store64(&slot->sequence, pos + 1);    // Publishes the keypair
+    return true;
+}
+
+
+static bool pool_pop(ephemeral_pool_t* pool, unsigned char* secret_key, unsigned char* public_key)
+{ // Take the oldest keypair and clear its slot. Returns false if the pool is empty
+    uint64_t pos = atomic_load64(&pool->dequeue_pos), sequence;
+    pool_slot* slot;
+
+    for (;;) {
+        slot = &pool->slots[pos & pool->mask];
+        sequence = atomic_load64(&slot->sequence);
+        if (sequence == pos + 1) {
+            if (atomic_cas64(&pool->dequeue_pos, &pos, pos + 1)) break;
+        } else if ((int64_t)(sequence - (pos + 1)) < 0) {
+            return false;
+        } else {
+            pos = atomic_load64(&pool->dequeue_pos);
+        }
+    }
+    memcpy(secret_key, slot->secret_key, 32);
+    memcpy(public_key, slot->public_key, 32);
+    clear_words((void*)slot->secret_key, 32/sizeof(unsigned int));
+    clear_words((void*)slot->public_key, 32/sizeof(unsigned int));
+    atomic_store64(&slot->sequence, pos + pool->mask + 1); // Hands the slot back to the producers for the next round
+    return true;
+}
+
+
+static void pool_wake(ephemeral_pool_t* pool, unsigned int count)
+{
+    unsigned int i;
+
+    for (i = 0; i < count; i++) {
+#if (OS_TARGET == OS_WIN)
+        ReleaseSemaphore(pool->wakeup, 1, NULL);
+#else
+        sem_post(&pool->wakeup);
+#endif
+    }
+}
+
+
+static ECCRYPTO_STATUS pool_fill(ephemeral_pool_t* pool)
+{ // Generate keypairs in batches until the pool holds its capacity. Keypairs that no longer fit are cleared
+    digit_t secret_keys[POOL_BATCH*NWORDS_ORDER];
+    point_affine points[POOL_BATCH];
+    unsigned char public_key[32];
+    uint64_t available;
+    unsigned int i, n;
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    while (atomic_load64(&pool->stop) == 0) {
+        available = pool_available(pool);
+        if (available >= pool->capacity) {
+            break;
+        }
+        n = (pool->capacity - available < POOL_BATCH) ? (unsigned int)(pool->capacity - available) : POOL_BATCH;
+
+        Status = RandomBytesFunction((unsigned char*)secret_keys, 32*n);
+        if (Status != ECCRYPTO_SUCCESS) {
+            break;
+        }
+        if (ecc_mul_fixed_batch(secret_keys, points, n) == false) {   // Public keys, normalized with a single inversion per batch
+            Status = ECCRYPTO_ERROR;
+            break;
+        }
+        for (i = 0; i < n; i++) {
+            encode(&points[i], public_key);
+            if (!pool_push(pool, (unsigned char*)&secret_keys[i*NWORDS_ORDER], public_key)) {
+                atomic_add64(&pool->discarded, n - i);
+                break;
+            }
+        }
+    }
+
+    clear_words((void*)secret_keys, sizeof(secret_keys)/sizeof(unsigned int));
+    clear_words((void*)points, sizeof(points)/sizeof(unsigned int));
+    return Status;
+}
+
+
+#if (OS_TARGET == OS_WIN)
+static DWORD WINAPI refill_thread(LPVOID arg)
+#else
+static void* refill_thread(void* arg)
+#endif
+{ // Background refill: sleeps until a pop reaches the low-water mark, then fills the pool
+    ephemeral_pool_t* pool = (ephemeral_pool_t*)arg;
+    uint64_t pending;
+    ECCRYPTO_STATUS Status;
+
+    for (;;) {
+#if (OS_TARGET == OS_WIN)
+        WaitForSingleObject(pool->wakeup, INFINITE);
+#else
+        while (sem_wait(&pool->wakeup) != 0);
+#endif
+        if (atomic_load64(&pool->stop) != 0) {
+            break;
+        }
+        do {                                     // Pops that reached the low-water mark before the flag was cleared did not wake a thread
+            Status = pool_fill(pool);
+            atomic_store64(&pool->refill_pending, 0);
+            pending = 0;
+            if (Status != ECCRYPTO_SUCCESS) {    // E.g., the random source fails: wait for the next pop at the low-water mark rather than retrying at once
+                atomic_add64(&pool->refill_failures, 1);
+                METRICS_EVENT(METRICS_EPHEMERAL_POOL_REFILL_FAILURE);
+                break;
+            }
+        } while (atomic_load64(&pool->stop) == 0 && pool_available(pool) <= pool->low_water && atomic_cas64(&pool->refill_pending, &pending, 1));
+    }
+    return 0;
+}
+
+
+ECCRYPTO_STATUS EphemeralPoolCreate(const unsigned int Capacity, const unsigned int LowWater, const unsigned int Threads, ephemeral_pool_t** Pool)
+{ // Creation of a pool of pre-generated ephemeral keypairs for key exchange
+  // The pool is filled before this function returns. Threads background threads refill it whenever a pop leaves LowWater keypairs or fewer.
+  // Inputs: Capacity in keypairs (1 to 2^24), LowWater < Capacity and number of refill Threads (1 to 64)
+  // Output: Pool, which must be released with EphemeralPoolDestroy()
+    ephemeral_pool_t* pool;
+    uint64_t nslots = 1, i;
+    unsigned int j;
+    ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+
+    if (Pool == NULL) {
+        return ECCRYPTO_ERROR_INVALID_PARAMETER;
+    }
+    *Pool = NULL;
+    if (Capacity == 0 || Capacity > POOL_MAX_CAPACITY || LowWater >= Capacity || Threads == 0 || Threads > POOL_MAX_THREADS) {
+        return ECCRYPTO_ERROR_INVALID_PARAMETER;
+    }
+#if (OS_TARGET != OS_WIN)
+    pthread_once(&fork_handler_once, register_fork_handler);
+#endif
+
+    while (nslots < Capacity) {
+        nslots *= 2;
+    }
+    pool = (ephemeral_pool_t*)calloc(1, sizeof(ephemeral_pool_t));
+    if (pool == NULL) {
+        return ECCRYPTO_ERROR_NO_MEMORY;
+    }
+    pool->slots = (pool_slot*)calloc((size_t)nslots, sizeof(pool_slot));
+    if (pool->slots == NULL) {
+        free(pool);
+        return ECCRYPTO_ERROR_NO_MEMORY;
+    }
+    for (i = 0; i < nslots; i++) {
+        pool->slots[i].sequence = i;
+    }
+    pool->mask = nslots - 1;
+    pool->capacity = Capacity;
+    pool->low_water = LowWater;
+    pool->fork_generation = current_fork_generation();
+
+    Status = pool_fill(pool);
+    if (Status != ECCRYPTO_SUCCESS) {
+        goto cleanup;
+    }
+
+#if (OS_TARGET == OS_WIN)
+    pool->wakeup = CreateSemaphore(NULL, 0, POOL_MAX_THREADS, NULL);
+    if (pool->wakeup == NULL) {
+        Status = ECCRYPTO_ERROR_NO_MEMORY;
+        goto cleanup;
+    }
+#else
+    if (sem_init(&pool->wakeup, 0, 0) != 0) {
+        Status = ECCRYPTO_ERROR_NO_MEMORY;
+        goto cleanup;
+    }
+#endif
+    for (j = 0; j < Threads; j++) {
+#if (OS_TARGET == OS_WIN)
+        pool->threads[j] = CreateThread(NULL, 0, refill_thread, pool, 0, NULL);
+        if (pool->threads[j] == NULL) break;
+#else
+        if (pthread_create(&pool->threads[j], NULL, refill_thread, pool) != 0) break;
+#endif
+        pool->nthreads++;
+    }
+    if (pool->nthreads < Threads) {
+        Status = ECCRYPTO_ERROR_NO_MEMORY;
+        EphemeralPoolDestroy(pool);
+        return Status;
+    }
+
+    *Pool = pool;
+    return ECCRYPTO_SUCCESS;
+
+cleanup:
+    clear_words((void*)pool->slots, (unsigned int)(nslots*sizeof(pool_slot)/sizeof(unsigned int)));
+    free(pool->slots);
+    free(pool);
+    return Status;
+}
+
+
+void EphemeralPoolDestroy(ephemeral_pool_t* Pool)
+{ // Release a pool of pre-generated ephemeral keypairs. The refill threads are stopped and the remaining keypairs are cleared
+    unsigned int i;
+
+    if (Pool == NULL) {
+        return;
+    }
+    atomic_store64(&Pool->stop, 1);
+    if (Pool->fork_generation == current_fork_generation()) {   // A child process does not inherit the refill threads
+        pool_wake(Pool, Pool->nthreads);
+        for (i = 0; i < Pool->nthreads; i++) {
+#if (OS_TARGET == OS_WIN)
+            WaitForSingleObject(Pool->threads[i], INFINITE);
+            CloseHandle(Pool->threads[i]);
+#else
+            pthread_join(Pool->threads[i], NULL);
+#endif
+        }
+    }
+#if (OS_TARGET == OS_WIN)
+    CloseHandle(Pool->wakeup);
+#else
+    sem_destroy(&Pool->wakeup);
+#endif
+    clear_words((void*)Pool->slots, (unsigned int)((Pool->mask + 1)*sizeof(pool_slot)/sizeof(unsigned int)));
+    free(Pool->slots);
+    free(Pool);
+}
+
+
+ECCRYPTO_STATUS EphemeralPoolKeyGeneration(ephemeral_pool_t* Pool, unsigned char* SecretKey, unsigned char* PublicKey)
+{ // Keypair generation for key exchange from a pool of pre-generated ephemeral keypairs. Public key is compressed to 32 bytes
+  // The keypair is removed from the pool and its copy in the pool is cleared, so it is never handed out again. If the pool is empty, or
+  // if Pool = NULL or was created by a parent process, the keypair is generated with CompressedKeyGeneration() on the calling thread.
+  // Input:   Pool
+  // Outputs: 32-byte SecretKey and 32-byte PublicKey
+    uint64_t pending = 0;
+    bool found;
+    ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+    METRICS_BEGIN(METRICS_EPHEMERALPOOLKEYGENERATION);
+
+    if (Pool == NULL) {
+        Status = CompressedKeyGeneration(SecretKey, PublicKey);
+        METRICS_RETURN(Status);
+    }
+    atomic_add64(&Pool->pops, 1);
+    if (Pool->fork_generation != current_fork_generation()) {
+        found = false;
+    } else {
+        found = pool_pop(Pool, SecretKey, PublicKey);
+        if (pool_available(Pool) <= Pool->low_water && atomic_cas64(&Pool->refill_pending, &pending, 1)) {
+            atomic_add64(&Pool->refills, 1);
+            pool_wake(Pool, Pool->nthreads);
+        }
+    }
+    if (found) {
+        METRICS_RETURN(ECCRYPTO_SUCCESS);
+    }
+
+    atomic_add64(&Pool->exhausted, 1);
+    METRICS_EVENT(METRICS_EPHEMERAL_POOL_EXHAUSTED);
+    Status = CompressedKeyGeneration(SecretKey, PublicKey);
+    METRICS_RETURN(Status);
+}
+
+
+ECCRYPTO_STATUS EphemeralPoolKeyAgreement(ephemeral_pool_t* Pool, const unsigned char* PublicKey, unsigned char* EphemeralPublicKey, unsigned char* SharedSecret)
+{ // Secret agreement against a static, compressed 32-byte public key using an ephemeral keypair taken from a pool
+  // The ephemeral secret key is cleared before returning, so it is used for this agreement only.
+  // Inputs:  Pool and 32-byte PublicKey
+  // Outputs: 32-byte EphemeralPublicKey and 32-byte SharedSecret
+    unsigned char SecretKey[32];
+    ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+    METRICS_BEGIN(METRICS_EPHEMERALPOOLKEYAGREEMENT);
+
+    Status = EphemeralPoolKeyGeneration(Pool, SecretKey, EphemeralPublicKey);
+    if (Status != ECCRYPTO_SUCCESS) {
+        goto cleanup;
+    }
+    Status = CompressedSecretAgreement(SecretKey, PublicKey, SharedSecret);
+
+cleanup:
+    if (Status != ECCRYPTO_SUCCESS) {
+        clear_words((void*)SharedSecret, 32/sizeof(unsigned int));
+    }
+    clear_words((void*)SecretKey, 32/sizeof(unsigned int));
+
+    METRICS_RETURN(Status);
+}
+
+
+void EphemeralPoolStatistics(ephemeral_pool_t* Pool, ephemeral_pool_stats_t* Stats)
+{ // Pool statistics. Counters are read one at a time and may be slightly inconsistent while other threads use the pool
+    if (Pool == NULL || Stats == NULL) {
+        return;
+    }
+    Stats->pops = atomic_load64(&Pool->pops);
+    Stats->exhausted = atomic_load64(&Pool->exhausted);
+    Stats->generated = atomic_load64(&Pool->generated);
+    Stats->discarded = atomic_load64(&Pool->discarded);
+    Stats->refills = atomic_load64(&Pool->refills);
+    Stats->refill_failures = atomic_load64(&Pool->refill_failures);
+    Stats->available = pool_available(Pool);
+    Stats->capacity = Pool->capacity;
+    Stats->low_water = Pool->low_water;
+}
+
+
+void ephemeral_pool_hold_refill(ephemeral_pool_t* pool, bool hold)
+{ // A pop only wakes the refill threads if it can set refill_pending, so keeping the flag set holds back the refill
+    atomic_store64(&pool->refill_pending, hold ? 1 : 0);
+}
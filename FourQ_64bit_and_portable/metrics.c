@@ -0,0 +1,532 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: metrics of the public API
+*
+* Every thread records the latency and outcome of its API calls in its own shard,
+* which is allocated on first use and linked into a global list. The lock of a shard
+* is only contended while a snapshot or reset reads it. When a thread exits, a thread
+* destructor (pthread key or FLS callback) folds its shard into an aggregate of the
+* retired threads and frees it, so that threads that come and go do not accumulate
+* shards and the metrics of the process are never lost.
+************************************************************************************/
+
+#include "FourQ_internal.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#if defined(FOURQ_METRICS)
+    #include <stdlib.h>
+    #if (OS_TARGET == OS_WIN)
+        #include <windows.h>
+    #else
+        #include <pthread.h>
+        #include <time.h>
+    #endif
+#endif
+
+
+static const char* const metrics_call_names[METRICS_NCALLS] = {
+    "SchnorrQ_KeyGeneration", "SchnorrQ_FullKeyGeneration", "SchnorrQ_Sign", "SchnorrQ_Verify", "SchnorrQ_VerifyBatch", "SchnorrQ_VerifyCached",
+    "CompressedPublicKeyGeneration", "CompressedKeyGeneration", "CompressedSecretAgreement", "EphemeralKeyAgreement",
+    "EphemeralPoolKeyGeneration", "EphemeralPoolKeyAgreement",
+    "PublicKeyGeneration", "KeyGeneration", "SecretAgreement",
+    "HashToCurve", "EncodeToCurve", "HashToCurveEvaluateBatch"
+};
+
+static const char* const metrics_event_names[METRICS_NEVENTS] = {
+    "decode_failure", "invalid_point", "verification_failure", "ephemeral_pool_exhausted", "ephemeral_pool_refill_failure"
+};
+
+
+const char* FourQ_MetricsCallName(metrics_call_t Call)
+{ // Name of an API call
+    return ((unsigned int)Call < METRICS_NCALLS) ? metrics_call_names[Call] : NULL;
+}
+
+
+const char* FourQ_MetricsEventName(metrics_event_t Event)
+{ // Name of an event
+    return ((unsigned int)Event < METRICS_NEVENTS) ? metrics_event_names[Event] : NULL;
+}
+
+
+static uint64_t bucket_upper_bound(unsigned int index)
+{ // Largest latency recorded in a histogram bucket
+    unsigned int shift;
+    uint64_t m;
+
+    if (index < (1 << METRICS_SUB_BUCKET_BITS)) {
+        return index;
+    }
+    shift = (index >> (METRICS_SUB_BUCKET_BITS-1)) - 1;
+    m = index - ((uint64_t)shift << (METRICS_SUB_BUCKET_BITS-1));
+    return ((m+1) << shift) - 1;
+}
+
+
+uint64_t FourQ_MetricsPercentile(const metrics_histogram_t* Histogram, double Quantile)
+{ // Latency in nanoseconds below which a fraction Quantile of the calls recorded in Histogram completed
+    uint64_t rank, count = 0, bound;
+    unsigned int i;
+
+    if (Histogram->calls == 0) {
+        return 0;
+    }
+    if (Quantile < 0) Quantile = 0;
+    if (Quantile > 1) Quantile = 1;
+    rank = (uint64_t)(Quantile*(double)Histogram->calls + 0.5);
+    if (rank == 0) rank = 1;
+
+    for (i = 0; i < METRICS_BUCKETS - 1; i++) {
+        count += Histogram->buckets[i];
+        if (count >= rank) {
+            break;
+        }
+    }
+    bound = bucket_upper_bound(i);
+    return (bound < Histogram->max_ns) ? bound : Histogram->max_ns;
+}
+
+
+#if defined(FOURQ_METRICS)
+
+typedef struct metrics_shard {
+#if (OS_TARGET == OS_WIN)
+    SRWLOCK lock;
+#else
+    pthread_mutex_t lock;
+#endif
+    metrics_histogram_t* calls[METRICS_NCALLS];  // Allocated on the first call of each function
+    uint64_t events[METRICS_NEVENTS];
+    struct metrics_shard* next;
+} metrics_shard;
+
+static THREAD_LOCAL metrics_shard* metrics_local = NULL;
+static metrics_shard* metrics_shards = NULL;
+static metrics_histogram_t metrics_retired_calls[METRICS_NCALLS];   // Metrics of the threads that exited, under metrics_shards_lock
+static uint64_t metrics_retired_events[METRICS_NEVENTS];
+static const metrics_tracer_t* metrics_tracer = NULL;             // Read and written with ATOMIC_LOAD_PTR() and ATOMIC_STORE_PTR()
+#if (OS_TARGET == OS_WIN)
+    static SRWLOCK metrics_shards_lock = SRWLOCK_INIT;
+    static INIT_ONCE metrics_key_once = INIT_ONCE_STATIC_INIT;
+    static DWORD metrics_key = FLS_OUT_OF_INDEXES;
+#else
+    static pthread_mutex_t metrics_shards_lock = PTHREAD_MUTEX_INITIALIZER;
+    static pthread_once_t metrics_key_once = PTHREAD_ONCE_INIT;
+    static pthread_key_t metrics_key;
+    static bool metrics_key_valid = false;
+#endif
+
+
+static __inline void shard_lock(metrics_shard* shard)
+{
+#if (OS_TARGET == OS_WIN)
+    AcquireSRWLockExclusive(&shard->lock);
+#else
+    pthread_mutex_lock(&shard->lock);
+#endif
+}
+
+
+static __inline void shard_unlock(metrics_shard* shard)
+{
+#if (OS_TARGET == OS_WIN)
+    ReleaseSRWLockExclusive(&shard->lock);
+#else
+    pthread_mutex_unlock(&shard->lock);
+#endif
+}
+
+
+static __inline void shards_lock(void)
+{
+#if (OS_TARGET == OS_WIN)
+    AcquireSRWLockExclusive(&metrics_shards_lock);
+#else
+    pthread_mutex_lock(&metrics_shards_lock);
+#endif
+}
+
+
+static __inline void shards_unlock(void)
+{
+#if (OS_TARGET == OS_WIN)
+    ReleaseSRWLockExclusive(&metrics_shards_lock);
+#else
+    pthread_mutex_unlock(&metrics_shards_lock);
+#endif
+}
+
+
+static uint64_t clock_ns(void)
+{ // Monotonic clock in nanoseconds
+#if (OS_TARGET == OS_WIN)
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)counter.QuadPart/(uint64_t)frequency.QuadPart*1000000000 +
+           (uint64_t)counter.QuadPart%(uint64_t)frequency.QuadPart*1000000000/(uint64_t)frequency.QuadPart;
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000 + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+
+static unsigned int bucket_index(uint64_t value)
+{ // Histogram bucket of a latency value
+    unsigned int msb = 0, shift;
+
+    if (value < (1 << METRICS_SUB_BUCKET_BITS)) {
+        return (unsigned int)value;
+    }
+    if (value >= ((uint64_t)1 << METRICS_MAX_EXPONENT)) {
+        return METRICS_BUCKETS - 1;
+    }
+    for (shift = 32; shift > 0; shift >>= 1) {      // msb = floor(log2(value))
+        if ((value >> (msb + shift)) != 0) {
+            msb += shift;
+        }
+    }
+    shift = msb - (METRICS_SUB_BUCKET_BITS-1);
+    return (shift << (METRICS_SUB_BUCKET_BITS-1)) + (unsigned int)(value >> shift);
+}
+
+
+static void merge_histogram(metrics_histogram_t* s, const metrics_histogram_t* h)
+{ // s = s + h
+    unsigned int j;
+
+    if (h->calls == 0) {
+        return;
+    }
+    if (s->calls == 0 || h->min_ns < s->min_ns) s->min_ns = h->min_ns;
+    if (h->max_ns > s->max_ns) s->max_ns = h->max_ns;
+    s->calls += h->calls;
+    s->failures += h->failures;
+    s->sum_ns += h->sum_ns;
+    for (j = 0; j < METRICS_BUCKETS; j++) {
+        s->buckets[j] += h->buckets[j];
+    }
+}
+
+
+#if (OS_TARGET == OS_WIN)
+static VOID WINAPI retire_shard(PVOID arg)
+#else
+static void retire_shard(void* arg)
+#endif
+{ // Thread destructor: fold the shard of an exiting thread into the retired aggregate, unlink it and free it
+    metrics_shard *shard = (metrics_shard*)arg, **link;
+    unsigned int i;
+
+    if (shard == NULL) {
+        return;
+    }
+    shards_lock();                               // Snapshots and resets only read a shard while holding this lock
+    for (link = &metrics_shards; *link != NULL; link = &(*link)->next) {
+        if (*link == shard) {
+            *link = shard->next;
+            break;
+        }
+    }
+    for (i = 0; i < METRICS_NCALLS; i++) {
+        if (shard->calls[i] != NULL) {
+            merge_histogram(&metrics_retired_calls[i], shard->calls[i]);
+            free(shard->calls[i]);
+        }
+    }
+    for (i = 0; i < METRICS_NEVENTS; i++) {
+        metrics_retired_events[i] += shard->events[i];
+    }
+    shards_unlock();
+
+#if (OS_TARGET != OS_WIN)
+    pthread_mutex_destroy(&shard->lock);
+#endif
+    free(shard);
+    metrics_local = NULL;                        // Calls made by later destructors of this thread start a new shard
+}
+
+
+#if (OS_TARGET == OS_WIN)
+static BOOL CALLBACK create_key(PINIT_ONCE once, PVOID parameter, PVOID* context)
+{
+    (void)once; (void)parameter; (void)context;
+    metrics_key = FlsAlloc(retire_shard);
+    return TRUE;
+}
+#else
+static void create_key(void)
+{
+    metrics_key_valid = (pthread_key_create(&metrics_key, retire_shard) == 0);
+}
+#endif
+
+
+static metrics_shard* local_shard(void)
+{ // Shard of the calling thread, allocated and registered on first use. Returns NULL if out of memory
+  // If no thread destructor can be registered, the shard is kept after its thread exits
+    metrics_shard* shard = metrics_local;
+
+    if (shard != NULL) {
+        return shard;
+    }
+    shard = (metrics_shard*)calloc(1, sizeof(metrics_shard));
+    if (shard == NULL) {
+        return NULL;
+    }
+#if (OS_TARGET == OS_WIN)
+    InitializeSRWLock(&shard->lock);
+#else
+    pthread_mutex_init(&shard->lock, NULL);
+#endif
+    shards_lock();
+    shard->next = metrics_shards;
+    metrics_shards = shard;
+    shards_unlock();
+
+    metrics_local = shard;
+#if (OS_TARGET == OS_WIN)
+    InitOnceExecuteOnce(&metrics_key_once, create_key, NULL, NULL);
+    if (metrics_key != FLS_OUT_OF_INDEXES) {
+        FlsSetValue(metrics_key, shard);
+    }
+#else
+    pthread_once(&metrics_key_once, create_key);
+    if (metrics_key_valid) {
+        pthread_setspecific(metrics_key, shard);
+    }
+#endif
+    return shard;
+}
+
+
+void metrics_begin(metrics_span_t* span, metrics_call_t call)
+{ // Start recording an API call
+    span->call = call;
+    span->tracer = (const metrics_tracer_t*)ATOMIC_LOAD_PTR(metrics_tracer);
+    span->trace = NULL;
+    if (span->tracer != NULL && span->tracer->begin != NULL) {
+        span->trace = span->tracer->begin(call, span->tracer->context);
+    }
+    span->start = clock_ns();
+}
+
+
+void metrics_end(metrics_span_t* span, ECCRYPTO_STATUS status)
+{ // Record the latency and status of an API call in the shard of the calling thread
+    uint64_t latency = clock_ns() - span->start;
+    metrics_shard* shard = local_shard();
+    metrics_histogram_t* h;
+
+    if (shard != NULL) {
+        h = shard->calls[span->call];
+        if (h == NULL) {
+            h = (metrics_histogram_t*)calloc(1, sizeof(metrics_histogram_t));
+        }
+        if (h != NULL) {
+            shard_lock(shard);
+            shard->calls[span->call] = h;
+            if (h->calls == 0 || latency < h->min_ns) h->min_ns = latency;
+            if (latency > h->max_ns) h->max_ns = latency;
+            h->calls++;
+            h->failures += (status != ECCRYPTO_SUCCESS);
+            h->sum_ns += latency;
+            h->buckets[bucket_index(latency)]++;
+            shard_unlock(shard);
+        }
+    }
+
+    if (span->tracer != NULL && span->tracer->end != NULL) {
+        span->tracer->end(span->trace, span->call, status, latency, span->tracer->context);
+    }
+}
+
+
+void metrics_event(metrics_event_t event)
+{ // Count an event in the shard of the calling thread
+    const metrics_tracer_t* tracer = (const metrics_tracer_t*)ATOMIC_LOAD_PTR(metrics_tracer);
+    metrics_shard* shard = local_shard();
+
+    if (shard != NULL) {
+        shard_lock(shard);
+        shard->events[event]++;
+        shard_unlock(shard);
+    }
+
+    if (tracer != NULL && tracer->event != NULL) {
+        tracer->event(event, tracer->context);
+    }
+}
+
+
+ECCRYPTO_STATUS FourQ_MetricsSnapshot(metrics_snapshot_t* Snapshot)
+{ // Snapshot of the metrics aggregated over the shards of all threads
+    metrics_shard* shard;
+    unsigned int i;
+
+    memset(Snapshot, 0, sizeof(metrics_snapshot_t));
+
+    shards_lock();
+    for (i = 0; i < METRICS_NCALLS; i++) {
+        merge_histogram(&Snapshot->calls[i], &metrics_retired_calls[i]);
+    }
+    for (i = 0; i < METRICS_NEVENTS; i++) {
+        Snapshot->events[i] = metrics_retired_events[i];
+    }
+    for (shard = metrics_shards; shard != NULL; shard = shard->next) {
+        shard_lock(shard);
+        for (i = 0; i < METRICS_NCALLS; i++) {
+            if (shard->calls[i] != NULL) {
+                merge_histogram(&Snapshot->calls[i], shard->calls[i]);
+            }
+        }
+        for (i = 0; i < METRICS_NEVENTS; i++) {
+            Snapshot->events[i] += shard->events[i];
+        }
+        shard_unlock(shard);
+    }
+    shards_unlock();
+
+    return ECCRYPTO_SUCCESS;
+}
+
+
+void FourQ_MetricsReset(void)
+{ // Reset the metrics of all threads
+    metrics_shard* shard;
+    unsigned int i;
+
+    shards_lock();
+    memset(metrics_retired_calls, 0, sizeof(metrics_retired_calls));
+    memset(metrics_retired_events, 0, sizeof(metrics_retired_events));
+    for (shard = metrics_shards; shard != NULL; shard = shard->next) {
+        shard_lock(shard);
+        for (i = 0; i < METRICS_NCALLS; i++) {
+            if (shard->calls[i] != NULL) {
+                memset(shard->calls[i], 0, sizeof(metrics_histogram_t));
+            }
+        }
+        memset(shard->events, 0, sizeof(shard->events));
+        shard_unlock(shard);
+    }
+    shards_unlock();
+}
+
+
+ECCRYPTO_STATUS FourQ_SetTracer(const metrics_tracer_t* Tracer)
+{ // Registration of a tracer
+  // Input: Tracer, or NULL to remove the current tracer
+    ATOMIC_STORE_PTR(metrics_tracer, Tracer);
+    return ECCRYPTO_SUCCESS;
+}
+
+
+typedef struct {
+    char* buffer;
+    size_t size, length;
+} text_output;
+
+
+static void append(text_output* out, const char* format, ...)
+{ // snprintf() at the end of the output, counting the characters that do not fit
+    va_list args;
+    int n;
+
+    va_start(args, format);
+    n = vsnprintf((out->length < out->size) ? out->buffer + out->length : NULL, (out->length < out->size) ? out->size - out->length : 0, format, args);
+    va_end(args);
+    if (n > 0) {
+        out->length += (size_t)n;
+    }
+}
+
+
+size_t FourQ_MetricsExport(char* Buffer, size_t Size)
+{ // Export of a snapshot of the metrics in the Prometheus text format
+    static const double quantiles[4] = { 0.5, 0.9, 0.99, 0.999 };
+    metrics_snapshot_t* snapshot;
+    text_output out;
+    unsigned int i, j;
+
+    out.buffer = Buffer;
+    out.size = (Buffer != NULL) ? Size : 0;
+    out.length = 0;
+    if (out.size > 0) {
+        out.buffer[0] = '\0';
+    }
+    snapshot = (metrics_snapshot_t*)malloc(sizeof(metrics_snapshot_t));    // Too large for the stack (about 70KB)
+    if (snapshot == NULL) {
+        return 0;
+    }
+    FourQ_MetricsSnapshot(snapshot);
+
+    append(&out, "# HELP fourq_calls_total Calls to FourQlib API functions.\n# TYPE fourq_calls_total counter\n");
+    for (i = 0; i < METRICS_NCALLS; i++) {
+        append(&out, "fourq_calls_total{call=\"%s\"} %llu\n", metrics_call_names[i], (unsigned long long)snapshot->calls[i].calls);
+    }
+    append(&out, "# HELP fourq_failures_total Calls to FourQlib API functions that did not return ECCRYPTO_SUCCESS.\n# TYPE fourq_failures_total counter\n");
+    for (i = 0; i < METRICS_NCALLS; i++) {
+        append(&out, "fourq_failures_total{call=\"%s\"} %llu\n", metrics_call_names[i], (unsigned long long)snapshot->calls[i].failures);
+    }
+    append(&out, "# HELP fourq_latency_seconds Latency of FourQlib API functions.\n# TYPE fourq_latency_seconds summary\n");
+    for (i = 0; i < METRICS_NCALLS; i++) {
+        const metrics_histogram_t* h = &snapshot->calls[i];
+        if (h->calls == 0) {
+            continue;
+        }
+        for (j = 0; j < 4; j++) {
+            append(&out, "fourq_latency_seconds{call=\"%s\",quantile=\"%g\"} %.9f\n", metrics_call_names[i], quantiles[j], (double)FourQ_MetricsPercentile(h, quantiles[j])*1e-9);
+        }
+        append(&out, "fourq_latency_seconds_sum{call=\"%s\"} %.9f\n", metrics_call_names[i], (double)h->sum_ns*1e-9);
+        append(&out, "fourq_latency_seconds_count{call=\"%s\"} %llu\n", metrics_call_names[i], (unsigned long long)h->calls);
+    }
+    append(&out, "# HELP fourq_events_total Invalid inputs detected by FourQlib.\n# TYPE fourq_events_total counter\n");
+    for (i = 0; i < METRICS_NEVENTS; i++) {
+        append(&out, "fourq_events_total{event=\"%s\"} %llu\n", metrics_event_names[i], (unsigned long long)snapshot->events[i]);
+    }
+
+    free(snapshot);
+    return out.length;
+}
+
+#else
+
+ECCRYPTO_STATUS FourQ_MetricsSnapshot(metrics_snapshot_t* Snapshot)
+{ // Metrics are not recorded without FOURQ_METRICS
+    memset(Snapshot, 0, sizeof(metrics_snapshot_t));
+    return ECCRYPTO_ERROR_NOT_IMPLEMENTED;
+}
+
+
+void FourQ_MetricsReset(void)
+{
+}
+
+
+ECCRYPTO_STATUS FourQ_SetTracer(const metrics_tracer_t* Tracer)
+{
+    (void)Tracer;
+    return ECCRYPTO_ERROR_NOT_IMPLEMENTED;
+}
+
+
+size_t FourQ_MetricsExport(char* Buffer, size_t Size)
+{
+    if (Buffer != NULL && Size > 0) {
+        Buffer[0] = '\0';
+    }
+    return 0;
+}
+
+#endif
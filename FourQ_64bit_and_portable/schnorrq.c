@@ -13,11 +13,49 @@
 #include "FourQ_internal.h"
 #include "FourQ_params.h"
 #include "../random/random.h"
-#include "../sha512/sha512.h"
-#include <malloc.h>
 #include <string.h>
 
 
+static ECCRYPTO_STATUS nonce_hash(const hash_provider_t* Provider, const unsigned char* Key, const unsigned char* Message, const unsigned int SizeMessage, unsigned char* r)
+{ // Nonce r = H(Key || Message), where Key is the upper 32 bytes of the hashed secret key
+    hash_ctx_t ctx;
+    int error;
+
+    error  = Provider->init(&ctx);
+    error |= Provider->update(&ctx, Key, 32);
+    error |= Provider->update(&ctx, Message, SizeMessage);
+    error |= Provider->final(&ctx, r);
+    clear_words((unsigned int*)&ctx, sizeof(hash_ctx_t)/sizeof(unsigned int));
+
+    return (error == 0) ? ECCRYPTO_SUCCESS : ECCRYPTO_ERROR;
+}
+
+
+static ECCRYPTO_STATUS challenge_hash(const hash_provider_t* Provider, const unsigned char* R, const unsigned char* PublicKey, const unsigned char* Message, const unsigned int SizeMessage, unsigned char* h)
+{ // Challenge h = H(R || PublicKey || Message)
+  // Providers other than SHA-512 first hash the domain separator "FourQ-SchnorrQ-H" || ID, with the 4-byte provider ID in big-endian order
+    hash_ctx_t ctx;
+    unsigned char domain[20];
+    int error;
+
+    error = Provider->init(&ctx);
+    if (Provider->id != HASH_PROVIDER_SHA512) {
+        memmove(domain, "FourQ-SchnorrQ-H", 16);
+        domain[16] = (unsigned char)(Provider->id >> 24);
+        domain[17] = (unsigned char)(Provider->id >> 16);
+        domain[18] = (unsigned char)(Provider->id >> 8);
+        domain[19] = (unsigned char)Provider->id;
+        error |= Provider->update(&ctx, domain, 20);
+    }
+    error |= Provider->update(&ctx, R, 32);
+    error |= Provider->update(&ctx, PublicKey, 32);
+    error |= Provider->update(&ctx, Message, SizeMessage);
+    error |= Provider->final(&ctx, h);
+
+    return (error == 0) ? ECCRYPTO_SUCCESS : ECCRYPTO_ERROR;
+}
+
+
 ECCRYPTO_STATUS SchnorrQ_KeyGeneration(const unsigned char* SecretKey, unsigned char* PublicKey)
 { // SchnorrQ public key generation
   // It produces a public key PublicKey, which is the encoding of P = s*G, where G is the generator and
@@ -27,22 +65,26 @@ ECCRYPTO_STATUS SchnorrQ_KeyGeneration(const unsigned char* SecretKey, unsigned
     point_t P;
     unsigned char k[64];
     ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+    METRICS_BEGIN(METRICS_SCHNORRQ_KEYGENERATION);
   
-    if (CryptoHashFunction(SecretKey, 32, k) != 0) {   
+    if (FourQ_GetHashProvider()->hash(SecretKey, 32, k) != 0) {   
         Status = ECCRYPTO_ERROR;
         goto cleanup;
     }
     
-    ecc_mul_fixed((digit_t*)k, P);          // Compute public key                                       
+    if (ecc_mul_fixed((digit_t*)k, P) == false) {   // Compute public key
+        Status = ECCRYPTO_ERROR;
+        goto cleanup;
+    }
 	encode(P, PublicKey);                   // Encode public key
 
-    return ECCRYPTO_SUCCESS;
+    METRICS_RETURN(ECCRYPTO_SUCCESS);
 
 cleanup:
 	clear_words((unsigned int*)k, 512/(sizeof(unsigned int)*8));
     clear_words((unsigned int*)PublicKey, 256/(sizeof(unsigned int)*8));
 
-    return Status;
+    METRICS_RETURN(Status);
 }
 
 
@@ -52,6 +94,7 @@ ECCRYPTO_STATUS SchnorrQ_FullKeyGeneration(unsigned char* SecretKey, unsigned ch
   // where G is the generator and s is the output of hashing SecretKey and taking the least significant 32 bytes of the result.
   // Outputs: 32-byte SecretKey and 32-byte PublicKey
     ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+    METRICS_BEGIN(METRICS_SCHNORRQ_FULLKEYGENERATION);
 
 	Status = RandomBytesFunction(SecretKey, 32);
     if (Status != ECCRYPTO_SUCCESS) {
@@ -63,13 +106,13 @@ ECCRYPTO_STATUS SchnorrQ_FullKeyGeneration(unsigned char* SecretKey, unsigned ch
         goto cleanup;
     }
 
-    return ECCRYPTO_SUCCESS;
+    METRICS_RETURN(ECCRYPTO_SUCCESS);
 
 cleanup:
     clear_words((unsigned int*)SecretKey, 256/(sizeof(unsigned int)*8));
     clear_words((unsigned int*)PublicKey, 256/(sizeof(unsigned int)*8));
 
-    return Status;
+    METRICS_RETURN(Status);
 }
 
 
@@ -79,37 +122,31 @@ ECCRYPTO_STATUS SchnorrQ_Sign(const unsigned char* SecretKey, const unsigned cha
   // Inputs: 32-byte SecretKey, 32-byte PublicKey, and Message of size SizeMessage in bytes
   // Output: 64-byte Signature 
     point_t R;
-    unsigned char k[64], r[64], h[64], *temp = NULL;
+    unsigned char k[64], r[64], h[64];
 	digit_t* H = (digit_t*)h;
     digit_t* S = (digit_t*)(Signature+32);
+    const hash_provider_t* Provider = FourQ_GetHashProvider();
     ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+    METRICS_BEGIN(METRICS_SCHNORRQ_SIGN);
       
-    if (CryptoHashFunction(SecretKey, 32, k) != 0) {   
+    if (Provider->hash(SecretKey, 32, k) != 0) {   
         Status = ECCRYPTO_ERROR;
         goto cleanup;
     }
-    
-    temp = (unsigned char*)calloc(1, SizeMessage+64);
-    if (temp == NULL) {
-		Status = ECCRYPTO_ERROR_NO_MEMORY;
+  
+    Status = nonce_hash(Provider, k+32, Message, SizeMessage, r);
+    if (Status != ECCRYPTO_SUCCESS) {   
         goto cleanup;
     }
     
-    memmove(temp+32, k+32, 32);
-    memmove(temp+64, Message, SizeMessage);
-  
-    if (CryptoHashFunction(temp+32, SizeMessage+32, r) != 0) {   
+    if (ecc_mul_fixed((digit_t*)r, R) == false) {
         Status = ECCRYPTO_ERROR;
         goto cleanup;
     }
-    
-    ecc_mul_fixed((digit_t*)r, R); 
     encode(R, Signature);                   // Encode lowest 32 bytes of signature
-    memmove(temp, Signature, 32);
-    memmove(temp+32, PublicKey, 32);
   
-    if (CryptoHashFunction(temp, SizeMessage+64, h) != 0) {   
-        Status = ECCRYPTO_ERROR;
+    Status = challenge_hash(Provider, Signature, PublicKey, Message, SizeMessage, h);
+    if (Status != ECCRYPTO_SUCCESS) {   
         goto cleanup;
     }	
     modulo_order((digit_t*)r, (digit_t*)r);
@@ -122,12 +159,10 @@ ECCRYPTO_STATUS SchnorrQ_Sign(const unsigned char* SecretKey, const unsigned cha
 	Status = ECCRYPTO_SUCCESS;
     
 cleanup:
-	if (temp != NULL)
-		free(temp);
     clear_words((unsigned int*)k, 512/(sizeof(unsigned int)*8));
 	clear_words((unsigned int*)r, 512/(sizeof(unsigned int)*8));
     
-    return Status;
+    METRICS_RETURN(Status);
 }
 
 
@@ -137,18 +172,13 @@ ECCRYPTO_STATUS SchnorrQ_Verify(const unsigned char* PublicKey, const unsigned c
   // Inputs: 32-byte PublicKey, 64-byte Signature, and Message of size SizeMessage in bytes
   // Output: true (valid signature) or false (invalid signature)
     point_t A;
-    unsigned char *temp, h[64];
+    unsigned char h[64];
     unsigned int i;
     ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;  
+    METRICS_BEGIN(METRICS_SCHNORRQ_VERIFY);
 
     *valid = false;
 
-	temp = (unsigned char*)calloc(1, SizeMessage+64);
-	if (temp == NULL) {
-		Status = ECCRYPTO_ERROR_NO_MEMORY;
-		goto cleanup;
-	}
-
     if (((PublicKey[15] & 0x80) != 0) || ((Signature[15] & 0x80) != 0) || (Signature[63] != 0) || ((Signature[62] & 0xC0) != 0)) {  // Are bit128(PublicKey) = bit128(Signature) = 0 and Signature+32 < 2^246?
 		Status = ECCRYPTO_ERROR_INVALID_PARAMETER;
 		goto cleanup;
@@ -159,12 +189,8 @@ ECCRYPTO_STATUS SchnorrQ_Verify(const unsigned char* PublicKey, const unsigned c
         goto cleanup;                            
     }
 
-    memmove(temp, Signature, 32);
-    memmove(temp+32, PublicKey, 32);
-    memmove(temp+64, Message, SizeMessage);
-  
-    if (CryptoHashFunction(temp, SizeMessage+64, h) != 0) {   
-        Status = ECCRYPTO_ERROR;
+    Status = challenge_hash(FourQ_GetHashProvider(), Signature, PublicKey, Message, SizeMessage, h);
+    if (Status != ECCRYPTO_SUCCESS) {   
         goto cleanup;
     }
 
@@ -183,8 +209,78 @@ ECCRYPTO_STATUS SchnorrQ_Verify(const unsigned char* PublicKey, const unsigned c
     *valid = true;
 
 cleanup:
-	if (temp != NULL)
-		free(temp);
-    
-    return Status;
+    if (*valid == false) {
+        METRICS_EVENT(METRICS_VERIFICATION_FAILURE);
+    }
+    METRICS_RETURN(Status);
+}
+
+ECCRYPTO_STATUS SchnorrQ_VerifyBatch(const unsigned char** PublicKeys, const unsigned char** Messages, const unsigned int* SizeMessages, const unsigned char** Signatures, const unsigned int NumSignatures, unsigned int* valid)
+{ // Batched SchnorrQ signature verification
+  // It verifies the signatures Signatures[i] of the messages Messages[i] of size SizeMessages[i] in bytes, for i = 0,...,NumSignatures-1
+  // Inputs: 32-byte PublicKeys[i], 64-byte Signatures[i], and Messages[i] of size SizeMessages[i] in bytes
+  // Output: valid[i] = true (valid signature) or false (invalid signature)
+  // Malformed public keys or signatures are reported as invalid. The items are verified X8_LANES at a time with ecc_mul_double_batch(), 
+  // using the generator and zero scalars in the lanes of malformed items. On error, all outputs are false.
+    point_affine A[X8_LANES];
+    digit_t s[X8_LANES*NWORDS_ORDER], h[X8_LANES*NWORDS_ORDER];
+    unsigned char hash[64], encoded[32];
+    unsigned int i, j, n, ok[X8_LANES];
+    const hash_provider_t* Provider = FourQ_GetHashProvider();
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+    METRICS_BEGIN(METRICS_SCHNORRQ_VERIFYBATCH);
+
+    for (i = 0; i < NumSignatures; i++) {
+        valid[i] = false;
+    }
+
+    for (i = 0; i < NumSignatures; i += n) {
+        n = (NumSignatures-i < X8_LANES) ? (NumSignatures-i) : X8_LANES;
+
+        for (j = 0; j < n; j++) {
+            const unsigned char *PublicKey = PublicKeys[i+j], *Signature = Signatures[i+j];
+
+            ok[j] = false;
+            eccset(&A[j]);
+            memset(s + j*NWORDS_ORDER, 0, 32);
+            memset(h + j*NWORDS_ORDER, 0, 32);
+            if (((PublicKey[15] & 0x80) != 0) || ((Signature[15] & 0x80) != 0) || (Signature[63] != 0) || ((Signature[62] & 0xC0) != 0)) {  // Are bit128(PublicKey) = bit128(Signature) = 0 and Signature+32 < 2^246?
+                continue;
+            }
+            if (decode(PublicKey, &A[j]) != ECCRYPTO_SUCCESS) {    // Also verifies that A is on the curve
+                eccset(&A[j]);
+                continue;
+            }
+
+            Status = challenge_hash(Provider, Signature, PublicKey, Messages[i+j], SizeMessages[i+j], hash);
+            if (Status != ECCRYPTO_SUCCESS) {
+                goto cleanup;
+            }
+            memmove(s + j*NWORDS_ORDER, Signature+32, 32);
+            memmove(h + j*NWORDS_ORDER, hash, 32);
+            ok[j] = true;
+        }
+
+        if (ecc_mul_double_batch(s, A, h, A, n) == false) {
+            Status = ECCRYPTO_ERROR;
+            goto cleanup;
+        }
+
+        for (j = 0; j < n; j++) {
+            encode(&A[j], encoded);
+            valid[i+j] = ok[j] && (memcmp(encoded, Signatures[i+j], 32) == 0);
+            if (valid[i+j] == false) {
+                METRICS_EVENT(METRICS_VERIFICATION_FAILURE);
+            }
+        }
+    }
+
+cleanup:
+    if (Status != ECCRYPTO_SUCCESS) {
+        for (i = 0; i < NumSignatures; i++) {
+            valid[i] = false;
+        }
+    }
+
+    METRICS_RETURN(Status);
 }
\ No newline at end of file
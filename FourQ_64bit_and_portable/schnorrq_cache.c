@@ -0,0 +1,354 @@
+/**********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: cache of verified SchnorrQ signatures
+*
+* Tuples (PublicKey, Message, Signature) that passed SchnorrQ_Verify() are
+* remembered in a sharded, lock-striped LRU table so that repeated verifications
+* of the same tuple cost one hash computation and a table lookup.
+***********************************************************************************/
+
+#include "FourQ_internal.h"
+#include "../random/random.h"
+#include <stdlib.h>
+#include <string.h>
+#if (OS_TARGET == OS_WIN)
+    #include <windows.h>
+#else
+    #include <pthread.h>
+#endif
+
+
+#define CACHE_SHARDS        16                   // Number of independently locked shards (power of 2)
+#define CACHE_TAG_BYTES     64                   // Size of the tag identifying a verified tuple
+#define CACHE_SALT_BYTES    32                   // Size of the secret salt used to derive tags
+#define CACHE_NULL          0xFFFFFFFF           // Null index
+
+typedef struct {
+    unsigned char tag[CACHE_TAG_BYTES];          // H(salt || ID || PublicKey || Signature || Message)
+    uint32_t chain;                              // Next entry in the same bucket
+    uint32_t prev, next;                         // Neighbors in the LRU list
+} cache_entry;
+
+typedef struct {
+#if (OS_TARGET == OS_WIN)
+    CRITICAL_SECTION lock;
+#else
+    pthread_mutex_t lock;
+#endif
+    cache_entry* entries;
+    uint32_t* buckets;
+    uint32_t nentries, nbuckets, used;
+    uint32_t head, tail;                         // Most and least recently used entries
+    uint64_t hits, misses;
+} cache_shard;
+
+struct SchnorrQ_cache {
+    unsigned char salt[CACHE_SALT_BYTES];
+    cache_shard shards[CACHE_SHARDS];
+};
+
+
+static __inline void shard_lock(cache_shard* shard)
+{
+#if (OS_TARGET == OS_WIN)
+    EnterCriticalSection(&shard->lock);
+#else
+    pthread_mutex_lock(&shard->lock);
+#endif
+}
+
+
+static __inline void shard_unlock(cache_shard* shard)
+{
+#if (OS_TARGET == OS_WIN)
+    LeaveCriticalSection(&shard->lock);
+#else
+    pthread_mutex_unlock(&shard->lock);
+#endif
+}
+
+
+static __inline unsigned int tag_compare_ct(const unsigned char* a, const unsigned char* b)
+{ // Constant-time tag comparison. Returns 1 (TRUE) if the tags are equal, 0 (FALSE) otherwise
+    unsigned int i;
+    unsigned char x = 0;
+
+    for (i = 0; i < CACHE_TAG_BYTES; i++) {
+        x |= a[i] ^ b[i];
+    }
+    return (unsigned int)(1 ^ (((unsigned int)x | (0 - (unsigned int)x)) >> (8*sizeof(unsigned int)-1)));
+}
+
+
+static __inline uint32_t tag_bucket(const unsigned char* tag, uint32_t nbuckets)
+{ // Bucket index of a tag. Tags are salted hash outputs, so any slice of them is uniformly distributed
+    uint32_t index;
+
+    memmove(&index, tag+4, sizeof(uint32_t));
+    return index & (nbuckets-1);
+}
+
+
+static void lru_unlink(cache_shard* shard, uint32_t i)
+{ // Remove entry i from the LRU list
+    cache_entry* e = &shard->entries[i];
+
+    if (e->prev != CACHE_NULL) shard->entries[e->prev].next = e->next;
+    else shard->head = e->next;
+    if (e->next != CACHE_NULL) shard->entries[e->next].prev = e->prev;
+    else shard->tail = e->prev;
+}
+
+
+static void lru_push_front(cache_shard* shard, uint32_t i)
+{ // Insert entry i as the most recently used one
+    cache_entry* e = &shard->entries[i];
+
+    e->prev = CACHE_NULL;
+    e->next = shard->head;
+    if (shard->head != CACHE_NULL) shard->entries[shard->head].prev = i;
+    shard->head = i;
+    if (shard->tail == CACHE_NULL) shard->tail = i;
+}
+
+
+static uint32_t shard_find(cache_shard* shard, const unsigned char* tag)
+{ // Look up a tag in a shard. Every entry in the bucket is compared in full using constant-time comparisons
+    uint32_t i, found = CACHE_NULL;
+
+    for (i = shard->buckets[tag_bucket(tag, shard->nbuckets)]; i != CACHE_NULL; i = shard->entries[i].chain) {
+        if (tag_compare_ct(shard->entries[i].tag, tag) == 1) {
+            found = i;
+        }
+    }
+    return found;
+}
+
+
+static void shard_evict(cache_shard* shard, uint32_t i)
+{ // Remove entry i from its bucket chain and from the LRU list
+    uint32_t* link = &shard->buckets[tag_bucket(shard->entries[i].tag, shard->nbuckets)];
+
+    while (*link != i) {
+        link = &shard->entries[*link].chain;
+    }
+    *link = shard->entries[i].chain;
+    lru_unlink(shard, i);
+}
+
+
+static void shard_insert(cache_shard* shard, const unsigned char* tag)
+{ // Insert a tag, evicting the least recently used entry if the shard is full
+    uint32_t i, bucket;
+
+    if (shard_find(shard, tag) != CACHE_NULL) {
+        return;
+    }
+    if (shard->used < shard->nentries) {
+        i = shard->used++;
+    } else {
+        i = shard->tail;
+        shard_evict(shard, i);
+    }
+    memmove(shard->entries[i].tag, tag, CACHE_TAG_BYTES);
+    bucket = tag_bucket(tag, shard->nbuckets);
+    shard->entries[i].chain = shard->buckets[bucket];
+    shard->buckets[bucket] = i;
+    lru_push_front(shard, i);
+}
+
+
+static ECCRYPTO_STATUS compute_tag(SchnorrQ_cache_t* Cache, const unsigned char* PublicKey, const unsigned char* Message, const unsigned int SizeMessage, const unsigned char* Signature, unsigned char* tag)
+{ // Tag of a tuple, tag = H(salt || ID || PublicKey || Signature || Message), where H is the current hash provider and ID its 4-byte identifier.
+  // Tuples verified with different providers get different tags
+    const hash_provider_t* Provider = FourQ_GetHashProvider();
+    hash_ctx_t ctx;
+    unsigned char id[4];
+    int error;
+
+    id[0] = (unsigned char)(Provider->id >> 24);
+    id[1] = (unsigned char)(Provider->id >> 16);
+    id[2] = (unsigned char)(Provider->id >> 8);
+    id[3] = (unsigned char)Provider->id;
+
+    error  = Provider->init(&ctx);
+    error |= Provider->update(&ctx, Cache->salt, CACHE_SALT_BYTES);
+    error |= Provider->update(&ctx, id, 4);
+    error |= Provider->update(&ctx, PublicKey, 32);
+    error |= Provider->update(&ctx, Signature, 64);
+    error |= Provider->update(&ctx, Message, SizeMessage);
+    error |= Provider->final(&ctx, tag);
+    clear_words((unsigned int*)&ctx, sizeof(hash_ctx_t)/sizeof(unsigned int));
+
+    return (error == 0) ? ECCRYPTO_SUCCESS : ECCRYPTO_ERROR;
+}
+
+
+ECCRYPTO_STATUS SchnorrQ_CacheCreate(const size_t MaxMemory, SchnorrQ_cache_t** Cache)
+{ // Creation of a cache of verified SchnorrQ signatures
+  // The number of cached tuples is derived from the memory budget MaxMemory (in bytes), which covers all the cache storage
+  // Input:  MaxMemory
+  // Output: Cache, which must be released with SchnorrQ_CacheDestroy()
+    SchnorrQ_cache_t* cache;
+    size_t budget, per_entry = sizeof(cache_entry) + sizeof(uint32_t);
+    uint32_t i, j, nentries, nbuckets;
+    ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+
+    *Cache = NULL;
+    if (MaxMemory <= sizeof(SchnorrQ_cache_t)) {
+        return ECCRYPTO_ERROR_INVALID_PARAMETER;
+    }
+    budget = (MaxMemory - sizeof(SchnorrQ_cache_t))/CACHE_SHARDS;
+    if (budget/per_entry > (size_t)(CACHE_NULL/2)) {
+        budget = (size_t)(CACHE_NULL/2)*per_entry;
+    }
+    nbuckets = 1;                                 // One bucket per entry at most, rounded down to a power of 2
+    while ((size_t)(2*nbuckets)*per_entry <= budget) {
+        nbuckets *= 2;
+    }
+    if (budget < nbuckets*sizeof(uint32_t) + sizeof(cache_entry)) {      // Not even one entry per shard
+        return ECCRYPTO_ERROR_INVALID_PARAMETER;
+    }
+    nentries = (uint32_t)((budget - nbuckets*sizeof(uint32_t))/sizeof(cache_entry));
+
+    cache = (SchnorrQ_cache_t*)calloc(1, sizeof(SchnorrQ_cache_t));
+    if (cache == NULL) {
+        return ECCRYPTO_ERROR_NO_MEMORY;
+    }
+
+    Status = RandomBytesFunction(cache->salt, CACHE_SALT_BYTES);
+    if (Status != ECCRYPTO_SUCCESS) {
+        free(cache);
+        return Status;
+    }
+
+    for (i = 0; i < CACHE_SHARDS; i++) {
+        cache_shard* shard = &cache->shards[i];
+        shard->entries = (cache_entry*)calloc(nentries, sizeof(cache_entry));
+        shard->buckets = (uint32_t*)malloc(nbuckets*sizeof(uint32_t));
+        if (shard->entries == NULL || shard->buckets == NULL) {
+            free(shard->entries);
+            free(shard->buckets);
+            for (j = 0; j < i; j++) {
+                free(cache->shards[j].entries);
+                free(cache->shards[j].buckets);
+#if (OS_TARGET == OS_WIN)
+                DeleteCriticalSection(&cache->shards[j].lock);
+#else
+                pthread_mutex_destroy(&cache->shards[j].lock);
+#endif
+            }
+            clear_words((void*)cache->salt, CACHE_SALT_BYTES/sizeof(unsigned int));
+            free(cache);
+            return ECCRYPTO_ERROR_NO_MEMORY;
+        }
+        for (j = 0; j < nbuckets; j++) {
+            shard->buckets[j] = CACHE_NULL;
+        }
+        shard->nentries = nentries;
+        shard->nbuckets = nbuckets;
+        shard->head = shard->tail = CACHE_NULL;
+#if (OS_TARGET == OS_WIN)
+        InitializeCriticalSection(&shard->lock);
+#else
+        pthread_mutex_init(&shard->lock, NULL);
+#endif
+    }
+
+    *Cache = cache;
+    return ECCRYPTO_SUCCESS;
+}
+
+
+void SchnorrQ_CacheDestroy(SchnorrQ_cache_t* Cache)
+{ // Release a cache of verified SchnorrQ signatures. Cached tags and the salt are cleared before releasing memory
+    unsigned int i;
+
+    if (Cache == NULL) {
+        return;
+    }
+    for (i = 0; i < CACHE_SHARDS; i++) {
+        cache_shard* shard = &Cache->shards[i];
+        clear_words((void*)shard->entries, (unsigned int)(shard->nentries*sizeof(cache_entry)/sizeof(unsigned int)));
+        free(shard->entries);
+        free(shard->buckets);
+#if (OS_TARGET == OS_WIN)
+        DeleteCriticalSection(&shard->lock);
+#else
+        pthread_mutex_destroy(&shard->lock);
+#endif
+    }
+    clear_words((void*)Cache->salt, CACHE_SALT_BYTES/sizeof(unsigned int));
+    free(Cache);
+}
+
+
+ECCRYPTO_STATUS SchnorrQ_VerifyCached(SchnorrQ_cache_t* Cache, const unsigned char* PublicKey, const unsigned char* Message, const unsigned int SizeMessage, const unsigned char* Signature, unsigned int* valid)
+{ // SchnorrQ signature verification using a cache of previously verified signatures
+  // A tuple found in the cache is accepted without recomputation; otherwise the signature is verified with SchnorrQ_Verify()
+  // and, if valid, inserted in the cache. Only valid signatures are cached. If Cache = NULL this function is equivalent to SchnorrQ_Verify().
+  // Inputs: Cache, 32-byte PublicKey, 64-byte Signature, and Message of size SizeMessage in bytes
+  // Output: true (valid signature) or false (invalid signature)
+    unsigned char tag[CACHE_TAG_BYTES];
+    cache_shard* shard;
+    uint32_t i;
+    ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+    METRICS_BEGIN(METRICS_SCHNORRQ_VERIFYCACHED);
+
+    if (Cache == NULL) {
+        METRICS_RETURN(SchnorrQ_Verify(PublicKey, Message, SizeMessage, Signature, valid));
+    }
+    *valid = false;
+
+    Status = compute_tag(Cache, PublicKey, Message, SizeMessage, Signature, tag);
+    if (Status != ECCRYPTO_SUCCESS) {
+        METRICS_RETURN(Status);
+    }
+    shard = &Cache->shards[tag[0] & (CACHE_SHARDS-1)];
+
+    shard_lock(shard);
+    i = shard_find(shard, tag);
+    if (i != CACHE_NULL) {
+        lru_unlink(shard, i);
+        lru_push_front(shard, i);
+        shard->hits++;
+        shard_unlock(shard);
+        *valid = true;
+        METRICS_RETURN(ECCRYPTO_SUCCESS);
+    }
+    shard->misses++;
+    shard_unlock(shard);
+
+    Status = SchnorrQ_Verify(PublicKey, Message, SizeMessage, Signature, valid);
+    if (Status == ECCRYPTO_SUCCESS && *valid == true) {
+        shard_lock(shard);
+        shard_insert(shard, tag);
+        shard_unlock(shard);
+    }
+
+    METRICS_RETURN(Status);
+}
+
+
+void SchnorrQ_CacheStatistics(SchnorrQ_cache_t* Cache, uint64_t* Hits, uint64_t* Misses, uint64_t* Entries)
+{ // Hit/miss counters and current number of cached tuples
+  // Input:  Cache
+  // Output: Hits, Misses and Entries (number of cached tuples)
+    unsigned int i;
+
+    *Hits = 0; *Misses = 0; *Entries = 0;
+    if (Cache == NULL) {
+        return;
+    }
+    for (i = 0; i < CACHE_SHARDS; i++) {
+        cache_shard* shard = &Cache->shards[i];
+        shard_lock(shard);
+        *Hits += shard->hits;
+        *Misses += shard->misses;
+        *Entries += shard->used;
+        shard_unlock(shard);
+    }
+}
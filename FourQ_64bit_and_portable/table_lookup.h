@@ -26,6 +26,7 @@ void table_lookup_1x8(point_extproj_precomp_t* table, point_extproj_precomp_t P,
 { // Constant-time table lookup to extract a point represented as (X+Y,Y-X,2Z,2dT) corresponding to extended twisted Edwards coordinates (X:Y:Z:T)
   // Inputs: sign_mask, digit, table containing 8 points
   // Output: P = sign*table[digit], where sign=1 if sign_mask=0xFF...FF and sign=-1 if sign_mask=0
+    COUNT_OP(table_lookup_1x8);
 
 #if (SIMD_SUPPORT == AVX2_SUPPORT)  
 #if defined(ASM_SUPPORT)
@@ -159,10 +160,124 @@ void table_lookup_1x8(point_extproj_precomp_t* table, point_extproj_precomp_t P,
 }
 
 
-void table_lookup_fixed_base(point_precomp_t* table, point_precomp_t P, unsigned int digit, unsigned int sign)
+#if defined(COMPACT_TABLES)
+
+static __inline void eccprecomp_t2(point_precomp_t P)
+{ // Recomputation of the coordinate 2dt of P = (x+y,y-x,2dt) from x+y and y-x, using 2dt = d*(2y)*(2x)/2
+    f2elm_t t;
+
+    fp2add1271(P->xy, P->yx, t);                        // t = 2y
+    fp2sub1271(P->xy, P->yx, P->t2);                    // 2dt = 2x
+    fp2mul1271(P->t2, t, P->t2);                        // 2dt = 4xy
+    fp2mul1271(P->t2, (felm_t*)&PARAMETER_d, P->t2);    // 2dt = 4dxy
+    fpdiv1271(P->t2[0]);                                // 2dt = 2dxy
+    fpdiv1271(P->t2[1]);
+}
+
+
+void table_lookup_fixed_base(point_table_t* table, point_precomp_t P, unsigned int digit, unsigned int sign)
+{ // Constant-time table lookup to extract a point represented as (x+y,y-x,2t) corresponding to extended twisted Edwards coordinates (X:Y:Z:T) with Z=1
+  // Inputs: sign, digit, table containing VPOINTS_FIXEDBASE = 2^(W_FIXEDBASE-1) points in compact representation (x+y,y-x)
+  // Output: if sign=0 then P = table[digit], else if (sign=-1) then P = -table[digit]
+  // Only two coordinates are scanned. Negation swaps them, so that the recomputed 2dt gets the right sign.
+    COUNT_OP(table_lookup_fixed_base);
+
+#if (SIMD_SUPPORT == AVX2_SUPPORT)
+    __m256i point[2], temp_point[2], full_mask; 
+    unsigned int i;
+    int mask;
+    
+    point[0] = _mm256_loadu_si256((__m256i*)table[0]->xy);                  // point = table[0] 
+    point[1] = _mm256_loadu_si256((__m256i*)table[0]->yx);  
+
+    for (i = 1; i < VPOINTS_FIXEDBASE; i++) 
+    { 
+        digit--;
+        // While digit>=0 mask = 0xFF...F else sign = 0x00...0
+        mask = (int)(digit >> (8*sizeof(digit)-1)) - 1;
+        temp_point[0] = _mm256_loadu_si256((__m256i*)table[i]->xy);         // temp_point = table[i]
+        temp_point[1] = _mm256_loadu_si256((__m256i*)table[i]->yx);
+        // If mask = 0x00...0 then point = point, else if mask = 0xFF...F then point = temp_point
+        full_mask = _mm256_set1_epi32(mask);
+        temp_point[0] = _mm256_xor_si256(point[0], temp_point[0]);
+        temp_point[1] = _mm256_xor_si256(point[1], temp_point[1]);
+        point[0] = _mm256_xor_si256(_mm256_and_si256(temp_point[0], full_mask), point[0]);
+        point[1] = _mm256_xor_si256(_mm256_and_si256(temp_point[1], full_mask), point[1]);
+    }
+
+    full_mask = _mm256_set1_epi32((int)sign);                               // If sign = 0xFF...F then swap x+y and y-x
+    temp_point[0] = _mm256_and_si256(_mm256_xor_si256(point[0], point[1]), full_mask);
+    point[0] = _mm256_xor_si256(point[0], temp_point[0]);
+    point[1] = _mm256_xor_si256(point[1], temp_point[0]);
+    _mm256_storeu_si256((__m256i*)P->xy, point[0]);    
+    _mm256_storeu_si256((__m256i*)P->yx, point[1]);     
+
+#elif (SIMD_SUPPORT >= AVX_SUPPORT)
+    __m256d point[2], temp_point[2], full_mask; 
+    unsigned int i;
+    int mask;
+
+    point[0] = _mm256_loadu_pd((double const*)table[0]->xy);                // point = table[0] 
+    point[1] = _mm256_loadu_pd((double const*)table[0]->yx);  
+
+    for (i = 1; i < VPOINTS_FIXEDBASE; i++) 
+    { 
+        digit--;
+        // While digit>=0 mask = 0xFF...F else sign = 0x00...0
+        mask = (int)(digit >> (8*sizeof(digit)-1)) - 1;
+        full_mask = _mm256_set1_pd((double)mask);
+        temp_point[0] = _mm256_loadu_pd((double const*)table[i]->xy);       // temp_point = table[i]
+        temp_point[1] = _mm256_loadu_pd((double const*)table[i]->yx);
+        // If mask = 0x00...0 then point = point, else if mask = 0xFF...F then point = temp_point
+        point[0] = _mm256_blendv_pd(point[0], temp_point[0], full_mask);     
+        point[1] = _mm256_blendv_pd(point[1], temp_point[1], full_mask);    
+    }
+
+    full_mask = _mm256_set1_pd((double)((int)sign));                        // If sign = 0xFF...F then swap x+y and y-x
+    temp_point[0] = _mm256_blendv_pd(point[0], point[1], full_mask);
+    temp_point[1] = _mm256_blendv_pd(point[1], point[0], full_mask);
+    _mm256_storeu_pd((double*)P->xy, temp_point[0]); 
+    _mm256_storeu_pd((double*)P->yx, temp_point[1]); 
+#else
+    unsigned int i, j;
+    digit_t mask, swap;
+                                   
+    fp2copy1271(table[0]->xy, P->xy);                                       // P = table[0]
+    fp2copy1271(table[0]->yx, P->yx);
+
+    for (i = 1; i < VPOINTS_FIXEDBASE; i++)
+    {
+        digit--;
+        // While digit>=0 mask = 0xFF...F else sign = 0x00...0
+        mask = (digit_t)(digit >> (8*sizeof(digit)-1)) - 1;
+        // If mask = 0x00...0 then P = P, else if mask = 0xFF...F then P = table[i]
+        for (j = 0; j < NWORDS_FIELD; j++) {
+            P->xy[0][j] = (mask & (P->xy[0][j] ^ table[i]->xy[0][j])) ^ P->xy[0][j];
+            P->xy[1][j] = (mask & (P->xy[1][j] ^ table[i]->xy[1][j])) ^ P->xy[1][j];
+            P->yx[0][j] = (mask & (P->yx[0][j] ^ table[i]->yx[0][j])) ^ P->yx[0][j];
+            P->yx[1][j] = (mask & (P->yx[1][j] ^ table[i]->yx[1][j])) ^ P->yx[1][j];
+        }
+    }
+    
+    for (j = 0; j < NWORDS_FIELD; j++) {                                     // If sign = 0xFF...F then swap x+y and y-x
+        swap = (digit_t)((int)sign) & (P->xy[0][j] ^ P->yx[0][j]);
+        P->xy[0][j] ^= swap;
+        P->yx[0][j] ^= swap;
+        swap = (digit_t)((int)sign) & (P->xy[1][j] ^ P->yx[1][j]);
+        P->xy[1][j] ^= swap;
+        P->yx[1][j] ^= swap;
+    }                                  
+#endif
+    eccprecomp_t2(P);
+}
+
+#else
+
+void table_lookup_fixed_base(point_table_t* table, point_precomp_t P, unsigned int digit, unsigned int sign)
 { // Constant-time table lookup to extract a point represented as (x+y,y-x,2t) corresponding to extended twisted Edwards coordinates (X:Y:Z:T) with Z=1
   // Inputs: sign, digit, table containing VPOINTS_FIXEDBASE = 2^(W_FIXEDBASE-1) points
   // Output: if sign=0 then P = table[digit], else if (sign=-1) then P = -table[digit]
+    COUNT_OP(table_lookup_fixed_base);
 
 #if (SIMD_SUPPORT == AVX2_SUPPORT)
     __m256i point[3], temp_point[3], full_mask; 
@@ -281,6 +396,8 @@ void table_lookup_fixed_base(point_precomp_t* table, point_precomp_t P, unsigned
 #endif
 }
 
+#endif
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,369 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: placement of the precomputed tables in memory
+*
+* By default, fixed-base and double-scalar multiplication read the static tables of
+* FourQ_tables.h. ecc_tables_place() copies them to memory mapped for them instead:
+* huge pages, so that a table needs a single TLB entry, and/or one copy per NUMA node,
+* bound to the memory of that node, so that no thread reads its tables from a remote
+* node. The copies are read-only once filled.
+************************************************************************************/
+
+#if defined(__LINUX__)
+    #define _GNU_SOURCE
+#endif
+#include "FourQ_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if (OS_TARGET == OS_LINUX)
+    #include <sched.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+#endif
+
+
+#define TABLES_MAX_NODES      64                 // NUMA nodes with larger IDs are not replicated to
+#define TABLES_ALIGNMENT      64                 // Alignment of each table within a copy
+#define DEFAULT_HUGE_PAGE     (2*1024*1024)      // Huge page size if the kernel does not report one
+
+#if (OS_TARGET == OS_LINUX)
+
+#define MPOL_BIND_POLICY      2                  // MPOL_BIND of <numaif.h>, which is part of libnuma rather than of the C library
+
+typedef struct {
+    unsigned char* copies[TABLES_MAX_NODES];     // Copy of the tables for each NUMA node with CPUs, or a single copy
+    size_t mapped[TABLES_MAX_NODES];             // Size of the mapping of each copy
+    size_t offsets[NTABLES];                     // Offset of each table in a copy
+    unsigned char* cpu_copy;                     // Index of the copy read by each CPU
+    unsigned int ncpus;
+    table_placement_t info;
+} placement_state;
+
+static placement_state* placement = NULL;
+
+
+static const char* next_range(const char* s, unsigned int* first, unsigned int* last)
+{ // Next range of a list in the format of sysfs, e.g. "0-3,8,10-11". Returns NULL at the end of the list
+    char* end;
+
+    while (*s == ',') s++;
+    if (*s < '0' || *s > '9') {
+        return NULL;
+    }
+    *first = *last = (unsigned int)strtoul(s, &end, 10);
+    if (*end == '-') {
+        *last = (unsigned int)strtoul(end + 1, &end, 10);
+    }
+    return end;
+}
+
+
+static bool read_line(const char* path, char* line, size_t size)
+{
+    FILE* file = fopen(path, "r");
+    bool read;
+
+    if (file == NULL) {
+        return false;
+    }
+    read = (fgets(line, (int)size, file) != NULL);
+    fclose(file);
+    return read;
+}
+
+
+static size_t read_size(const char* path, const char* key, size_t unit)
+{ // Value of a line "key value" of a file, times unit, or of its first line if key = NULL. Returns 0 if not found
+    char line[256];
+    FILE* file = fopen(path, "r");
+    size_t value = 0;
+
+    if (file == NULL) {
+        return 0;
+    }
+    while (fgets(line, sizeof(line), file) != NULL) {
+        if (key == NULL) {
+            value = (size_t)strtoull(line, NULL, 10)*unit;
+            break;
+        } else if (strncmp(line, key, strlen(key)) == 0) {
+            value = (size_t)strtoull(line + strlen(key), NULL, 10)*unit;
+            break;
+        }
+    }
+    fclose(file);
+    return value;
+}
+
+
+static unsigned int read_nodes(placement_state* state, int* nodes)
+{ // NUMA nodes that have CPUs, and the copy read by each CPU. Returns the number of nodes, or 0 if the topology cannot be read
+    char line[1024], path[96];
+    const char *s, *t;
+    unsigned int first, last, cpu, node, n = 0;
+
+    if (read_line("/sys/devices/system/cpu/possible", line, sizeof(line)) == false) {
+        return 0;
+    }
+    for (s = line; (s = next_range(s, &first, &last)) != NULL; ) {
+        state->ncpus = last + 1;
+    }
+    if (state->ncpus == 0 || read_line("/sys/devices/system/node/online", line, sizeof(line)) == false) {
+        return 0;
+    }
+    state->cpu_copy = (unsigned char*)calloc(state->ncpus, 1);
+    if (state->cpu_copy == NULL) {
+        return 0;
+    }
+
+    for (s = line; (s = next_range(s, &first, &last)) != NULL; ) {
+        for (node = first; node <= last && node < TABLES_MAX_NODES; node++) {
+            char cpus[1024];
+
+            sprintf(path, "/sys/devices/system/node/node%u/cpulist", node);
+            if (read_line(path, cpus, sizeof(cpus)) == false || next_range(cpus, &cpu, &cpu) == NULL) {
+                continue;                                // Node without CPUs (e.g., memory only): nobody would read its copy
+            }
+            for (t = cpus; (t = next_range(t, &first, &last)) != NULL; ) {
+                for (cpu = first; cpu <= last && cpu < state->ncpus; cpu++) {
+                    state->cpu_copy[cpu] = (unsigned char)n;
+                }
+            }
+            nodes[n++] = (int)node;
+        }
+    }
+    return n;
+}
+
+
+static bool free_huge_pages(int node, size_t page_size, size_t count)
+{ // True if explicit huge pages of size page_size can back count pages, on the given node if node >= 0
+    char path[128];
+
+    if (node >= 0) {
+        sprintf(path, "/sys/devices/system/node/node%d/hugepages/hugepages-%lukB/free_hugepages", node, (unsigned long)(page_size >> 10));
+    } else {
+        sprintf(path, "/sys/kernel/mm/hugepages/hugepages-%lukB/free_hugepages", (unsigned long)(page_size >> 10));
+    }
+    return read_size(path, NULL, 1) >= count;
+}
+
+
+static bool transparent_huge_pages(const unsigned char* p)
+{ // True if the mapping that starts at p is backed, at least in part, by transparent huge pages (AnonHugePages in /proc/self/smaps)
+    char line[256];
+    FILE* file = fopen("/proc/self/smaps", "r");
+    unsigned long start, end;
+    bool in_mapping = false, backed = false;
+
+    if (file == NULL) {
+        return false;
+    }
+    while (fgets(line, sizeof(line), file) != NULL) {
+        if (sscanf(line, "%lx-%lx ", &start, &end) == 2) {
+            in_mapping = (start == (unsigned long)p);
+        } else if (in_mapping && strncmp(line, "AnonHugePages:", 14) == 0) {
+            backed = (strtoul(line + 14, NULL, 10) != 0);
+            break;
+        }
+    }
+    fclose(file);
+    return backed;
+}
+
+
+static unsigned char* map_aligned(size_t size, size_t alignment)
+{ // Anonymous read-write mapping of size bytes aligned to alignment, which transparent huge pages require
+    unsigned char *p, *aligned;
+
+    p = (unsigned char*)mmap(NULL, size + alignment, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == (unsigned char*)MAP_FAILED) {
+        return NULL;
+    }
+    aligned = (unsigned char*)(((uintptr_t)p + alignment - 1) & ~(uintptr_t)(alignment - 1));
+    if (aligned != p) {
+        munmap(p, aligned - p);
+    }
+    munmap(aligned + size, (p + alignment) - aligned);
+    return aligned;
+}
+
+
+static unsigned char* map_copy(size_t bytes, unsigned int flags, int node, size_t* mapped, table_pages_t* pages, bool* bound)
+{ // Memory for one copy of the tables, bound to node if node >= 0. The pages are not touched, so binding decides where they are allocated
+    unsigned long mask[TABLES_MAX_NODES/(8*sizeof(unsigned long))] = {0};
+    size_t page_size = (size_t)sysconf(_SC_PAGESIZE), huge_size;
+    unsigned char* p = NULL;
+
+    *pages = TABLE_PAGES_SMALL;
+    if (flags & TABLES_HUGE_PAGES) {
+        huge_size = read_size("/proc/meminfo", "Hugepagesize:", 1024);
+        if (huge_size == 0) huge_size = DEFAULT_HUGE_PAGE;
+        *mapped = (bytes + huge_size - 1) & ~(huge_size - 1);
+        if (free_huge_pages(node, huge_size, *mapped/huge_size)) {    // Otherwise, the first access could fail with SIGBUS
+            p = (unsigned char*)mmap(NULL, *mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (p == (unsigned char*)MAP_FAILED) {
+                p = NULL;
+            } else {
+                *pages = TABLE_PAGES_EXPLICIT;
+            }
+        }
+        if (p == NULL) {
+            huge_size = read_size("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", NULL, 1);
+            if (huge_size == 0) huge_size = DEFAULT_HUGE_PAGE;
+            *mapped = (bytes + huge_size - 1) & ~(huge_size - 1);
+            p = map_aligned(*mapped, huge_size);
+            if (p != NULL && madvise(p, *mapped, MADV_HUGEPAGE) == 0) {
+                *pages = TABLE_PAGES_TRANSPARENT;                     // Confirmed once the pages are touched
+            }
+        }
+    } else {
+        *mapped = (bytes + page_size - 1) & ~(page_size - 1);
+        p = (unsigned char*)mmap(NULL, *mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == (unsigned char*)MAP_FAILED) {
+            p = NULL;
+        }
+    }
+
+    *bound = false;
+    if (p != NULL && node >= 0) {
+        mask[node/(8*sizeof(unsigned long))] = 1UL << (node%(8*sizeof(unsigned long)));
+        *bound = (syscall(SYS_mbind, p, *mapped, MPOL_BIND_POLICY, mask, TABLES_MAX_NODES + 1, 0) == 0);
+    }
+    return p;
+}
+
+
+static void release(placement_state* state)
+{
+    unsigned int i;
+
+    for (i = 0; i < state->info.copies; i++) {
+        munmap(state->copies[i], state->mapped[i]);
+    }
+    free(state->cpu_copy);
+    free(state);
+}
+
+
+const uint64_t* ecc_placed_table(unsigned int Table)
+{ // Copy of a table on the NUMA node of the calling thread, or NULL if the static tables are in use
+    const placement_state* state = placement;
+    unsigned int copy = 0;
+    int cpu;
+
+    if (state == NULL) {
+        return NULL;
+    }
+    if (state->info.copies > 1) {
+        cpu = sched_getcpu();
+        if (cpu >= 0 && (unsigned int)cpu < state->ncpus) {
+            copy = state->cpu_copy[cpu];
+        }
+    }
+    return (const uint64_t*)(state->copies[copy] + state->offsets[Table]);
+}
+
+#else
+
+const uint64_t* ecc_placed_table(unsigned int Table)
+{
+    (void)Table;
+    return NULL;
+}
+
+#endif
+
+
+ECCRYPTO_STATUS ecc_tables_place(unsigned int Flags)
+{ // Copies of the precomputed tables in huge pages and/or on every NUMA node, or the static tables if Flags = 0
+#if (OS_TARGET == OS_LINUX)
+    const uint64_t* tables[NTABLES];
+    size_t sizes[NTABLES], mapped = 0;
+    int nodes[TABLES_MAX_NODES];
+    placement_state* state;
+    table_pages_t pages;
+    unsigned int i, j, n = 1;
+    bool bound;
+
+    if ((Flags & ~(TABLES_HUGE_PAGES | TABLES_NUMA_REPLICAS)) != 0) {
+        return ECCRYPTO_ERROR_INVALID_PARAMETER;
+    }
+    if (placement != NULL) {
+        state = placement;
+        placement = NULL;
+        release(state);
+    }
+    if (Flags == 0) {
+        return ECCRYPTO_SUCCESS;
+    }
+
+    state = (placement_state*)calloc(1, sizeof(placement_state));
+    if (state == NULL) {
+        return ECCRYPTO_ERROR_NO_MEMORY;
+    }
+    ecc_static_tables(tables, sizes);
+    state->info.flags = Flags;
+    state->info.pages = TABLE_PAGES_EXPLICIT;
+    for (i = 0; i < NTABLES; i++) {
+        state->offsets[i] = state->info.table_bytes;
+        state->info.table_bytes += (sizes[i] + TABLES_ALIGNMENT - 1) & ~(size_t)(TABLES_ALIGNMENT - 1);
+    }
+
+    nodes[0] = -1;
+    if (Flags & TABLES_NUMA_REPLICAS) {
+        n = read_nodes(state, nodes);
+        if (n == 0) {                                    // Topology unavailable: one copy, not bound to any node
+            n = 1;
+            nodes[0] = -1;
+        }
+    }
+
+    for (i = 0; i < n; i++) {
+        state->copies[i] = map_copy(state->info.table_bytes, Flags, nodes[i], &mapped, &pages, &bound);
+        if (state->copies[i] == NULL) {
+            release(state);
+            return ECCRYPTO_ERROR_NO_MEMORY;
+        }
+        state->mapped[i] = mapped;
+        state->info.copies++;
+        state->info.mapped_bytes += mapped;
+        state->info.bound += (bound == true);
+
+        for (j = 0; j < NTABLES; j++) {
+            if (sizes[j] != 0) {
+                memcpy(state->copies[i] + state->offsets[j], tables[j], sizes[j]);
+            }
+        }
+        if (pages == TABLE_PAGES_TRANSPARENT && transparent_huge_pages(state->copies[i]) == false) {
+            pages = TABLE_PAGES_SMALL;
+        }
+        if (pages < state->info.pages) {
+            state->info.pages = pages;                   // The smallest pages of all copies, e.g., if explicit huge pages ran out on some node
+        }
+        mprotect(state->copies[i], mapped, PROT_READ);
+    }
+
+    placement = state;
+    return ECCRYPTO_SUCCESS;
+#else
+    return (Flags == 0) ? ECCRYPTO_SUCCESS : ECCRYPTO_ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
+void ecc_tables_placement(table_placement_t* Placement)
+{ // Current placement of the precomputed tables
+#if (OS_TARGET == OS_LINUX)
+    if (placement != NULL) {
+        *Placement = placement->info;
+        return;
+    }
+#endif
+    memset(Placement, 0, sizeof(table_placement_t));
+    Placement->pages = TABLE_PAGES_STATIC;
+}
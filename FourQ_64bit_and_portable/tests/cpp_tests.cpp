@@ -0,0 +1,236 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: testing code for the C++ interface of FourQ.hpp
+************************************************************************************/
+
+#include "../FourQ.hpp"
+#include "test_extras.h"
+#include "../../random/random.h"
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <new>
+
+
+// Benchmark and test parameters
+#if defined(GENERIC_IMPLEMENTATION)
+    #define BENCH_LOOPS       100       // Number of iterations per bench
+    #define TEST_LOOPS        100       // Number of iterations per test
+#else
+    #define BENCH_LOOPS       10000
+    #define TEST_LOOPS        1000
+#endif
+
+#define BATCH_SIZE            100       // Larger than fourq::schnorrq::verify_batch_chunk, so the batch is split
+
+
+using namespace fourq;
+
+// The wrapper types are the bare byte arrays, and cannot be copied by accident
+static_assert(sizeof(schnorrq::SecretKey) == 32 && sizeof(schnorrq::Signature) == 64 && sizeof(dh::SharedSecret) == 32, "unexpected padding");
+static_assert(!std::is_copy_constructible_v<schnorrq::SecretKey> && !std::is_copy_assignable_v<schnorrq::Signature>, "key types must be move-only");
+static_assert(std::is_nothrow_move_constructible_v<dh::SecretKey> && std::is_nothrow_move_assignable_v<dh::SharedSecret>, "moves must not throw");
+static_assert(!std::is_same_v<schnorrq::PublicKey, dh::PublicKey>, "keys of different schemes must have different types");
+static_assert(noexcept(schnorrq::sign(std::declval<const schnorrq::SecretKey&>(), std::declval<const schnorrq::PublicKey&>(), span<const byte>(), std::declval<schnorrq::Signature&>())), "hot paths must be noexcept");
+static_assert(noexcept(dh::agree(std::declval<const dh::SecretKey&>(), std::declval<const dh::PublicKey&>(), std::declval<dh::SharedSecret&>())), "hot paths must be noexcept");
+
+
+static void print_test(const char* name, bool passed)
+{ // One line of the test report, in the format of crypto_tests
+    if (passed) printf("  %s%.*s PASSED\n", name, (int)(81 - strlen(name)), "..................................................................................");
+    else printf("  %s... FAILED\n", name);
+}
+
+
+static void print_bench(const char* name, long long cycles)
+{
+    printf("  %s %.*s %8lld ", name, (int)(80 - strlen(name)), "..................................................................................", cycles); print_unit;
+    printf("\n");
+}
+
+
+static bool is_zero(const void* p, size_t n)
+{
+    const volatile unsigned char* b = (const volatile unsigned char*)p;   // Also reads memory whose object has been destroyed
+    unsigned char acc = 0;
+
+    for (size_t i = 0; i < n; i++) acc |= b[i];
+    return acc == 0;
+}
+
+
+static bool types_test()
+{ // Move semantics, zeroization, explicit copies and assignment from spans
+    bool passed = true;
+    alignas(schnorrq::SecretKey) unsigned char storage[sizeof(schnorrq::SecretKey)];
+    std::array<byte, 32> bytes;
+    byte short_input[31] = {0};
+
+    for (size_t i = 0; i < bytes.size(); i++) bytes[i] = (byte)(i + 1);
+    schnorrq::SecretKey a(bytes);
+    schnorrq::SecretKey b(std::move(a));
+    passed = passed && is_zero(a.data(), 32) && b.bytes() == bytes;
+    a = std::move(b);
+    passed = passed && is_zero(b.data(), 32) && a.bytes() == bytes;
+    schnorrq::SecretKey c = a.clone();
+    passed = passed && c == a && !(c != a);
+    passed = passed && c.assign(span<const byte>(bytes.data(), bytes.size())) && !c.assign(short_input);
+
+    schnorrq::SecretKey* p = new (storage) schnorrq::SecretKey(bytes);
+    std::destroy_at(p);
+    passed = passed && is_zero(storage, sizeof(storage));
+
+    print_test("Key type tests", passed);
+    return passed;
+}
+
+
+static bool schnorrq_test()
+{ // Signatures, checked against the C functions
+    bool passed = true;
+    schnorrq::SecretKey secret_key;
+    schnorrq::PublicKey public_key, public_key2;
+    schnorrq::Signature signature;
+    unsigned char c_signature[64];
+    byte message[64];
+    int n;
+
+    for (n = 0; n < TEST_LOOPS && passed; n++) {
+        random_bytes(message, sizeof(message));
+        passed = passed && schnorrq::generate(secret_key, public_key);
+        passed = passed && schnorrq::public_key(secret_key, public_key2) && public_key2 == public_key;
+        passed = passed && schnorrq::sign(secret_key, public_key, message, signature);
+        passed = passed && SchnorrQ_Sign(secret_key.data(), public_key.data(), message, sizeof(message), c_signature) == ECCRYPTO_SUCCESS;
+        passed = passed && memcmp(signature.data(), c_signature, 64) == 0;
+        passed = passed && schnorrq::verify(public_key, message, signature);
+        message[n % sizeof(message)] ^= 1;
+        passed = passed && schnorrq::verify(public_key, message, signature).code() == ECCRYPTO_ERROR_SIGNATURE_VERIFICATION;
+    }
+    if (sizeof(size_t) > sizeof(unsigned int)) {   // Lengths that do not fit in 32 bits are rejected before the message is read
+        span<const byte> huge(message, (size_t)UINT_MAX + 1);
+        passed = passed && schnorrq::sign(secret_key, public_key, huge, signature).code() == ECCRYPTO_ERROR_INVALID_PARAMETER;
+    }
+
+    print_test("SchnorrQ tests", passed);
+    return passed;
+}
+
+
+static bool batch_test()
+{ // Batched verification across several chunks, with one invalid signature
+    bool passed = true, valid[BATCH_SIZE];
+    static schnorrq::PublicKey public_keys[BATCH_SIZE];
+    static schnorrq::Signature signatures[BATCH_SIZE];
+    static byte messages[BATCH_SIZE][32];
+    span<const byte> message_spans[BATCH_SIZE];
+    schnorrq::SecretKey secret_key;
+    unsigned int i;
+
+    for (i = 0; i < BATCH_SIZE; i++) {
+        random_bytes(messages[i], sizeof(messages[i]));
+        message_spans[i] = messages[i];
+        passed = passed && schnorrq::generate(secret_key, public_keys[i]) && schnorrq::sign(secret_key, public_keys[i], message_spans[i], signatures[i]);
+    }
+    messages[70][0] ^= 1;
+    passed = passed && schnorrq::verify_batch(public_keys, message_spans, signatures, valid);
+    for (i = 0; i < BATCH_SIZE; i++) {
+        passed = passed && valid[i] == (i != 70);
+    }
+    passed = passed && schnorrq::verify_batch(public_keys, message_spans, span<const schnorrq::Signature>(signatures, BATCH_SIZE - 1), valid).code() == ECCRYPTO_ERROR_INVALID_PARAMETER;
+
+    print_test("Batched verification tests", passed);
+    return passed;
+}
+
+
+static bool dh_test()
+{ // Key exchange, checked against the C functions
+    bool passed = true;
+    dh::SecretKey secret_a, secret_b, ephemeral;
+    dh::PublicKey public_a, public_b, public_ephemeral;
+    dh::SharedSecret shared_a, shared_b;
+    unsigned char c_shared[32];
+    int n;
+
+    for (n = 0; n < TEST_LOOPS && passed; n++) {
+        passed = passed && dh::generate(secret_a, public_a) && dh::generate(secret_b, public_b);
+        passed = passed && dh::agree(secret_a, public_b, shared_a) && dh::agree(secret_b, public_a, shared_b) && shared_a == shared_b;
+        passed = passed && CompressedSecretAgreement(secret_a.data(), public_b.data(), c_shared) == ECCRYPTO_SUCCESS;
+        passed = passed && memcmp(shared_a.data(), c_shared, 32) == 0;
+        passed = passed && dh::ephemeral_agree(public_a, ephemeral, public_ephemeral, shared_b);
+        passed = passed && dh::agree(secret_a, public_ephemeral, shared_a) && shared_a == shared_b;
+    }
+
+    print_test("Key exchange tests", passed);
+    return passed;
+}
+
+
+static void overhead_run()
+{ // Cost of the wrappers: each call is timed next to the C call it wraps
+    schnorrq::SecretKey secret_key;
+    schnorrq::PublicKey public_key;
+    schnorrq::Signature signature;
+    dh::SecretKey dh_secret;
+    dh::PublicKey dh_public;
+    dh::SharedSecret shared;
+    unsigned int valid;
+    byte message[64] = {0};
+    long long cycles[2][3] = {{0}};
+    int64_t c0;
+    int n;
+
+    if (!schnorrq::generate(secret_key, public_key) || !dh::generate(dh_secret, dh_public)) return;
+
+    for (n = 0; n < BENCH_LOOPS; n++) {
+        c0 = cpucycles();
+        SchnorrQ_Sign(secret_key.data(), public_key.data(), message, sizeof(message), signature.data());
+        cycles[0][0] += cpucycles() - c0;
+        c0 = cpucycles();
+        (void)schnorrq::sign(secret_key, public_key, message, signature);
+        cycles[1][0] += cpucycles() - c0;
+
+        c0 = cpucycles();
+        SchnorrQ_Verify(public_key.data(), message, sizeof(message), signature.data(), &valid);
+        cycles[0][1] += cpucycles() - c0;
+        c0 = cpucycles();
+        (void)schnorrq::verify(public_key, message, signature);
+        cycles[1][1] += cpucycles() - c0;
+
+        c0 = cpucycles();
+        CompressedSecretAgreement(dh_secret.data(), dh_public.data(), shared.data());
+        cycles[0][2] += cpucycles() - c0;
+        c0 = cpucycles();
+        (void)dh::agree(dh_secret, dh_public, shared);
+        cycles[1][2] += cpucycles() - c0;
+    }
+
+    print_bench("SchnorrQ_Sign runs in", cycles[0][0]/BENCH_LOOPS);
+    print_bench("fourq::schnorrq::sign runs in", cycles[1][0]/BENCH_LOOPS);
+    print_bench("SchnorrQ_Verify runs in", cycles[0][1]/BENCH_LOOPS);
+    print_bench("fourq::schnorrq::verify runs in", cycles[1][1]/BENCH_LOOPS);
+    print_bench("CompressedSecretAgreement runs in", cycles[0][2]/BENCH_LOOPS);
+    print_bench("fourq::dh::agree runs in", cycles[1][2]/BENCH_LOOPS);
+}
+
+
+int main()
+{
+    bool passed = true;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Testing the C++ interface: \n\n");
+    passed = types_test() && passed;
+    passed = schnorrq_test() && passed;
+    passed = batch_test() && passed;
+    passed = dh_test() && passed;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Benchmarking the C++ interface against the C functions: \n\n");
+    overhead_run();
+
+    return passed;
+}
@@ -9,7 +9,14 @@
 #include "../FourQ_api.h"
 #include "../FourQ_params.h"
 #include "test_extras.h"
+#include "../../random/random.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(FOURQ_METRICS) && (OS_TARGET == OS_LINUX)
+    #include <pthread.h>
+#endif
 
 
 // Benchmark and test parameters  
@@ -21,6 +28,8 @@
     #define TEST_LOOPS        1000
 #endif
 
+#define POOL_CAPACITY         64        // Keypairs in the pool of the ephemeral pool tests
+
 
 ECCRYPTO_STATUS SchnorrQ_test()
 { // Test the SchnorrQ digital signature scheme
@@ -137,6 +146,430 @@ ECCRYPTO_STATUS SchnorrQ_run()
 }
 
 
+ECCRYPTO_STATUS SchnorrQ_cache_test()
+{ // Test the cache of verified SchnorrQ signatures
+    int n, passed;
+    unsigned int valid = false;
+    unsigned char SecretKey[32], PublicKey[32], Signature[64], msg[8] = {0};
+    uint64_t hits, misses, entries;
+    size_t budget;
+    bool accepted = false;
+    SchnorrQ_cache_t* Cache = NULL;
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
+    printf("Testing the cache of verified SchnorrQ signatures: \n\n"); 
+
+    // Budgets from 1 byte up: each one is rejected until the budget holds one entry per shard, and accepted from then on
+    passed = 1;
+    for (budget = 1; budget <= 8192 && passed == 1; budget++) {
+        Status = SchnorrQ_CacheCreate(budget, &Cache);
+        if (Status == ECCRYPTO_SUCCESS) {
+            accepted = true;
+            SchnorrQ_CacheDestroy(Cache);
+            Cache = NULL;
+        } else if (Status != ECCRYPTO_ERROR_INVALID_PARAMETER || accepted == true) {
+            passed = 0;
+        }
+    }
+    if (passed==1 && accepted == true) printf("  Signature cache budget tests..................................................... PASSED");
+    else { printf("  Signature cache budget tests... FAILED"); printf("\n"); return ECCRYPTO_ERROR_DURING_TEST; }
+    printf("\n");
+
+    Status = SchnorrQ_CacheCreate(4096, &Cache);            // Small budget to exercise evictions
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+    Status = SchnorrQ_FullKeyGeneration(SecretKey, PublicKey);
+    if (Status != ECCRYPTO_SUCCESS) {
+        goto cleanup;
+    }
+
+    passed = 1;
+    for (n = 0; n < TEST_LOOPS; n++)
+    {    
+        msg[0] = (unsigned char)n; msg[1] = (unsigned char)(n >> 8);
+        Status = SchnorrQ_Sign(SecretKey, PublicKey, msg, sizeof(msg), Signature);
+        if (Status != ECCRYPTO_SUCCESS) {
+            goto cleanup;
+        }    
+
+        // Valid signature: first lookup misses, second one hits
+        Status = SchnorrQ_VerifyCached(Cache, PublicKey, msg, sizeof(msg), Signature, &valid);
+        if (Status != ECCRYPTO_SUCCESS) {
+            goto cleanup;
+        }    
+        if (valid == false) { passed = 0; break; }
+        Status = SchnorrQ_VerifyCached(Cache, PublicKey, msg, sizeof(msg), Signature, &valid);
+        if (Status != ECCRYPTO_SUCCESS) {
+            goto cleanup;
+        }    
+        if (valid == false) { passed = 0; break; }
+
+        // Invalid signature test (flipping one bit of the message) must not be accepted nor cached
+        msg[7] ^= 1;
+        Status = SchnorrQ_VerifyCached(Cache, PublicKey, msg, sizeof(msg), Signature, &valid);
+        if (Status != ECCRYPTO_SUCCESS) {
+            goto cleanup;
+        }    
+        if (valid == true) { passed = 0; break; }
+        Status = SchnorrQ_VerifyCached(Cache, PublicKey, msg, sizeof(msg), Signature, &valid);
+        if (Status != ECCRYPTO_SUCCESS) {
+            goto cleanup;
+        }    
+        if (valid == true) { passed = 0; break; }
+        msg[7] ^= 1;
+    } 
+
+    SchnorrQ_CacheStatistics(Cache, &hits, &misses, &entries);
+    if (hits != (uint64_t)TEST_LOOPS || misses != (uint64_t)(3*TEST_LOOPS) || entries == 0 || entries >= (uint64_t)TEST_LOOPS) {
+        passed = 0;
+    }
+
+    if (passed==1) printf("  Signature cache tests............................................................ PASSED");
+    else { printf("  Signature cache tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_SIGNATURE_VERIFICATION; }
+    printf("\n");
+
+cleanup:
+    SchnorrQ_CacheDestroy(Cache);
+    
+    return Status;
+}
+
+
+ECCRYPTO_STATUS SchnorrQ_cache_run()
+{ // Benchmark the cache of verified SchnorrQ signatures 
+    int n;
+    unsigned long long cycles, cycles1, cycles2;   
+    unsigned int valid = false;
+    unsigned char SecretKey[32], PublicKey[32], Signature[64], msg[64] = {0};
+    SchnorrQ_cache_t* Cache = NULL;
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
+    printf("Benchmarking the cache of verified SchnorrQ signatures: \n\n"); 
+
+    Status = SchnorrQ_CacheCreate(1 << 20, &Cache);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+    Status = SchnorrQ_FullKeyGeneration(SecretKey, PublicKey);
+    if (Status != ECCRYPTO_SUCCESS) {
+        goto cleanup;
+    }
+    Status = SchnorrQ_Sign(SecretKey, PublicKey, msg, sizeof(msg), Signature);
+    if (Status != ECCRYPTO_SUCCESS) {
+        goto cleanup;
+    }
+    Status = SchnorrQ_VerifyCached(Cache, PublicKey, msg, sizeof(msg), Signature, &valid);
+    if (Status != ECCRYPTO_SUCCESS) {
+        goto cleanup;
+    }
+
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        Status = SchnorrQ_VerifyCached(Cache, PublicKey, msg, sizeof(msg), Signature, &valid);
+        if (Status != ECCRYPTO_SUCCESS) {
+            goto cleanup;
+        }    
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  SchnorrQ's cached verification (hit) runs in .................................... %8lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+cleanup:
+    SchnorrQ_CacheDestroy(Cache);
+    
+    return Status;
+}
+
+
+ECCRYPTO_STATUS SchnorrQ_batch_test()
+{ // Test batched SchnorrQ signature verification
+    int n, passed;
+    unsigned int i, valid[13], valid1 = false;
+    unsigned char SecretKey[32], PublicKeys[13][32], Signatures[13][64], msgs[13][16];
+    const unsigned char *pk[13], *msg[13], *sig[13];
+    unsigned int sizes[13];
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
+    printf("Testing batched SchnorrQ signature verification: \n\n"); 
+
+    passed = 1;
+    for (n = 0; n < TEST_LOOPS/10; n++)
+    {    
+        for (i = 0; i < 13; i++) {
+            Status = SchnorrQ_FullKeyGeneration(SecretKey, PublicKeys[i]);
+            if (Status != ECCRYPTO_SUCCESS) {
+                return Status;
+            }
+            memset(msgs[i], (int)(n + i), sizeof(msgs[i]));
+            sizes[i] = (unsigned int)(i + 1);               // Messages of different lengths
+            Status = SchnorrQ_Sign(SecretKey, PublicKeys[i], msgs[i], sizes[i], Signatures[i]);
+            if (Status != ECCRYPTO_SUCCESS) {
+                return Status;
+            }
+            pk[i] = PublicKeys[i]; msg[i] = msgs[i]; sig[i] = Signatures[i];
+        }
+
+        // All signatures valid
+        Status = SchnorrQ_VerifyBatch(pk, msg, sizes, sig, 13, valid);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        for (i = 0; i < 13; i++) {
+            if (valid[i] == false) { passed = 0; break; }
+        }
+
+        // Tampered message, tampered signature and malformed public key in the same batch
+        msgs[3][0] ^= 1;
+        Signatures[7][40] ^= 1;
+        memset(PublicKeys[10], 0xFF, 32);
+        Status = SchnorrQ_VerifyBatch(pk, msg, sizes, sig, 13, valid);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        for (i = 0; i < 13; i++) {
+            Status = SchnorrQ_Verify(pk[i], msg[i], sizes[i], sig[i], &valid1);
+            if (Status != ECCRYPTO_SUCCESS && Status != ECCRYPTO_ERROR_INVALID_PARAMETER) {
+                return Status;
+            }
+            if (Status != ECCRYPTO_SUCCESS) valid1 = false;
+            if (valid[i] != valid1 || valid[i] != (unsigned int)(i != 3 && i != 7 && i != 10)) { passed = 0; break; }
+        }
+        Status = ECCRYPTO_SUCCESS;
+        if (passed == 0) break;
+    } 
+
+    if (passed==1) printf("  Batched signature verification tests............................................. PASSED");
+    else { printf("  Batched signature verification tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_SIGNATURE_VERIFICATION; }
+    printf("\n");
+    
+    return Status;
+}
+
+
+ECCRYPTO_STATUS SchnorrQ_batch_run()
+{ // Benchmark batched SchnorrQ signature verification
+    int n;
+    unsigned long long cycles, cycles1, cycles2;   
+    unsigned int i, valid[64];
+    unsigned char SecretKey[32], PublicKeys[64][32], Signatures[64][64], msgs[64][32] = {{0}};
+    const unsigned char *pk[64], *msg[64], *sig[64];
+    unsigned int sizes[64];
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
+    printf("Benchmarking batched SchnorrQ signature verification: \n\n"); 
+
+    for (i = 0; i < 64; i++) {
+        Status = SchnorrQ_FullKeyGeneration(SecretKey, PublicKeys[i]);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        msgs[i][0] = (unsigned char)i;
+        sizes[i] = sizeof(msgs[i]);
+        Status = SchnorrQ_Sign(SecretKey, PublicKeys[i], msgs[i], sizes[i], Signatures[i]);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        pk[i] = PublicKeys[i]; msg[i] = msgs[i]; sig[i] = Signatures[i];
+    }
+
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS/64; n++)
+    {
+        cycles1 = cpucycles(); 
+        Status = SchnorrQ_VerifyBatch(pk, msg, sizes, sig, 64, valid);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }    
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  SchnorrQ's batched verification runs in ......................................... %8lld ", cycles/((BENCH_LOOPS/64)*64)); print_unit;
+    printf(" per signature (batches of 64)\n");
+    
+    return Status;
+}
+
+
+static int hash_matches(const unsigned char* out, const char* hex)
+{ // Compare a 64-byte hash output against its hexadecimal encoding
+    char buffer[129];
+    int i;
+
+    for (i = 0; i < 64; i++) {
+        sprintf(buffer + 2*i, "%02x", out[i]);
+    }
+    return (strcmp(buffer, hex) == 0);
+}
+
+
+ECCRYPTO_STATUS hash_provider_test()
+{ // Test the hash providers and SchnorrQ with non-default providers
+    int n, passed;
+    unsigned int i, j, len, valid = false;
+    unsigned char SecretKey[32], PublicKey[32], Signature[64], msg[1000], out1[64], out2[64];
+    const hash_provider_t* Providers[2] = { &HashProviderSHA512, &HashProviderBLAKE2b };
+    const char* abc[2] = { "ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f",
+                           "ba80a53f981c4d0d6a2797b69f12f6e94c212f14685ac4b74b12bb6fdbffa2d17d87c5392aab792dc252d5de4533cc9518d38aa8dbf1925ab92386edd4009923" };
+    const char* million_a[2] = { "e718483d0ce769644e2e42c7bc15b4638e1f98b13b2044285632a803afa973ebde0ff244877ea60a4cb0432ce577c31beb009c5c2c49aa2e4eadb217ad8cc09b",
+                                 "98fb3efb7206fd19ebf69b6f312cf7b64e3b94dbe1a17107913975a793f177e1d077609d7fba363cbba00d05f7aa4e4fa8715d6428104c0a75643b0ff3fd3eaf" };
+    hash_provider_t Tagged = HashProviderSHA512;
+    hash_ctx_t ctx;
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
+    printf("Testing hash providers: \n\n"); 
+
+    passed = 1;
+    for (j = 0; j < 2 && passed == 1; j++) {
+        // Known answers, one-shot "abc" and streamed 10^6 x 'a' in chunks of 1000 bytes
+        Providers[j]->hash((const unsigned char*)"abc", 3, out1);
+        if (!hash_matches(out1, abc[j])) { passed = 0; break; }
+        memset(msg, 'a', sizeof(msg));
+        Providers[j]->init(&ctx);
+        for (i = 0; i < 1000; i++) {
+            Providers[j]->update(&ctx, msg, 1000);
+        }
+        Providers[j]->final(&ctx, out1);
+        if (!hash_matches(out1, million_a[j])) { passed = 0; break; }
+
+        // Streaming in uneven pieces must match one-shot hashing
+        for (n = 0; n < TEST_LOOPS; n++) {
+            len = (unsigned int)(n % sizeof(msg));
+            random_bytes(msg, len);
+            Providers[j]->hash(msg, len, out1);
+            Providers[j]->init(&ctx);
+            for (i = 0; i < len; i += (i % 131) + 1) {
+                Providers[j]->update(&ctx, msg + i, ((i % 131) + 1 < len - i) ? (i % 131) + 1 : len - i);
+            }
+            Providers[j]->final(&ctx, out2);
+            if (memcmp(out1, out2, 64) != 0) { passed = 0; break; }
+        }
+    }
+
+    // The IDs of the built-in providers are reserved to them
+    if (FourQ_SetHashProvider(&Tagged) != ECCRYPTO_ERROR_INVALID_PARAMETER) passed = 0;
+    Tagged.id = HASH_PROVIDER_BLAKE2B;
+    if (FourQ_SetHashProvider(&Tagged) != ECCRYPTO_ERROR_INVALID_PARAMETER || FourQ_GetHashProvider() != &HashProviderSHA512) passed = 0;
+
+    // SchnorrQ with BLAKE2b, and with SHA-512 under a different provider ID: signatures are not interchangeable across providers
+    Tagged.id = 7;
+    for (n = 0; n < TEST_LOOPS/10 && passed == 1; n++) {
+        random_bytes(msg, 32);
+        for (j = 0; j < 2; j++) {
+            Status = FourQ_SetHashProvider((j == 0) ? &HashProviderBLAKE2b : &Tagged);
+            if (Status != ECCRYPTO_SUCCESS) {
+                return Status;
+            }
+            Status = SchnorrQ_FullKeyGeneration(SecretKey, PublicKey);
+            if (Status != ECCRYPTO_SUCCESS) {
+                return Status;
+            }
+            Status = SchnorrQ_Sign(SecretKey, PublicKey, msg, 32, Signature);
+            if (Status != ECCRYPTO_SUCCESS) {
+                return Status;
+            }
+            Status = SchnorrQ_Verify(PublicKey, msg, 32, Signature, &valid);
+            if (Status != ECCRYPTO_SUCCESS) {
+                return Status;
+            }
+            if (valid == false) { passed = 0; break; }
+
+            FourQ_SetHashProvider(NULL);
+            Status = SchnorrQ_Verify(PublicKey, msg, 32, Signature, &valid);
+            if (Status != ECCRYPTO_SUCCESS) {
+                return Status;
+            }
+            if (valid == true) { passed = 0; break; }
+        }
+    }
+    if (FourQ_GetHashProvider() != &HashProviderSHA512) {
+        passed = 0;
+    }
+    FourQ_SetHashProvider(NULL);
+
+    if (passed==1) printf("  Hash provider tests.............................................................. PASSED");
+    else { printf("  Hash provider tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_SIGNATURE_VERIFICATION; }
+    printf("\n");
+    
+    return Status;
+}
+
+
+ECCRYPTO_STATUS hash_provider_run()
+{ // Benchmark the hash providers and SchnorrQ with each of them
+    int n;
+    unsigned int j, valid = false;
+    unsigned long long cycles, cycles1, cycles2;   
+    unsigned char SecretKey[32], PublicKey[32], Signature[64], msg[1024] = {0}, out[64];
+    const hash_provider_t* Providers[2] = { &HashProviderSHA512, &HashProviderBLAKE2b };
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
+    printf("Benchmarking hash providers: \n\n"); 
+
+    for (j = 0; j < 2; j++) {
+        cycles = 0;
+        for (n = 0; n < BENCH_LOOPS; n++)
+        {
+            cycles1 = cpucycles(); 
+            Providers[j]->hash(msg, sizeof(msg), out);
+            cycles2 = cpucycles();
+            cycles = cycles+(cycles2-cycles1);
+            msg[0] = out[0];
+        }
+        printf("  %-7s hashing of 1KB runs in .................................................. %8lld ", Providers[j]->name, cycles/BENCH_LOOPS); print_unit;
+        printf("\n");
+
+        FourQ_SetHashProvider(Providers[j]);
+        Status = SchnorrQ_FullKeyGeneration(SecretKey, PublicKey);
+        if (Status != ECCRYPTO_SUCCESS) {
+            goto cleanup;
+        }
+
+        cycles = 0;
+        for (n = 0; n < BENCH_LOOPS; n++)
+        {
+            cycles1 = cpucycles(); 
+            Status = SchnorrQ_Sign(SecretKey, PublicKey, msg, 64, Signature);
+            if (Status != ECCRYPTO_SUCCESS) {
+                goto cleanup;
+            }    
+            cycles2 = cpucycles();
+            cycles = cycles+(cycles2-cycles1);
+        }
+        printf("  SchnorrQ's signing with %-7s runs in ......................................... %8lld ", Providers[j]->name, cycles/BENCH_LOOPS); print_unit;
+        printf("\n");
+
+        cycles = 0;
+        for (n = 0; n < BENCH_LOOPS; n++)
+        {
+            cycles1 = cpucycles(); 
+            Status = SchnorrQ_Verify(PublicKey, msg, 64, Signature, &valid);
+            if (Status != ECCRYPTO_SUCCESS) {
+                goto cleanup;
+            }    
+            cycles2 = cpucycles();
+            cycles = cycles+(cycles2-cycles1);
+        }
+        printf("  SchnorrQ's verification with %-7s runs in .................................... %8lld ", Providers[j]->name, cycles/BENCH_LOOPS); print_unit;
+        printf("\n");
+    }
+
+cleanup:
+    FourQ_SetHashProvider(NULL);
+    
+    return Status;
+}
+
+
 ECCRYPTO_STATUS compressedkex_test()
 { // Test ECDH key exchange based on FourQ
 	int n, passed;
@@ -183,6 +616,40 @@ ECCRYPTO_STATUS compressedkex_test()
 	if (passed==1) printf("  DH key exchange tests............................................................ PASSED");
 	else { printf("  DH key exchange tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_SHARED_KEY; }
 	printf("\n");
+	if (Status != ECCRYPTO_SUCCESS) {
+		return Status;
+	}
+
+	passed = 1;
+	for (n = 0; n < TEST_LOOPS; n++)
+	{
+		// Bob's static keypair generation
+		Status = CompressedKeyGeneration(SecretKeyB, PublicKeyB);
+		if (Status != ECCRYPTO_SUCCESS) {
+			return Status;
+		}
+		// Alice's ephemeral keypair and shared secret computation
+		Status = EphemeralKeyAgreement(PublicKeyB, SecretKeyA, PublicKeyA, SecretAgreementA);
+		if (Status != ECCRYPTO_SUCCESS) {
+			return Status;
+		}
+		// Bob's shared secret computation
+		Status = CompressedSecretAgreement(SecretKeyB, PublicKeyA, SecretAgreementB);
+		if (Status != ECCRYPTO_SUCCESS) {
+			return Status;
+		}
+		if (memcmp(SecretAgreementA, SecretAgreementB, 32) != 0) { passed = 0; break; }
+
+		// Alice's keys must match the unfused computation
+		Status = CompressedPublicKeyGeneration(SecretKeyA, PublicKeyB);
+		if (Status != ECCRYPTO_SUCCESS) {
+			return Status;
+		}
+		if (memcmp(PublicKeyA, PublicKeyB, 32) != 0) { passed = 0; break; }
+	}
+	if (passed==1) printf("  Ephemeral key agreement tests.................................................... PASSED");
+	else { printf("  Ephemeral key agreement tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_SHARED_KEY; }
+	printf("\n");
 
 	return Status;
 }
@@ -228,10 +695,173 @@ ECCRYPTO_STATUS compressedkex_run()
 	printf("  Secret agreement runs in ........................................................ %8lld ", cycles/BENCH_LOOPS); print_unit;
 	printf("\n");
 
+	cycles = 0;
+	for (n = 0; n < BENCH_LOOPS; n++)
+	{
+		cycles1 = cpucycles();
+		Status = EphemeralKeyAgreement(PublicKeyB, SecretKeyA, PublicKeyA, SecretAgreementA);
+		if (Status != ECCRYPTO_SUCCESS) {
+			return Status;
+		}
+		cycles2 = cpucycles();
+		cycles = cycles + (cycles2 - cycles1);
+	}
+	printf("  Ephemeral key agreement runs in ................................................. %8lld ", cycles/BENCH_LOOPS); print_unit;
+	printf("\n");
+
 	return Status;
 }
 
 
+ECCRYPTO_STATUS ephemeral_pool_test()
+{ // Test the pool of pre-generated ephemeral keypairs
+    unsigned int i, j;
+    int n, passed;
+    static unsigned char SecretKeys[POOL_CAPACITY+1][32], PublicKeys[POOL_CAPACITY+1][32];
+    unsigned char PublicKey[32], SecretKeyB[32], PublicKeyB[32], SecretAgreementA[32], SecretAgreementB[32];
+    ephemeral_pool_stats_t stats;
+    ephemeral_pool_t* Pool = NULL;
+    time_t start;
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
+    printf("Testing the pool of pre-generated ephemeral keypairs: \n\n"); 
+
+    passed = (EphemeralPoolCreate(0, 0, 1, &Pool) == ECCRYPTO_ERROR_INVALID_PARAMETER);
+    passed &= (EphemeralPoolCreate(POOL_CAPACITY, POOL_CAPACITY, 1, &Pool) == ECCRYPTO_ERROR_INVALID_PARAMETER);
+    passed &= (EphemeralPoolCreate(POOL_CAPACITY, 0, 0, &Pool) == ECCRYPTO_ERROR_INVALID_PARAMETER && Pool == NULL);
+#if defined(FOURQ_METRICS)
+    FourQ_MetricsReset();
+#endif
+    Status = EphemeralPoolCreate(POOL_CAPACITY, 0, 1, &Pool);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+    EphemeralPoolStatistics(Pool, &stats);
+    passed &= (stats.available == POOL_CAPACITY && stats.generated == POOL_CAPACITY && stats.pops == 0);
+
+    // Capacity + 1 pops with the refill held back, so that the last one finds the pool empty
+    ephemeral_pool_hold_refill(Pool, true);
+    for (i = 0; i <= POOL_CAPACITY; i++) {
+        Status = EphemeralPoolKeyGeneration(Pool, SecretKeys[i], PublicKeys[i]);
+        if (Status != ECCRYPTO_SUCCESS) {
+            goto cleanup;
+        }
+    }
+    for (i = 0; i <= POOL_CAPACITY; i++) {
+        Status = CompressedPublicKeyGeneration(SecretKeys[i], PublicKey);
+        if (Status != ECCRYPTO_SUCCESS) {
+            goto cleanup;
+        }
+        if (memcmp(PublicKey, PublicKeys[i], 32) != 0) { passed = 0; break; }
+        for (j = 0; j < i; j++) {
+            if (memcmp(SecretKeys[i], SecretKeys[j], 32) == 0) { passed = 0; break; }
+        }
+    }
+    EphemeralPoolStatistics(Pool, &stats);
+    passed &= (stats.pops == POOL_CAPACITY+1 && stats.exhausted == 1 && stats.refills == 0 && stats.available == 0);
+#if defined(FOURQ_METRICS)
+    {
+        metrics_snapshot_t* snapshot = (metrics_snapshot_t*)malloc(sizeof(metrics_snapshot_t));
+        if (snapshot == NULL || FourQ_MetricsSnapshot(snapshot) != ECCRYPTO_SUCCESS) {
+            passed = 0;
+        } else {
+            passed &= (snapshot->events[METRICS_EPHEMERAL_POOL_EXHAUSTED] == stats.exhausted);
+            passed &= (snapshot->calls[METRICS_EPHEMERALPOOLKEYGENERATION].calls == POOL_CAPACITY+1);
+        }
+        free(snapshot);
+    }
+#endif
+    if (passed==1) printf("  Pooled keypair generation tests.................................................. PASSED");
+    else { printf("  Pooled keypair generation tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_DURING_TEST; goto cleanup; }
+    printf("\n");
+
+    // Once resumed, the next pop finds the pool empty again and wakes the refill, which brings the pool back to its capacity
+    ephemeral_pool_hold_refill(Pool, false);
+    Status = EphemeralPoolKeyGeneration(Pool, SecretKeys[0], PublicKeys[0]);
+    if (Status != ECCRYPTO_SUCCESS) {
+        goto cleanup;
+    }
+    start = time(NULL);
+    do {
+        EphemeralPoolStatistics(Pool, &stats);
+        passed = (stats.available == POOL_CAPACITY && stats.generated == 2*POOL_CAPACITY);
+    } while (passed == 0 && time(NULL) - start < 60);
+    passed &= (stats.pops == POOL_CAPACITY+2 && stats.exhausted == 2 && stats.refills == 1 && stats.refill_failures == 0);
+    if (passed==1) printf("  Low-water mark refill tests...................................................... PASSED");
+    else { printf("  Low-water mark refill tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_DURING_TEST; goto cleanup; }
+    printf("\n");
+
+    passed = 1;
+    for (n = 0; n < TEST_LOOPS; n++)
+    {
+        Status = CompressedKeyGeneration(SecretKeyB, PublicKeyB);
+        if (Status != ECCRYPTO_SUCCESS) {
+            goto cleanup;
+        }
+        Status = EphemeralPoolKeyAgreement(Pool, PublicKeyB, PublicKey, SecretAgreementA);
+        if (Status != ECCRYPTO_SUCCESS) {
+            goto cleanup;
+        }
+        Status = CompressedSecretAgreement(SecretKeyB, PublicKey, SecretAgreementB);
+        if (Status != ECCRYPTO_SUCCESS) {
+            goto cleanup;
+        }
+        if (memcmp(SecretAgreementA, SecretAgreementB, 32) != 0) { passed = 0; break; }
+    }
+    PublicKeyB[15] |= 0x80;                      // Invalid public key: the shared secret is cleared
+    passed &= (EphemeralPoolKeyAgreement(Pool, PublicKeyB, PublicKey, SecretAgreementA) == ECCRYPTO_ERROR_INVALID_PARAMETER);
+    for (i = 0; i < 32; i++) {
+        if (SecretAgreementA[i] != 0) { passed = 0; break; }
+    }
+    if (passed==1) printf("  Pooled ephemeral key agreement tests............................................. PASSED");
+    else { printf("  Pooled ephemeral key agreement tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_SHARED_KEY; }
+    printf("\n");
+
+cleanup:
+    EphemeralPoolDestroy(Pool);
+
+    return Status;
+}
+
+
+ECCRYPTO_STATUS ephemeral_pool_run()
+{ // Benchmark the pool of pre-generated ephemeral keypairs
+    int n;
+    unsigned long long cycles, cycles1, cycles2;
+    unsigned char SecretKey[32], PublicKey[32];
+    ephemeral_pool_t* Pool = NULL;
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
+    printf("Benchmarking the pool of pre-generated ephemeral keypairs: \n\n"); 
+
+    Status = EphemeralPoolCreate(BENCH_LOOPS, 0, 1, &Pool);   // Large enough for every pop to be served from the pool
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        Status = EphemeralPoolKeyGeneration(Pool, SecretKey, PublicKey);
+        if (Status != ECCRYPTO_SUCCESS) {
+            goto cleanup;
+        }
+        cycles2 = cpucycles();
+        cycles = cycles + (cycles2 - cycles1);
+    }
+    printf("  Pooled keypair generation runs in ............................................... %8lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+cleanup:
+    EphemeralPoolDestroy(Pool);
+
+    return Status;
+}
+
+
 ECCRYPTO_STATUS kex_test()
 { // Test ECDH key exchange based on FourQ
 	int n, passed;
@@ -327,6 +957,309 @@ ECCRYPTO_STATUS kex_run()
 }
 
 
+#if defined(FOURQ_METRICS)
+
+static unsigned int tracer_begins, tracer_ends, tracer_failures, tracer_events, tracer_mismatches;
+
+static void* tracer_begin(metrics_call_t call, void* context)
+{
+    tracer_begins++;
+    return (void*)((size_t)call + (size_t)context);       // Span handle, checked by tracer_end()
+}
+
+static void tracer_end(void* span, metrics_call_t call, ECCRYPTO_STATUS status, uint64_t latency_ns, void* context)
+{
+    (void)latency_ns;
+    tracer_ends++;
+    if (status != ECCRYPTO_SUCCESS) tracer_failures++;
+    if (span != (void*)((size_t)call + (size_t)context)) tracer_mismatches++;
+}
+
+static void tracer_event(metrics_event_t event, void* context)
+{
+    (void)event; (void)context;
+    tracer_events++;
+}
+
+#if (OS_TARGET == OS_LINUX)
+#define METRICS_THREADS       8
+#define METRICS_THREAD_CALLS  4
+
+static void* metrics_thread(void* arg)
+{ // API calls on a thread that exits right after them
+    unsigned char PublicKey[32];
+    unsigned int i;
+
+    for (i = 0; i < METRICS_THREAD_CALLS; i++) {
+        CompressedPublicKeyGeneration((const unsigned char*)arg, PublicKey);
+    }
+    return NULL;
+}
+#endif
+
+
+ECCRYPTO_STATUS metrics_test()
+{ // Test the metrics of the public API
+    int passed;
+    unsigned int i, valid = true, decode_failures = 0, agreements = 0, agreement_failures = 0, total_calls = 0, total_failures = 0, total_events = 0;
+    unsigned char SecretKey[32], PublicKey[32], Signature[64], Signature2[64], SharedSecret[32], Message[32] = {0};
+    unsigned char InvalidKey[32] = {0}, InvalidPoint[64] = {0};
+    uint64_t p50, p99;
+    char text[16], *export = NULL;
+    size_t length;
+    metrics_snapshot_t* snapshot = NULL;
+    metrics_tracer_t tracer = { tracer_begin, tracer_end, tracer_event, (void*)(size_t)1000 };
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
+    printf("Testing the metrics of the public API: \n\n"); 
+
+    snapshot = (metrics_snapshot_t*)malloc(sizeof(metrics_snapshot_t));
+    export = (char*)malloc(65536);
+    if (snapshot == NULL || export == NULL) {
+        Status = ECCRYPTO_ERROR_NO_MEMORY;
+        goto cleanup;
+    }
+    Status = FourQ_SetTracer(&tracer);
+    if (Status != ECCRYPTO_SUCCESS) {
+        goto cleanup;
+    }
+    FourQ_MetricsReset();
+
+    // One valid and one invalid signature
+    Status = SchnorrQ_FullKeyGeneration(SecretKey, PublicKey);
+    if (Status != ECCRYPTO_SUCCESS) {
+        goto cleanup;
+    }
+    Status = SchnorrQ_Sign(SecretKey, PublicKey, Message, sizeof(Message), Signature);
+    if (Status != ECCRYPTO_SUCCESS) {
+        goto cleanup;
+    }
+    Status = SchnorrQ_Verify(PublicKey, Message, sizeof(Message), Signature, &valid);
+    if (Status != ECCRYPTO_SUCCESS) {
+        goto cleanup;
+    }
+    passed = (valid == true);
+    Message[0] ^= 1;
+    Status = SchnorrQ_Verify(PublicKey, Message, sizeof(Message), Signature, &valid);
+    if (Status != ECCRYPTO_SUCCESS) {
+        goto cleanup;
+    }
+    passed &= (valid == false);
+
+    // Secret agreements against encodings until one of them fails to decode
+    for (i = 0; i < 256 && decode_failures == 0; i++) {
+        InvalidKey[0] = (unsigned char)i;
+        agreements++;
+        Status = CompressedSecretAgreement(SecretKey, InvalidKey, SharedSecret);
+        agreement_failures += (Status != ECCRYPTO_SUCCESS);     // Small-order points fail with ECCRYPTO_ERROR_SHARED_KEY
+        decode_failures += (Status == ECCRYPTO_ERROR);
+    }
+    Status = ECCRYPTO_SUCCESS;
+    passed &= (decode_failures == 1);
+
+    // Secret agreement against (0,0), which is not on the curve
+    passed &= (SecretAgreement(SecretKey, InvalidPoint, SharedSecret) == ECCRYPTO_ERROR);
+    FourQ_SetTracer(NULL);
+
+    Status = FourQ_MetricsSnapshot(snapshot);
+    if (Status != ECCRYPTO_SUCCESS) {
+        goto cleanup;
+    }
+    passed &= (snapshot->calls[METRICS_SCHNORRQ_FULLKEYGENERATION].calls == 1 && snapshot->calls[METRICS_SCHNORRQ_KEYGENERATION].calls == 1);
+    passed &= (snapshot->calls[METRICS_SCHNORRQ_SIGN].calls == 1 && snapshot->calls[METRICS_SCHNORRQ_SIGN].failures == 0);
+    passed &= (snapshot->calls[METRICS_SCHNORRQ_VERIFY].calls == 2 && snapshot->calls[METRICS_SCHNORRQ_VERIFY].failures == 0);
+    passed &= (snapshot->calls[METRICS_COMPRESSEDSECRETAGREEMENT].calls == agreements && snapshot->calls[METRICS_COMPRESSEDSECRETAGREEMENT].failures == agreement_failures);
+    passed &= (snapshot->calls[METRICS_SECRETAGREEMENT].calls == 1 && snapshot->calls[METRICS_SECRETAGREEMENT].failures == 1);
+    passed &= (snapshot->calls[METRICS_KEYGENERATION].calls == 0 && snapshot->calls[METRICS_HASHTOCURVE].calls == 0);
+    for (i = 0; i < METRICS_NCALLS; i++) {
+        const metrics_histogram_t* h = &snapshot->calls[i];
+        uint64_t j, count = 0;
+        for (j = 0; j < METRICS_BUCKETS; j++) {
+            count += h->buckets[j];
+        }
+        passed &= (count == h->calls && h->min_ns <= h->max_ns && h->sum_ns >= h->max_ns);
+        total_calls += (unsigned int)h->calls;
+        total_failures += (unsigned int)h->failures;
+    }
+    if (passed==1) printf("  Metrics call and failure counters tests.......................................... PASSED");
+    else { printf("  Metrics call and failure counters tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_DURING_TEST; goto cleanup; }
+    printf("\n");
+
+    passed = (snapshot->events[METRICS_VERIFICATION_FAILURE] == 1);
+    passed &= (snapshot->events[METRICS_DECODE_FAILURE] == decode_failures);
+    passed &= (snapshot->events[METRICS_INVALID_POINT] == 1);
+    for (i = 0; i < METRICS_NEVENTS; i++) {
+        total_events += (unsigned int)snapshot->events[i];
+    }
+    if (passed==1) printf("  Metrics event counters tests..................................................... PASSED");
+    else { printf("  Metrics event counters tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_DURING_TEST; goto cleanup; }
+    printf("\n");
+
+    passed = (tracer_begins == total_calls && tracer_ends == total_calls && tracer_failures == total_failures);
+    passed &= (tracer_events == total_events && tracer_mismatches == 0);
+    Status = SchnorrQ_Sign(SecretKey, PublicKey, Message, sizeof(Message), Signature2);     // Not traced once the tracer is removed
+    if (Status != ECCRYPTO_SUCCESS) {
+        goto cleanup;
+    }
+    passed &= (tracer_begins == total_calls);
+    if (passed==1) printf("  Metrics tracer tests............................................................. PASSED");
+    else { printf("  Metrics tracer tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_DURING_TEST; goto cleanup; }
+    printf("\n");
+
+    p50 = FourQ_MetricsPercentile(&snapshot->calls[METRICS_SCHNORRQ_VERIFY], 0.5);
+    p99 = FourQ_MetricsPercentile(&snapshot->calls[METRICS_SCHNORRQ_VERIFY], 0.99);
+    passed = (snapshot->calls[METRICS_SCHNORRQ_VERIFY].min_ns <= p50 && p50 <= p99 && p99 == snapshot->calls[METRICS_SCHNORRQ_VERIFY].max_ns);
+    passed &= (FourQ_MetricsPercentile(&snapshot->calls[METRICS_HASHTOCURVE], 0.5) == 0);
+
+    FourQ_MetricsReset();
+    Status = SchnorrQ_Verify(PublicKey, Message, sizeof(Message), Signature, &valid);
+    if (Status != ECCRYPTO_SUCCESS) {
+        goto cleanup;
+    }
+    length = FourQ_MetricsExport(export, 65536);
+    passed &= (length > 0 && length < 65536 && strlen(export) == length);
+    passed &= (strstr(export, "fourq_calls_total{call=\"SchnorrQ_Verify\"} 1\n") != NULL);
+    passed &= (strstr(export, "fourq_calls_total{call=\"SchnorrQ_Sign\"} 0\n") != NULL);
+    passed &= (strstr(export, "fourq_latency_seconds_count{call=\"SchnorrQ_Verify\"} 1\n") != NULL);
+    passed &= (strstr(export, "fourq_latency_seconds{call=\"SchnorrQ_Verify\",quantile=\"0.99\"} ") != NULL);
+    passed &= (strstr(export, "fourq_latency_seconds_count{call=\"SchnorrQ_Sign\"}") == NULL);
+    passed &= (strstr(export, "fourq_events_total{event=\"verification_failure\"} 1\n") != NULL);
+    passed &= (FourQ_MetricsExport(text, sizeof(text)) == length && strlen(text) == sizeof(text)-1 && memcmp(text, export, sizeof(text)-1) == 0);
+    if (passed==1) printf("  Metrics percentile and export tests.............................................. PASSED");
+    else { printf("  Metrics percentile and export tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_DURING_TEST; goto cleanup; }
+    printf("\n");
+
+#if (OS_TARGET == OS_LINUX)
+    // The shards of exited threads are folded into the metrics of the process, and cleared by a reset
+    {
+        pthread_t threads[METRICS_THREADS];
+        FourQ_MetricsReset();
+        passed = 1;
+        for (i = 0; i < METRICS_THREADS; i++) {
+            if (pthread_create(&threads[i], NULL, metrics_thread, SecretKey) != 0 || pthread_join(threads[i], NULL) != 0) { passed = 0; break; }
+        }
+        Status = FourQ_MetricsSnapshot(snapshot);
+        if (Status != ECCRYPTO_SUCCESS) {
+            goto cleanup;
+        }
+        passed &= (snapshot->calls[METRICS_COMPRESSEDPUBLICKEYGENERATION].calls == METRICS_THREADS*METRICS_THREAD_CALLS);
+        passed &= (snapshot->calls[METRICS_COMPRESSEDPUBLICKEYGENERATION].failures == 0);
+        FourQ_MetricsReset();
+        FourQ_MetricsSnapshot(snapshot);
+        passed &= (snapshot->calls[METRICS_COMPRESSEDPUBLICKEYGENERATION].calls == 0);
+        if (passed==1) printf("  Metrics of exited threads tests.................................................. PASSED");
+        else { printf("  Metrics of exited threads tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_DURING_TEST; goto cleanup; }
+        printf("\n");
+    }
+#endif
+
+cleanup:
+    FourQ_SetTracer(NULL);
+    free(snapshot);
+    free(export);
+    
+    return Status;
+}
+
+#endif
+
+
+#if defined(FOURQ_COUNT_OPS)
+
+ECCRYPTO_STATUS op_counts_run()
+{ // Operation counts of SchnorrQ and of the key exchanges
+    unsigned char SecretKey[32], SecretKeyB[32], PublicKey[32], PublicKeyLong[64], EphemeralPublicKey[32], SharedSecret[32], Signature[64];
+    unsigned char Message[32] = {0};
+    unsigned int valid = false;
+    op_counts_t counts;
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Operation counts of SchnorrQ and DH key exchange: \n\n");
+    print_op_counts_header();
+
+    FourQ_ResetOpCounts();
+    Status = SchnorrQ_KeyGeneration(SecretKey, PublicKey);
+    FourQ_GetOpCounts(&counts);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+    print_op_counts("SchnorrQ_KeyGeneration", &counts);
+
+    FourQ_ResetOpCounts();
+    Status = SchnorrQ_FullKeyGeneration(SecretKey, PublicKey);
+    FourQ_GetOpCounts(&counts);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+    print_op_counts("SchnorrQ_FullKeyGeneration", &counts);
+
+    FourQ_ResetOpCounts();
+    Status = SchnorrQ_Sign(SecretKey, PublicKey, Message, sizeof(Message), Signature);
+    FourQ_GetOpCounts(&counts);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+    print_op_counts("SchnorrQ_Sign", &counts);
+
+    FourQ_ResetOpCounts();
+    Status = SchnorrQ_Verify(PublicKey, Message, sizeof(Message), Signature, &valid);
+    FourQ_GetOpCounts(&counts);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+    if (valid == false) {
+        return ECCRYPTO_ERROR_SIGNATURE_VERIFICATION;
+    }
+    print_op_counts("SchnorrQ_Verify", &counts);
+
+    FourQ_ResetOpCounts();
+    Status = CompressedKeyGeneration(SecretKey, PublicKey);
+    FourQ_GetOpCounts(&counts);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+    print_op_counts("CompressedKeyGeneration", &counts);
+
+    FourQ_ResetOpCounts();
+    Status = CompressedSecretAgreement(SecretKey, PublicKey, SharedSecret);
+    FourQ_GetOpCounts(&counts);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+    print_op_counts("CompressedSecretAgreement", &counts);
+
+    FourQ_ResetOpCounts();
+    Status = EphemeralKeyAgreement(PublicKey, SecretKeyB, EphemeralPublicKey, SharedSecret);
+    FourQ_GetOpCounts(&counts);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+    print_op_counts("EphemeralKeyAgreement", &counts);
+
+    FourQ_ResetOpCounts();
+    Status = KeyGeneration(SecretKey, PublicKeyLong);
+    FourQ_GetOpCounts(&counts);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+    print_op_counts("KeyGeneration", &counts);
+
+    FourQ_ResetOpCounts();
+    Status = SecretAgreement(SecretKey, PublicKeyLong, SharedSecret);
+    FourQ_GetOpCounts(&counts);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+    print_op_counts("SecretAgreement", &counts);
+
+    return Status;
+}
+
+#endif
+
+
 int main()
 {
     ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
@@ -337,6 +1270,39 @@ int main()
         return false;
     }
     Status = SchnorrQ_run();          // Benchmark SchnorrQ signature scheme
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+
+    Status = SchnorrQ_cache_test();   // Test the cache of verified SchnorrQ signatures
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+    Status = SchnorrQ_cache_run();    // Benchmark the cache of verified SchnorrQ signatures
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+
+    Status = SchnorrQ_batch_test();    // Test batched SchnorrQ signature verification
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+    Status = SchnorrQ_batch_run();     // Benchmark batched SchnorrQ signature verification
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+
+    Status = hash_provider_test();     // Test the hash providers used by SchnorrQ
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+    Status = hash_provider_run();      // Benchmark the hash providers used by SchnorrQ
     if (Status != ECCRYPTO_SUCCESS) {
         printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
         return false;
@@ -353,6 +1319,17 @@ int main()
 		return false;
 	}
 
+    Status = ephemeral_pool_test();    // Test the pool of pre-generated ephemeral keypairs
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+    Status = ephemeral_pool_run();     // Benchmark the pool of pre-generated ephemeral keypairs
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+
 	Status = kex_test();              // Test Diffie-Hellman key exchange using uncompressed public keys
 	if (Status != ECCRYPTO_SUCCESS) {
 		printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
@@ -364,5 +1341,21 @@ int main()
 		return false;
 	}
 
+#if defined(FOURQ_METRICS)
+    Status = metrics_test();           // Test the metrics of the public API
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+#endif
+
+#if defined(FOURQ_COUNT_OPS)
+    Status = op_counts_run();          // Operation counts of SchnorrQ and DH key exchange
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+#endif
+
     return true;
 }
\ No newline at end of file
@@ -0,0 +1,482 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: comparative benchmark of FourQ and Curve25519
+*
+* The same workloads run through SchnorrQ and FourQ's compressed key exchange, and through
+* BoringSSL's Ed25519 and X25519 (unmodified, in ../curve25519/ring): signature key generation,
+* signing, verification, batched verification (sequential for Curve25519, so without a ratio),
+* and Diffie-Hellman key generation and agreement, on 64-byte messages. Latency (min/median/p99 per call) is measured on one
+* thread; throughput on one thread and on several threads running concurrently, each with
+* its own keys. Before measuring, the Curve25519 implementation is checked against the test
+* vectors of RFC 8032 and RFC 7748.
+************************************************************************************/
+
+#define _GNU_SOURCE
+#include "../FourQ_internal.h"
+#include "../../curve25519/curve25519.h"
+#include "../../random/random.h"
+#include "test_extras.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+
+// Default parameters
+#define DEFAULT_SAMPLES       1000       // Number of measured samples per operation
+#define DEFAULT_BATCH         64         // Signatures per batch for batched verification
+#define DEFAULT_SECONDS       1.0        // Duration of each throughput run
+#define WARMUP_DIVISOR        10
+#define MAX_BATCH             4096
+#define MAX_THREADS           256
+#define MESSAGE_BYTES         64
+
+#if (TARGET == TARGET_ARM || TARGET == TARGET_ARM64)
+    #define COUNTER_UNIT      "nsec"     // cpucycles() reads a clock on these targets
+#else
+    #define COUNTER_UNIT      "cycles"
+#endif
+
+typedef enum { CURVE_FOURQ, CURVE_25519, NCURVES } curve_t;
+static const char* curve_names[NCURVES] = { "FourQ", "Curve25519" };
+
+typedef struct {                         // Keys and messages of one thread for one curve
+    unsigned char secret[32], public_key[32], message[MESSAGE_BYTES], signature[64];
+    unsigned char dh_public[32], peer_public[32], shared[32];
+    unsigned int batch;
+    unsigned char *batch_public, *batch_message, *batch_signature;
+    const unsigned char **public_ptrs, **message_ptrs, **signature_ptrs;
+    unsigned int *sizes, *valid;
+} workload;
+
+typedef struct {
+    double ns[3];                        // min, median, p99 per call
+    double cycles;                       // median per call
+    double throughput[2];                // Calls per second on one thread and on all threads
+} bench_result;
+
+
+static void fourq_keygen(workload* w)        { SchnorrQ_KeyGeneration(w->secret, w->public_key); }
+static void fourq_sign(workload* w)          { SchnorrQ_Sign(w->secret, w->public_key, w->message, MESSAGE_BYTES, w->signature); }
+static void fourq_verify(workload* w)        { SchnorrQ_Verify(w->public_key, w->message, MESSAGE_BYTES, w->signature, w->valid); }
+static void fourq_verify_batch(workload* w)  { SchnorrQ_VerifyBatch(w->public_ptrs, w->message_ptrs, w->sizes, w->signature_ptrs, w->batch, w->valid); }
+static void fourq_dh_keygen(workload* w)     { CompressedPublicKeyGeneration(w->secret, w->dh_public); }
+static void fourq_dh_agree(workload* w)      { CompressedSecretAgreement(w->secret, w->peer_public, w->shared); }
+
+static void ref_keygen(workload* w)          { crypto_ed25519_public_key(w->secret, w->public_key); }
+static void ref_sign(workload* w)            { crypto_ed25519_sign(w->secret, w->public_key, w->message, MESSAGE_BYTES, w->signature); }
+static void ref_verify(workload* w)          { w->valid[0] = (crypto_ed25519_verify(w->public_key, w->message, MESSAGE_BYTES, w->signature) == 0); }
+static void ref_dh_keygen(workload* w)       { crypto_x25519_base(w->dh_public, w->secret); }
+static void ref_dh_agree(workload* w)        { crypto_x25519(w->shared, w->secret, w->peer_public); }
+
+static void ref_verify_batch(workload* w)
+{ // Ed25519 has no batched verification here, so the batch is verified one signature at a time
+    unsigned int i;
+
+    for (i = 0; i < w->batch; i++) {
+        w->valid[i] = (crypto_ed25519_verify(w->public_ptrs[i], w->message_ptrs[i], MESSAGE_BYTES, w->signature_ptrs[i]) == 0);
+    }
+}
+
+typedef struct {
+    const char* name;
+    bool batched;                        // One run verifies a whole batch
+    bool sequential;                     // Curve25519 runs the batch one call at a time, so no ratio is reported
+    void (*run[NCURVES])(workload* w);
+} operation;
+
+static const operation operations[] = {
+    { "sign_keygen",   false, false, { fourq_keygen,       ref_keygen } },
+    { "sign",          false, false, { fourq_sign,         ref_sign } },
+    { "verify",        false, false, { fourq_verify,       ref_verify } },
+    { "verify_batch",  true,  true,  { fourq_verify_batch, ref_verify_batch } },
+    { "dh_keygen",     false, false, { fourq_dh_keygen,    ref_dh_keygen } },
+    { "dh_agree",      false, false, { fourq_dh_agree,     ref_dh_agree } },
+};
+
+#define NOPERATIONS (sizeof(operations)/sizeof(operations[0]))
+
+
+static int64_t now_ns(void)
+{ // Monotonic clock in nanoseconds
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (int64_t)time.tv_sec*1000000000 + (int64_t)time.tv_nsec;
+}
+
+
+static int compare_doubles(const void* a, const void* b)
+{
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+
+static double percentile(const double* sorted, unsigned int n, double p)
+{ // Nearest-rank percentile of sorted[0..n-1]
+    unsigned int rank = (unsigned int)(p*n);
+
+    if (rank < p*n) rank++;
+    if (rank < 1) rank = 1;
+    return sorted[rank - 1];
+}
+
+
+static void sign_keypair(curve_t curve, unsigned char* secret, unsigned char* public_key, const unsigned char* message, unsigned char* signature)
+{ // Fresh signing key, and the signature of message under it
+    random_bytes(secret, 32);
+    if (curve == CURVE_FOURQ) {
+        SchnorrQ_KeyGeneration(secret, public_key);
+        SchnorrQ_Sign(secret, public_key, message, MESSAGE_BYTES, signature);
+    } else {
+        crypto_ed25519_public_key(secret, public_key);
+        crypto_ed25519_sign(secret, public_key, message, MESSAGE_BYTES, signature);
+    }
+}
+
+
+static bool workload_init(workload* w, curve_t curve, unsigned int batch)
+{ // Random keys, messages and signatures. Returns false if out of memory
+    unsigned char peer_secret[32];
+    unsigned int i;
+
+    memset(w, 0, sizeof(workload));
+    w->batch = batch;
+    w->batch_public = (unsigned char*)malloc(batch*32);
+    w->batch_message = (unsigned char*)malloc(batch*MESSAGE_BYTES);
+    w->batch_signature = (unsigned char*)malloc(batch*64);
+    w->public_ptrs = (const unsigned char**)malloc(batch*sizeof(unsigned char*));
+    w->message_ptrs = (const unsigned char**)malloc(batch*sizeof(unsigned char*));
+    w->signature_ptrs = (const unsigned char**)malloc(batch*sizeof(unsigned char*));
+    w->sizes = (unsigned int*)malloc(batch*sizeof(unsigned int));
+    w->valid = (unsigned int*)malloc(batch*sizeof(unsigned int));
+    if (w->batch_public == NULL || w->batch_message == NULL || w->batch_signature == NULL || w->public_ptrs == NULL ||
+        w->message_ptrs == NULL || w->signature_ptrs == NULL || w->sizes == NULL || w->valid == NULL) {
+        return false;
+    }
+
+    random_bytes(w->message, MESSAGE_BYTES);
+    sign_keypair(curve, w->secret, w->public_key, w->message, w->signature);
+    random_bytes(peer_secret, 32);
+    if (curve == CURVE_FOURQ) {
+        CompressedPublicKeyGeneration(peer_secret, w->peer_public);
+    } else {
+        crypto_x25519_base(w->peer_public, peer_secret);
+    }
+    for (i = 0; i < batch; i++) {
+        random_bytes(w->batch_message + i*MESSAGE_BYTES, MESSAGE_BYTES);
+        sign_keypair(curve, peer_secret, w->batch_public + i*32, w->batch_message + i*MESSAGE_BYTES, w->batch_signature + i*64);
+        w->public_ptrs[i] = w->batch_public + i*32;
+        w->message_ptrs[i] = w->batch_message + i*MESSAGE_BYTES;
+        w->signature_ptrs[i] = w->batch_signature + i*64;
+        w->sizes[i] = MESSAGE_BYTES;
+    }
+    return true;
+}
+
+
+static void workload_free(workload* w)
+{
+    free(w->batch_public);
+    free(w->batch_message);
+    free(w->batch_signature);
+    free((void*)w->public_ptrs);
+    free((void*)w->message_ptrs);
+    free((void*)w->signature_ptrs);
+    free(w->sizes);
+    free(w->valid);
+}
+
+
+static void hex_to_bytes(const char* hex, unsigned char* bytes, unsigned int n)
+{
+    unsigned int i, byte;
+
+    for (i = 0; i < n; i++) {
+        sscanf(hex + 2*i, "%2x", &byte);
+        bytes[i] = (unsigned char)byte;
+    }
+}
+
+
+static bool self_test(void)
+{ // Test vectors 1 and 2 of RFC 8032 (Section 7.1) and the X25519 vectors of RFC 7748 (Sections 5.2 and 6.1),
+  // and sign/verify round trips of both implementations including the rejection of a modified signature
+    static const char* ed25519[2][4] = {
+        { "9d61b19deffd5a60ba844af492ec2cc44449c5697b326919703bac031cae7f60", "d75a980182b10ab7d54bfed3c964073a0ee172f3daa62325af021a68f707511a", "",
+          "e5564300c360ac729086e2cc806e828a84877f1eb8e5d974d873e065224901555fb8821590a33bacc61e39701cf9b46bd25bf5f0595bbe24655141438e7a100b" },
+        { "4ccd089b28ff96da9db6c346ec114e0f5b8a319f35aba624da8cf6ed4fb8a6fb", "3d4017c3e843895a92b70aa74d1b7ebc9c982ccf2ec4968cc0cd55f12af4660c", "72",
+          "92a009a9f0d4cab8720e820b5f642540a2b27b5416503f8fb3762223ebdb69da085ac1e43e15996e458f3613d0f11d8c387b2eaeb4302aeeb00d291612bb0c00" } };
+    static const char* x25519[3][3] = {
+        { "a546e36bf0527c9d3b16154b82465edd62144c0ac1fc5a18506a2244ba449ac4", "e6db6867583030db3594c1a424b15f7c726624ec26b3353b10a903a6d0ab1c4c",
+          "c3da55379de9c6908e94ea4df28d084f32eccf03491c71f754b4075577a28552" },
+        { "77076d0a7318a57d3c16c17251b26645df4c2f87ebc0992ab177fba51db92c2a", "0900000000000000000000000000000000000000000000000000000000000000",
+          "8520f0098930a754748b7ddcb43ef75a0dbf3a0d26381af4eba4a98eaa9b4e6a" },
+        { "77076d0a7318a57d3c16c17251b26645df4c2f87ebc0992ab177fba51db92c2a", "de9edb7d7b7dc1b4d35b61c2ece435373f8343c85b78674dadfc7e146f882b4f",
+          "4a5d9d5ba4ce2de1728e3bf480350f25e07e21c947d19e3376f09b3c1e161742" } };
+    unsigned char secret[32], public_key[32], message[MESSAGE_BYTES], signature[64], expected[64], output[32];
+    unsigned int i, valid;
+
+    for (i = 0; i < 2; i++) {
+        hex_to_bytes(ed25519[i][0], secret, 32);
+        hex_to_bytes(ed25519[i][2], message, (unsigned int)strlen(ed25519[i][2])/2);
+        crypto_ed25519_public_key(secret, public_key);
+        hex_to_bytes(ed25519[i][1], expected, 32);
+        if (memcmp(public_key, expected, 32) != 0) return false;
+        crypto_ed25519_sign(secret, public_key, message, strlen(ed25519[i][2])/2, signature);
+        hex_to_bytes(ed25519[i][3], expected, 64);
+        if (memcmp(signature, expected, 64) != 0) return false;
+        if (crypto_ed25519_verify(public_key, message, strlen(ed25519[i][2])/2, signature) != 0) return false;
+    }
+    for (i = 0; i < 3; i++) {
+        hex_to_bytes(x25519[i][0], secret, 32);
+        hex_to_bytes(x25519[i][1], public_key, 32);
+        hex_to_bytes(x25519[i][2], expected, 32);
+        if (crypto_x25519(output, secret, public_key) != 0 || memcmp(output, expected, 32) != 0) return false;
+    }
+
+    random_bytes(message, MESSAGE_BYTES);
+    sign_keypair(CURVE_25519, secret, public_key, message, signature);
+    if (crypto_ed25519_verify(public_key, message, MESSAGE_BYTES, signature) != 0) return false;
+    signature[40] ^= 1;
+    if (crypto_ed25519_verify(public_key, message, MESSAGE_BYTES, signature) == 0) return false;
+    sign_keypair(CURVE_FOURQ, secret, public_key, message, signature);
+    if (SchnorrQ_Verify(public_key, message, MESSAGE_BYTES, signature, &valid) != ECCRYPTO_SUCCESS || valid == false) return false;
+    signature[40] ^= 1;
+    if (SchnorrQ_Verify(public_key, message, MESSAGE_BYTES, signature, &valid) != ECCRYPTO_SUCCESS || valid == true) return false;
+    return true;
+}
+
+
+static void measure_latency(const operation* op, curve_t curve, workload* w, unsigned int samples, bench_result* result)
+{ // Latency per call on the calling thread, over samples runs after samples/WARMUP_DIVISOR warm-up runs
+    double *ns = (double*)malloc(samples*sizeof(double)), *cycles = (double*)malloc(samples*sizeof(double));
+    unsigned int i, calls = op->batched ? w->batch : 1;
+    int64_t t0, c0;
+
+    for (i = 0; i < samples/WARMUP_DIVISOR; i++) {
+        op->run[curve](w);
+    }
+    for (i = 0; i < samples; i++) {
+        t0 = now_ns();
+        c0 = cpucycles();
+        op->run[curve](w);
+        cycles[i] = (double)(cpucycles() - c0)/calls;
+        ns[i] = (double)(now_ns() - t0)/calls;
+    }
+    qsort(ns, samples, sizeof(double), compare_doubles);
+    qsort(cycles, samples, sizeof(double), compare_doubles);
+    result->ns[0] = ns[0];
+    result->ns[1] = percentile(ns, samples, 0.50);
+    result->ns[2] = percentile(ns, samples, 0.99);
+    result->cycles = percentile(cycles, samples, 0.50);
+    free(ns);
+    free(cycles);
+}
+
+
+typedef struct {
+    const operation* op;
+    curve_t curve;
+    workload* w;
+    double seconds, rate;
+    pthread_barrier_t* start;
+} worker;
+
+static void* worker_run(void* arg)
+{ // Runs the operation for the given time, and sets rate to the number of calls per second
+    worker* job = (worker*)arg;
+    unsigned int calls = job->op->batched ? job->w->batch : 1;
+    uint64_t n = 0;
+    int64_t start, elapsed;
+
+    pthread_barrier_wait(job->start);
+    start = now_ns();
+    do {
+        job->op->run[job->curve](job->w);
+        n += calls;
+        elapsed = now_ns() - start;
+    } while (elapsed < (int64_t)(job->seconds*1e9));
+    job->rate = n*1e9/elapsed;
+    return NULL;
+}
+
+
+static double measure_throughput(const operation* op, curve_t curve, workload* w, unsigned int nthreads, double seconds)
+{ // Total calls per second of nthreads threads running the operation concurrently, each on its own workload
+    worker jobs[MAX_THREADS];
+    pthread_t threads[MAX_THREADS];
+    pthread_barrier_t start;
+    double rate = 0;
+    unsigned int i;
+
+    pthread_barrier_init(&start, NULL, nthreads);
+    for (i = 0; i < nthreads; i++) {
+        jobs[i].op = op;
+        jobs[i].curve = curve;
+        jobs[i].w = &w[i];
+        jobs[i].seconds = seconds;
+        jobs[i].start = &start;
+        pthread_create(&threads[i], NULL, worker_run, &jobs[i]);
+    }
+    for (i = 0; i < nthreads; i++) {
+        pthread_join(threads[i], NULL);
+        rate += jobs[i].rate;
+    }
+    pthread_barrier_destroy(&start);
+    return rate;
+}
+
+
+static void print_ratio(FILE* out, const operation* op, double ratio)
+{ // A batched FourQ run against a sequential Curve25519 one is not a like-for-like ratio
+    if (op->sequential) {
+        fprintf(out, " %7s ", "n/a");
+    } else {
+        fprintf(out, " %7.2fx", ratio);
+    }
+}
+
+
+static void print_results(FILE* out, bool csv, bench_result results[][NCURVES], unsigned int nthreads, unsigned int samples, unsigned int batch)
+{
+    unsigned int i, c;
+    const bench_result* r;
+
+    if (csv) {
+        fprintf(out, "operation,curve,sequential,threads,min_ns,median_ns,p99_ns,median_%s,throughput_single,throughput_threads\n", COUNTER_UNIT);
+        for (i = 0; i < NOPERATIONS; i++) {
+            for (c = 0; c < NCURVES; c++) {
+                r = &results[i][c];
+                fprintf(out, "%s,%s,%d,%u,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f\n", operations[i].name, curve_names[c], c == CURVE_25519 && operations[i].sequential, nthreads, r->ns[0], r->ns[1], r->ns[2], r->cycles, r->throughput[0], r->throughput[1]);
+            }
+        }
+        return;
+    }
+
+    fprintf(out, "\nFourQ vs Curve25519: %u samples, batches of %u signatures, %u thread(s)\n\n", samples, batch, nthreads);
+    fprintf(out, "Latency per call, in ns (median %s in brackets)\n\n", COUNTER_UNIT);
+    fprintf(out, "  %-14s %10s %20s %10s   %10s %20s %10s   %8s\n", "operation", "FourQ min", "median", "p99", "25519 min", "median", "p99", "speedup");
+    for (i = 0; i < NOPERATIONS; i++) {
+        fprintf(out, "  %-14s", operations[i].name);
+        for (c = 0; c < NCURVES; c++) {
+            r = &results[i][c];
+            fprintf(out, " %10.0f %9.0f (%8.0f) %10.0f  ", r->ns[0], r->ns[1], r->cycles, r->ns[2]);
+        }
+        print_ratio(out, &operations[i], results[i][CURVE_25519].ns[1]/results[i][CURVE_FOURQ].ns[1]);
+        fprintf(out, "\n");
+    }
+
+    fprintf(out, "\nThroughput, in calls per second\n\n");
+    fprintf(out, "  %-14s %12s %12s %8s   %12s %12s %8s\n", "operation", "FourQ x1", "25519 x1", "ratio", "FourQ", "25519", "ratio");
+    for (i = 0; i < NOPERATIONS; i++) {
+        fprintf(out, "  %-14s %12.0f %12.0f", operations[i].name, results[i][CURVE_FOURQ].throughput[0], results[i][CURVE_25519].throughput[0]);
+        print_ratio(out, &operations[i], results[i][CURVE_FOURQ].throughput[0]/results[i][CURVE_25519].throughput[0]);
+        fprintf(out, "   %12.0f %12.0f", results[i][CURVE_FOURQ].throughput[1], results[i][CURVE_25519].throughput[1]);
+        print_ratio(out, &operations[i], results[i][CURVE_FOURQ].throughput[1]/results[i][CURVE_25519].throughput[1]);
+        fprintf(out, "\n");
+    }
+    fprintf(out, "\n  The right-hand columns run %u thread(s) concurrently. Ratios and speedups above 1 favor FourQ.\n", nthreads);
+    fprintf(out, "  verify_batch is per signature. Curve25519 has no batched verification here and verifies its batches one\n");
+    fprintf(out, "  signature at a time, so no ratio is reported for it (n/a).\n");
+}
+
+
+static void usage(const char* program)
+{
+    printf("Usage: %s [options]\n\n", program);
+    printf("  --samples N         measured samples per operation for the latency (default %d)\n", DEFAULT_SAMPLES);
+    printf("  --batch N           signatures per batch for verify_batch (default %d)\n", DEFAULT_BATCH);
+    printf("  --threads N         threads for the multi-threaded throughput (default: online processors)\n");
+    printf("  --seconds S         duration of each throughput run (default %.1f)\n", DEFAULT_SECONDS);
+    printf("  --format FORMAT     text or csv (default text)\n");
+    printf("  --output FILE       write the results to FILE instead of the standard output\n\n");
+    printf("Exit status: 0 on success, 1 if the self-test failed, 2 on usage errors.\n");
+}
+
+
+int main(int argc, char** argv)
+{
+    unsigned int samples = DEFAULT_SAMPLES, batch = DEFAULT_BATCH, nthreads = (unsigned int)sysconf(_SC_NPROCESSORS_ONLN);
+    double seconds = DEFAULT_SECONDS;
+    bool csv = false;
+    const char* output = NULL;
+    FILE* out = stdout;
+    bench_result results[NOPERATIONS][NCURVES];
+    workload* w[NCURVES];
+    unsigned int i, c;
+    int arg;
+
+    for (arg = 1; arg < argc; arg++) {
+        if (strcmp(argv[arg], "--samples") == 0 && arg+1 < argc) {
+            samples = (unsigned int)atoi(argv[++arg]);
+        } else if (strcmp(argv[arg], "--batch") == 0 && arg+1 < argc) {
+            batch = (unsigned int)atoi(argv[++arg]);
+        } else if (strcmp(argv[arg], "--threads") == 0 && arg+1 < argc) {
+            nthreads = (unsigned int)atoi(argv[++arg]);
+        } else if (strcmp(argv[arg], "--seconds") == 0 && arg+1 < argc) {
+            seconds = atof(argv[++arg]);
+        } else if (strcmp(argv[arg], "--format") == 0 && arg+1 < argc && (strcmp(argv[arg+1], "text") == 0 || strcmp(argv[arg+1], "csv") == 0)) {
+            csv = (strcmp(argv[++arg], "csv") == 0);
+        } else if (strcmp(argv[arg], "--output") == 0 && arg+1 < argc) {
+            output = argv[++arg];
+        } else {
+            usage(argv[0]);
+            return (strcmp(argv[arg], "--help") == 0) ? 0 : 2;
+        }
+    }
+    if (samples == 0 || batch == 0 || batch > MAX_BATCH || nthreads == 0 || nthreads > MAX_THREADS || seconds <= 0) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    if (self_test() == false) {
+        fprintf(stderr, "curve_bench: self-test FAILED\n");
+        return 1;
+    }
+
+    for (c = 0; c < NCURVES; c++) {
+        w[c] = (workload*)calloc(nthreads, sizeof(workload));
+        for (i = 0; i < nthreads; i++) {
+            if (w[c] == NULL || workload_init(&w[c][i], (curve_t)c, batch) == false) {
+                fprintf(stderr, "curve_bench: out of memory\n");
+                return 1;
+            }
+        }
+    }
+
+    for (i = 0; i < NOPERATIONS; i++) {
+        for (c = 0; c < NCURVES; c++) {
+            fprintf(stderr, "curve_bench: %s, %s\n", operations[i].name, curve_names[c]);
+            measure_latency(&operations[i], (curve_t)c, &w[c][0], samples, &results[i][c]);
+            results[i][c].throughput[0] = measure_throughput(&operations[i], (curve_t)c, w[c], 1, seconds);
+            results[i][c].throughput[1] = measure_throughput(&operations[i], (curve_t)c, w[c], nthreads, seconds);
+        }
+    }
+
+    if (output != NULL) {
+        out = fopen(output, "w");
+        if (out == NULL) {
+            fprintf(stderr, "curve_bench: cannot write %s\n", output);
+            return 2;
+        }
+    }
+    print_results(out, csv, results, nthreads, samples, batch);
+    if (output != NULL) {
+        fclose(out);
+    }
+
+    for (c = 0; c < NCURVES; c++) {
+        for (i = 0; i < nthreads; i++) {
+            workload_free(&w[c][i]);
+        }
+        free(w[c]);
+    }
+    return 0;
+}
@@ -11,6 +11,8 @@
 #include "../FourQ_tables.h"
 #include "test_extras.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 
 // Benchmark and test parameters  
@@ -22,6 +24,30 @@
     #define SHORT_BENCH_LOOPS 10000
 #endif
 #define TEST_LOOPS            1000       // Number of iterations per test
+#define COLD_BENCH_LOOPS      1000       // Number of iterations per bench with the precomputed tables evicted from the caches
+
+static long long cold_cycles[COLD_BENCH_LOOPS], penalty_cycles[COLD_BENCH_LOOPS];
+static unsigned char control_table[sizeof(DOUBLE_SCALAR_TABLE)] = {1};       // Initialized, so that it does not map to the zero page
+
+#if (TARGET == TARGET_AMD64)
+    #define evict_control(bytes)  cache_evict(control_table, bytes)     // Flushes as many lines as the cold call, but of another buffer
+#else
+    #define evict_control(bytes)                                        // cache_evict() empties all of the caches on these targets
+#endif
+
+
+static int compare_cycles(const void* a, const void* b)
+{
+    long long x = *(const long long*)a, y = *(const long long*)b;
+    return (x > y) - (x < y);
+}
+
+
+static long long median_cycles(long long* samples, unsigned int n)
+{ // Median of n samples, which are sorted in place
+    qsort(samples, n, sizeof(long long), compare_cycles);
+    return samples[n/2];
+}
 
 
 bool ecc_test()
@@ -200,6 +226,35 @@ bool ecc_test()
     else { printf("  Recoding and decomposition tests ... FAILED"); printf("\n"); return false; }
     printf("\n");
     }
+
+#if defined(SCA_PROTECTION)
+    // Randomized scalar preparation: two preparations of a scalar are recoded differently but give the same result
+    {
+    unsigned int digits1[NDIGITS_VARBASE], sign_masks1[NDIGITS_VARBASE], digits2[NDIGITS_VARBASE], sign_masks2[NDIGITS_VARBASE];
+    point_t B, C;
+
+    eccset(A);
+    for (n=0; n<TEST_LOOPS; n++)
+    {
+        random_scalar_test(scalar);
+        ecc_mul_prepare((digit_t*)scalar, digits1, sign_masks1);
+        ecc_mul_prepare((digit_t*)scalar, digits2, sign_masks2);
+        if (memcmp(digits1, digits2, sizeof(digits1)) == 0 && memcmp(sign_masks1, sign_masks2, sizeof(sign_masks1)) == 0) { passed=0; break; }
+
+        point_setup(A, P);
+        ecc_mul_prepared(P, digits1, sign_masks1);
+        eccnorm(P, B);
+        point_setup(A, P);
+        ecc_mul_prepared(P, digits2, sign_masks2);
+        eccnorm(P, C);
+        if (fp2compare64((uint64_t*)B->x,(uint64_t*)C->x)!=0 || fp2compare64((uint64_t*)B->y,(uint64_t*)C->y)!=0) { passed=0; break; }
+    }
+
+    if (passed==1) printf("  Randomized scalar preparation tests ..................................................... PASSED");
+    else { printf("  Randomized scalar preparation tests ... FAILED"); printf("\n"); return false; }
+    printf("\n");
+    }
+#endif
     }
 #endif
 
@@ -322,8 +377,313 @@ bool ecc_test()
     if (passed==1) printf("  Double scalar multiplication tests ...................................................... PASSED");
     else { printf("  Double scalar multiplication tests ... FAILED"); printf("\n"); return false; }
     printf("\n");
+    }     
+    {    
+    point_t PP, QQ, RR; 
+    point_extproj_t BB;
+    f2elm_t u, zero = {0}, one = {0};
+    uint64_t k[4], msg[4*4];
+    unsigned char dst[] = "FourQ-TEST-V01-CS01-with-SHA512_ELL2_RO_", outputs[20*32], encoded[32];
+    const unsigned char* msgs[20];
+    unsigned int i, sizes[20];
+
+    // Elligator 2 map
+    one[0][0] = 1;
+    for (n=0; n<TEST_LOOPS; n++)
+    {
+        fp2random1271_test(u);
+        if (n == 0) fp2zero1271(u);
+        ecc_map_to_curve(u, BB);
+        eccnorm(BB, PP);
+        point_setup(PP, BB);
+        if (ecc_point_validate(BB) == false) { passed=0; break; }
     }
 
+    if (passed==1) printf("  Elligator 2 map tests ................................................................... PASSED");
+    else { printf("  Elligator 2 map tests ... FAILED"); printf("\n"); return false; }
+    printf("\n");
+
+    // Hashing to the curve
+    for (n=0; n<TEST_LOOPS; n++)
+    {
+        random_scalar_test(msg); 
+        if (HashToCurve((unsigned char*)msg, 32, dst, sizeof(dst)-1, PP) != ECCRYPTO_SUCCESS) { passed=0; break; }
+        point_setup(PP, BB);
+        if (ecc_point_validate(BB) == false) { passed=0; break; }
+        ecc_mul(PP, (digit_t*)&curve_order, RR, false);        // RR = order*PP = (0,1)
+        if (fp2compare64((uint64_t*)RR->x,(uint64_t*)zero)!=0 || fp2compare64((uint64_t*)RR->y,(uint64_t*)one)!=0) { passed=0; break; }
+        if (HashToCurve((unsigned char*)msg, 32, dst, sizeof(dst)-1, QQ) != ECCRYPTO_SUCCESS) { passed=0; break; }
+        if (fp2compare64((uint64_t*)PP->x,(uint64_t*)QQ->x)!=0 || fp2compare64((uint64_t*)PP->y,(uint64_t*)QQ->y)!=0) { passed=0; break; }
+
+        if (EncodeToCurve((unsigned char*)msg, 32, dst, sizeof(dst)-1, QQ) != ECCRYPTO_SUCCESS) { passed=0; break; }
+        point_setup(QQ, BB);
+        if (ecc_point_validate(BB) == false) { passed=0; break; }
+        ecc_mul(QQ, (digit_t*)&curve_order, RR, false);
+        if (fp2compare64((uint64_t*)RR->x,(uint64_t*)zero)!=0 || fp2compare64((uint64_t*)RR->y,(uint64_t*)one)!=0) { passed=0; break; }
+        if (fp2compare64((uint64_t*)PP->x,(uint64_t*)QQ->x)==0 && fp2compare64((uint64_t*)PP->y,(uint64_t*)QQ->y)==0) { passed=0; break; }
+    }
+    if (HashToCurve((unsigned char*)msg, 32, dst, 0, PP) != ECCRYPTO_ERROR_INVALID_PARAMETER) passed=0;
+
+    if (passed==1) printf("  Hash to curve tests ..................................................................... PASSED");
+    else { printf("  Hash to curve tests ... FAILED"); printf("\n"); return false; }
+    printf("\n");
+
+    // Batched evaluation of k*H(x_i)
+    for (n=0; n<TEST_LOOPS/10; n++)
+    {
+        random_scalar_test(k); 
+        for (i = 0; i < 4; i++) random_scalar_test(&msg[4*i]); 
+        for (i = 0; i < 20; i++) {
+            msgs[i] = (unsigned char*)msg + i;
+            sizes[i] = 5*i;
+        }
+        if (HashToCurveEvaluateBatch((unsigned char*)k, msgs, sizes, 20, dst, sizeof(dst)-1, outputs) != ECCRYPTO_SUCCESS) { passed=0; break; }
+        for (i = 0; i < 20; i++) {
+            HashToCurve(msgs[i], sizes[i], dst, sizeof(dst)-1, PP);
+            ecc_mul(PP, (digit_t*)k, QQ, false);
+            encode(QQ, encoded);
+            if (memcmp(encoded, outputs + 32*i, 32) != 0) { passed=0; break; }
+        }
+        if (passed == 0) break;
+    }
+
+    if (passed==1) printf("  Batched hash to curve evaluation tests .................................................. PASSED");
+    else { printf("  Batched hash to curve evaluation tests ... FAILED"); printf("\n"); return false; }
+    printf("\n");
+    }     
+    {    
+    point_t PP, QQ; 
+    point_affine RR[37];
+    uint64_t k[4];
+    unsigned char encoded[37*32];
+    ECCRYPTO_STATUS status[37], status1;
+    unsigned int i;
+
+    // Batched point decompression
+    for (n=0; n<TEST_LOOPS/10; n++)
+    {
+        for (i = 0; i < 37; i++) {
+            random_scalar_test(k); 
+            if (i % 5 == 4) {                                       // Random (mostly invalid) encoding
+                memmove(encoded + 32*i, (unsigned char*)k, 32);
+            } else {
+                if (i == 0) memset((unsigned char*)k, 0, 32);      // Neutral point
+                ecc_mul_fixed((digit_t*)k, PP);
+                encode(PP, encoded + 32*i);
+            }
+        }
+        decode_batch(encoded, RR, status, 37);
+        for (i = 0; i < 37; i++) {
+            status1 = decode(encoded + 32*i, QQ);
+            if (status1 != status[i]) { passed=0; break; }
+            if (status1 == ECCRYPTO_SUCCESS) {
+                mod1271(QQ->x[0]); mod1271(QQ->x[1]); mod1271(RR[i].x[0]); mod1271(RR[i].x[1]);
+                if (fp2compare64((uint64_t*)QQ->x,(uint64_t*)RR[i].x)!=0 || fp2compare64((uint64_t*)QQ->y,(uint64_t*)RR[i].y)!=0) { passed=0; break; }
+            }
+        }
+        if (passed == 0) break;
+    }
+
+    if (passed==1) printf("  Batched point decompression tests ....................................................... PASSED");
+    else { printf("  Batched point decompression tests ... FAILED"); printf("\n"); return false; }
+    printf("\n");
+    }     
+    {    
+    point_t AA; 
+    point_extproj_t G, PP, QQ, RR, SS, OO, TT;
+    uint64_t a[4], b[4], c[4];
+    unsigned char encoded1[32], encoded2[32];
+
+    // Projective point arithmetic API
+    ecc_point_generator(G);
+    ecc_point_neutral(OO);
+    for (n=0; n<TEST_LOOPS; n++)
+    {
+        random_scalar_test(a); random_scalar_test(b); 
+        modulo_order((digit_t*)a, (digit_t*)a);
+        modulo_order((digit_t*)b, (digit_t*)b);
+        add_mod_order((digit_t*)a, (digit_t*)b, (digit_t*)c);
+        ecc_point_mul(G, (digit_t*)a, PP);                       // PP = a*G
+        ecc_point_mul(G, (digit_t*)b, QQ);                       // QQ = b*G
+        ecc_point_add(PP, QQ, RR);                               // RR = (a+b)*G
+        ecc_mul_fixed((digit_t*)c, AA);
+        encode(AA, encoded1);
+        ecc_point_encode(RR, encoded2);
+        if (memcmp(encoded1, encoded2, 32) != 0) { passed=0; break; }
+
+        ecc_point_double(PP, RR);
+        ecc_point_add(PP, PP, SS);                               // 2*PP = PP+PP
+        if (ecc_point_equals(RR, SS) == false || ecc_point_equals(RR, PP) == true) { passed=0; break; }
+
+        ecc_point_neg(QQ, RR);
+        ecc_point_add(RR, QQ, RR);                               // -QQ+QQ = neutral point
+        if (ecc_point_equals(RR, OO) == false) { passed=0; break; }
+
+        ecc_point_to_affine(PP, AA);
+        if (ecc_point_from_affine(AA, RR) == false || ecc_point_equals(RR, PP) == false) { passed=0; break; }
+        ecc_point_encode(PP, encoded1);
+        if (ecc_point_decode(encoded1, RR) != ECCRYPTO_SUCCESS || ecc_point_equals(RR, PP) == false) { passed=0; break; }
+        if (ecc_point_in_subgroup(RR) == false) { passed=0; break; }
+    }
+
+    // Points outside the prime-order subgroup: G+T, where T = (0,-1) has order 2, is decoded but fails the subgroup check
+    ecc_point_neutral(TT); fp2neg1271(TT->y); fp2neg1271(TT->tb);  // T = (0:-1:1:0:-1)
+    ecc_point_add(G, TT, PP);
+    ecc_point_to_affine(PP, AA);
+    if (ecc_point_from_affine(AA, RR) == false || ecc_point_equals(RR, PP) == false) passed=0;
+    ecc_point_encode(PP, encoded1);
+    if (ecc_point_decode(encoded1, RR) != ECCRYPTO_SUCCESS || ecc_point_equals(RR, PP) == false) passed=0;
+    if (ecc_point_in_subgroup(G) == false || ecc_point_in_subgroup(OO) == false || ecc_point_in_subgroup(TT) == true || ecc_point_in_subgroup(RR) == true) passed=0;
+    ecc_point_clear_cofactor(RR, RR);                            // 392*(G+T) = 392*G
+    a[0] = 392; a[1] = 0; a[2] = 0; a[3] = 0;
+    ecc_point_mul(G, (digit_t*)a, SS);
+    if (ecc_point_in_subgroup(RR) == false || ecc_point_equals(RR, SS) == false) passed=0;
+
+    if (passed==1) printf("  Projective point API tests .............................................................. PASSED");
+    else { printf("  Projective point API tests ... FAILED"); printf("\n"); return false; }
+    printf("\n");
+    }
+
+    {    
+    point_affine PP[13], QQ[13], RR[13], UU[13];
+    point_extproj R1[X8_LANES], R2[X8_LANES];
+    point_precomp_t table[NPOINTS_FIXEDBASE];
+    point_t AA;
+    uint64_t k[13*4], l[13*4], temp[4];
+    unsigned int i, digits[X8_LANES*NDIGITS_FIXEDBASE] = {0};
+
+    // Eight-lane fixed-base engine against ecc_mul_fixed(), and the IFMA engine bit for bit against the emulated engine
+    ecc_fixed_base_points(table);
+    for (n=0; n<TEST_LOOPS/20; n++)
+    {
+        for (i = 0; i < X8_LANES; i++) {
+            random_scalar_test(k + 4*i);
+            if (n == 0 && i == 0) memset((unsigned char*)k, 0, 32);    // Zero scalar
+            modulo_order((digit_t*)(k + 4*i), (digit_t*)temp);
+            conversion_to_odd((digit_t*)temp, (digit_t*)temp);
+            mLSB_set_recode(temp, digits + i*NDIGITS_FIXEDBASE);
+            ecc_mul_fixed((digit_t*)(k + 4*i), &PP[i]);
+        }
+        ecc_mul_fixed_x8_emu(table, digits, R1);
+#if defined(IFMA_SUPPORT)
+        if (ecc_batch_uses_ifma() == true) {
+            ecc_mul_fixed_x8_ifma(table, digits, R2);
+            if (memcmp(R1, R2, sizeof(R1)) != 0) { passed=0; break; }
+        }
+#endif
+        eccnorm_batch(R1, QQ, X8_LANES);
+        for (i = 0; i < X8_LANES; i++) {
+            if (fp2compare64((uint64_t*)PP[i].x,(uint64_t*)QQ[i].x)!=0 || fp2compare64((uint64_t*)PP[i].y,(uint64_t*)QQ[i].y)!=0) { passed=0; break; }
+        }
+        if (passed == 0) break;
+    }
+
+#if (USE_ENDO == true)
+    {
+    point_extproj_precomp_t tables[8*X8_LANES];
+    unsigned int var_digits[X8_LANES*NDIGITS_VARBASE], sign_masks[X8_LANES*NDIGITS_VARBASE];
+
+    // Eight-lane variable-base engine against ecc_mul()
+    for (n=0; n<TEST_LOOPS/20 && passed==1; n++)
+    {
+        for (i = 0; i < X8_LANES; i++) {
+            random_scalar_test(k + 4*i);
+            random_scalar_test(l + 4*i);
+            ecc_mul_fixed((digit_t*)(l + 4*i), &PP[i]);
+            point_setup(&PP[i], &R1[i]);
+            ecc_precomp(&R1[i], tables + 8*i);
+            ecc_mul_prepare((digit_t*)(k + 4*i), var_digits + i*NDIGITS_VARBASE, sign_masks + i*NDIGITS_VARBASE);
+            ecc_mul(&PP[i], (digit_t*)(k + 4*i), &RR[i], false);
+        }
+        ecc_mul_table_x8_emu(tables, var_digits, sign_masks, R1);
+#if defined(IFMA_SUPPORT)
+        if (ecc_batch_uses_ifma() == true) {
+            ecc_mul_table_x8_ifma(tables, var_digits, sign_masks, R2);
+            if (memcmp(R1, R2, sizeof(R1)) != 0) { passed=0; break; }
+        }
+#endif
+        eccnorm_batch(R1, QQ, X8_LANES);
+        for (i = 0; i < X8_LANES; i++) {
+            if (fp2compare64((uint64_t*)RR[i].x,(uint64_t*)QQ[i].x)!=0 || fp2compare64((uint64_t*)RR[i].y,(uint64_t*)QQ[i].y)!=0) { passed=0; break; }
+        }
+    }
+    }
+#endif
+
+    if (passed==1) printf("  Eight-lane batch engine tests ........................................................... PASSED");
+    else { printf("  Eight-lane batch engine tests ... FAILED"); printf("\n"); return false; }
+    if (ecc_batch_uses_ifma() == true) printf(" (AVX-512 IFMA engine checked against the emulation)");
+    printf("\n");
+
+    // Batched scalar multiplications against the scalar functions, with a partial group of lanes
+    for (n=0; n<TEST_LOOPS/100; n++)
+    {
+        for (i = 0; i < 13; i++) {
+            random_scalar_test(k + 4*i);
+            random_scalar_test(l + 4*i);
+            ecc_mul_fixed((digit_t*)(l + 4*i), &PP[i]);
+        }
+        ecc_mul_fixed_batch((digit_t*)k, QQ, 13);
+        if (ecc_mul_batch(PP, (digit_t*)k, RR, 13, (n & 1) == 1) == false) { passed=0; break; }
+        if (ecc_mul_double_batch((digit_t*)k, PP, (digit_t*)l, UU, 13) == false) { passed=0; break; }
+        for (i = 0; i < 13 && passed==1; i++) {
+            ecc_mul_fixed((digit_t*)(k + 4*i), AA);
+            if (fp2compare64((uint64_t*)AA->x,(uint64_t*)QQ[i].x)!=0 || fp2compare64((uint64_t*)AA->y,(uint64_t*)QQ[i].y)!=0) { passed=0; break; }
+            ecc_mul(&PP[i], (digit_t*)(k + 4*i), AA, (n & 1) == 1);
+            if (fp2compare64((uint64_t*)AA->x,(uint64_t*)RR[i].x)!=0 || fp2compare64((uint64_t*)AA->y,(uint64_t*)RR[i].y)!=0) { passed=0; break; }
+            ecc_mul_double((digit_t*)(k + 4*i), &PP[i], (digit_t*)(l + 4*i), AA);
+            if (fp2compare64((uint64_t*)AA->x,(uint64_t*)UU[i].x)!=0 || fp2compare64((uint64_t*)AA->y,(uint64_t*)UU[i].y)!=0) { passed=0; break; }
+        }
+        if (passed == 0) break;
+    }
+    fp2copy1271(PP[0].y, PP[5].x);                                  // Point not on the curve
+    if (ecc_mul_batch(PP, (digit_t*)k, RR, 13, false) == true || ecc_mul_double_batch((digit_t*)k, PP, (digit_t*)l, UU, 13) == true) passed=0;
+
+    if (passed==1) printf("  Batched scalar multiplication tests ..................................................... PASSED");
+    else { printf("  Batched scalar multiplication tests ... FAILED"); printf("\n"); return false; }
+    printf("\n");
+    }
+
+#if (OS_TARGET == OS_LINUX)
+    {
+    point_t PP, QQ, RR[4], UU[4], VV[4];
+    uint64_t k[4], l[4];
+    const unsigned int flags[4] = {0, TABLES_HUGE_PAGES, TABLES_NUMA_REPLICAS, TABLES_HUGE_PAGES | TABLES_NUMA_REPLICAS};
+    const char* pages[4] = {"static", "none", "transparent", "explicit"};
+    table_placement_t placement;
+    unsigned int i;
+
+    // Scalar multiplications with each placement of the precomputed tables, against the static tables
+    eccset(PP);
+    for (n=0; n<TEST_LOOPS/100 && passed==1; n++)
+    {
+        random_scalar_test(k); 
+        random_scalar_test(l); 
+        ecc_mul(PP, (digit_t*)l, QQ, false);
+        for (i = 0; i < 4; i++) {
+            if (ecc_tables_place(flags[i]) != ECCRYPTO_SUCCESS) { passed=0; break; }
+            ecc_tables_placement(&placement);
+            if (placement.flags != flags[i] || (placement.copies == 0) != (flags[i] == 0) || placement.bound > placement.copies) { passed=0; break; }
+            if ((flags[i] & TABLES_NUMA_REPLICAS) == 0 && placement.copies > 1) { passed=0; break; }
+            ecc_mul_fixed((digit_t*)k, RR[i]);
+            ecc_mul_double((digit_t*)k, QQ, (digit_t*)l, UU[i]);
+            ecc_mul_fixed_batch((digit_t*)l, VV[i], 1);
+            if (memcmp(RR[i], RR[0], sizeof(point_t)) != 0 || memcmp(UU[i], UU[0], sizeof(point_t)) != 0 || memcmp(VV[i], VV[0], sizeof(point_t)) != 0) { passed=0; break; }
+        }
+    }
+    if (ecc_tables_place(TABLES_NUMA_REPLICAS << 1) != ECCRYPTO_ERROR_INVALID_PARAMETER) passed=0;
+
+    ecc_tables_place(TABLES_HUGE_PAGES);
+    ecc_tables_placement(&placement);
+    if (ecc_tables_place(0) != ECCRYPTO_SUCCESS) passed=0;
+
+    if (passed==1) printf("  Precomputed table placement tests ....................................................... PASSED");
+    else { printf("  Precomputed table placement tests ... FAILED"); printf("\n"); return false; }
+    printf(" (huge pages: %s)", pages[placement.pages]);
+    printf("\n");
+    }
+#endif
+
     return OK;
 }
 
@@ -331,7 +691,7 @@ bool ecc_test()
 bool ecc_run()
 {
     bool OK = true;
-    unsigned int n;
+    unsigned int n, i;
     unsigned long long cycles, cycles1, cycles2;
     point_t A, B;
     point_extproj_t P;
@@ -644,16 +1004,16 @@ bool ecc_run()
     for (n=0; n<BENCH_LOOPS; n++)
     {
         cycles1 = cpucycles();
-        table_lookup_fixed_base((point_precomp_t*)&FIXED_BASE_TABLE, T, 1, 0);
-        table_lookup_fixed_base((point_precomp_t*)&FIXED_BASE_TABLE, T, 2, (unsigned int)-1);
-        table_lookup_fixed_base((point_precomp_t*)&FIXED_BASE_TABLE, T, 1, 0);
-        table_lookup_fixed_base((point_precomp_t*)&FIXED_BASE_TABLE, T, 2, (unsigned int)-1);
-        table_lookup_fixed_base((point_precomp_t*)&FIXED_BASE_TABLE, T, 1, 0);
-        table_lookup_fixed_base((point_precomp_t*)&FIXED_BASE_TABLE, T, 2, (unsigned int)-1);
-        table_lookup_fixed_base((point_precomp_t*)&FIXED_BASE_TABLE, T, 1, 0);
-        table_lookup_fixed_base((point_precomp_t*)&FIXED_BASE_TABLE, T, 2, (unsigned int)-1);
-        table_lookup_fixed_base((point_precomp_t*)&FIXED_BASE_TABLE, T, 1, 0);
-        table_lookup_fixed_base((point_precomp_t*)&FIXED_BASE_TABLE, T, 2, (unsigned int)-1);
+        table_lookup_fixed_base((point_table_t*)&FIXED_BASE_TABLE, T, 1, 0);
+        table_lookup_fixed_base((point_table_t*)&FIXED_BASE_TABLE, T, 2, (unsigned int)-1);
+        table_lookup_fixed_base((point_table_t*)&FIXED_BASE_TABLE, T, 1, 0);
+        table_lookup_fixed_base((point_table_t*)&FIXED_BASE_TABLE, T, 2, (unsigned int)-1);
+        table_lookup_fixed_base((point_table_t*)&FIXED_BASE_TABLE, T, 1, 0);
+        table_lookup_fixed_base((point_table_t*)&FIXED_BASE_TABLE, T, 2, (unsigned int)-1);
+        table_lookup_fixed_base((point_table_t*)&FIXED_BASE_TABLE, T, 1, 0);
+        table_lookup_fixed_base((point_table_t*)&FIXED_BASE_TABLE, T, 2, (unsigned int)-1);
+        table_lookup_fixed_base((point_table_t*)&FIXED_BASE_TABLE, T, 1, 0);
+        table_lookup_fixed_base((point_table_t*)&FIXED_BASE_TABLE, T, 2, (unsigned int)-1);
         cycles2 = cpucycles();
         cycles = cycles+(cycles2-cycles1);
     }
@@ -676,6 +1036,29 @@ bool ecc_run()
     
     printf("  Fixed-base scalar mul runs in ...                                %8lld cycles with w=%d and v=%d", cycles/SHORT_BENCH_LOOPS, W_FIXEDBASE, V_FIXEDBASE);
     printf("\n"); 
+
+    // Fixed-base scalar multiplication with the table of the library evicted from the caches, against a warm table. Both calls follow a call
+    // with the same scalar, which trains the branch predictors, and on x64 both follow the flush of as many lines. Their order alternates,
+    // since a call tends to run faster than the one before it. The penalty is the median of the differences
+    for (n=0; n<COLD_BENCH_LOOPS; n++)
+    {        
+        random_scalar_test(scalar); 
+        for (i = 0; i < 2; i++) {
+            ecc_mul_fixed((digit_t*)scalar, B);
+            if (((n + i) & 1) == 1) evict_table(TABLE_FIXED_BASE);
+            else evict_control(sizeof(FIXED_BASE_TABLE));
+            cycles1 = cpucycles();
+            ecc_mul_fixed((digit_t*)scalar, B);
+            cycles2 = cpucycles();
+            if (((n + i) & 1) == 1) cold_cycles[n] = (long long)(cycles2-cycles1);
+            else penalty_cycles[n] = -(long long)(cycles2-cycles1);
+        }
+        penalty_cycles[n] += cold_cycles[n];
+    } 
+    
+    printf("  Fixed-base scalar mul (cold table, %5d bytes) runs in ...      %8lld ", (int)sizeof(FIXED_BASE_TABLE), median_cycles(cold_cycles, COLD_BENCH_LOOPS)); print_unit;
+    printf(" (median, %+lld over a warm table)", median_cycles(penalty_cycles, COLD_BENCH_LOOPS));
+    printf("\n"); 
     } 
         
     {    
@@ -701,18 +1084,253 @@ bool ecc_run()
     
     printf("  Double scalar mul runs in ...                                    %8lld cycles with wP=%d and wQ=%d", cycles/SHORT_BENCH_LOOPS, WP_DOUBLEBASE, WQ_DOUBLEBASE);
     printf("\n"); 
+
+    // Double scalar multiplication with the table evicted from the caches, against a warm table as above
+    for (n=0; n<COLD_BENCH_LOOPS; n++)
+    {        
+        random_scalar_test(k); 
+        random_scalar_test(l);  
+        for (i = 0; i < 2; i++) {
+            ecc_mul_double((digit_t*)k, QQ, (digit_t*)l, RR);
+            if (((n + i) & 1) == 1) evict_table(TABLE_DOUBLE_SCALAR);
+            else evict_control(sizeof(DOUBLE_SCALAR_TABLE));
+            cycles1 = cpucycles();
+            ecc_mul_double((digit_t*)k, QQ, (digit_t*)l, RR);
+            cycles2 = cpucycles();
+            if (((n + i) & 1) == 1) cold_cycles[n] = (long long)(cycles2-cycles1);
+            else penalty_cycles[n] = -(long long)(cycles2-cycles1);
+        }
+        penalty_cycles[n] += cold_cycles[n];
+    }
+    
+    printf("  Double scalar mul (cold table, %5d bytes) runs in ...          %8lld ", (int)sizeof(DOUBLE_SCALAR_TABLE), median_cycles(cold_cycles, COLD_BENCH_LOOPS)); print_unit;
+    printf(" (median, %+lld over a warm table)", median_cycles(penalty_cycles, COLD_BENCH_LOOPS));
+    printf("\n"); 
+    }        
+    {    
+    point_affine PP[64], QQ[64];
+    uint64_t k[64*4], l[64*4];
+    unsigned int i;
+
+    for (i = 0; i < 64; i++) {
+        random_scalar_test(k + 4*i); 
+        random_scalar_test(l + 4*i); 
+        ecc_mul_fixed((digit_t*)(l + 4*i), &PP[i]);
+    }
+    printf("  Batch engine: %s\n", (ecc_batch_uses_ifma() == true) ? "AVX-512 IFMA, 8 lanes" : "scalar"); 
+
+    // Batched fixed-base scalar multiplication
+    cycles = 0;
+    for (n=0; n<SHORT_BENCH_LOOPS/64; n++)
+    {        
+        random_scalar_test(k); 
+        cycles1 = cpucycles();
+        ecc_mul_fixed_batch((digit_t*)k, QQ, 64);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    
+    printf("  Batched fixed-base scalar mul runs in ...                        %8lld ", cycles/((SHORT_BENCH_LOOPS/64)*64)); print_unit;
+    printf(" per point (batches of 64)\n"); 
+
+    // Batched variable-base scalar multiplication
+    cycles = 0;
+    for (n=0; n<SHORT_BENCH_LOOPS/64; n++)
+    {        
+        random_scalar_test(k); 
+        cycles1 = cpucycles();
+        ecc_mul_batch(PP, (digit_t*)k, QQ, 64, false);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    
+    printf("  Batched scalar mul runs in ...                                   %8lld ", cycles/((SHORT_BENCH_LOOPS/64)*64)); print_unit;
+    printf(" per point (batches of 64)\n"); 
+
+    // Batched double scalar multiplication
+    cycles = 0;
+    for (n=0; n<SHORT_BENCH_LOOPS/64; n++)
+    {        
+        random_scalar_test(k); 
+        cycles1 = cpucycles();
+        ecc_mul_double_batch((digit_t*)k, PP, (digit_t*)l, QQ, 64);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    
+    printf("  Batched double scalar mul runs in ...                            %8lld ", cycles/((SHORT_BENCH_LOOPS/64)*64)); print_unit;
+    printf(" per point (batches of 64)\n"); 
+    }        
+    {    
+    point_t PP; 
+    uint64_t k[4], msg[4];
+    unsigned char dst[] = "FourQ-TEST-V01-CS01-with-SHA512_ELL2_RO_", outputs[16*32];
+    const unsigned char* msgs[16];
+    unsigned int i, sizes[16];
+
+    // Hashing to the curve
+    cycles = 0;
+    for (n=0; n<SHORT_BENCH_LOOPS; n++)
+    {        
+        random_scalar_test(msg); 
+        cycles1 = cpucycles();
+        HashToCurve((unsigned char*)msg, 32, dst, sizeof(dst)-1, PP);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    
+    printf("  Hash to curve runs in ...                                        %8lld ", cycles/SHORT_BENCH_LOOPS); print_unit;
+    printf("\n"); 
+
+    // Batched evaluation of k*H(x_i)
+    for (i = 0; i < 16; i++) {
+        msgs[i] = (unsigned char*)msg;
+        sizes[i] = 32;
+    }
+    cycles = 0;
+    for (n=0; n<SHORT_BENCH_LOOPS/16; n++)
+    {        
+        random_scalar_test(k); 
+        random_scalar_test(msg); 
+        cycles1 = cpucycles();
+        HashToCurveEvaluateBatch((unsigned char*)k, msgs, sizes, 16, dst, sizeof(dst)-1, outputs);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    
+    printf("  Batched k*H(x) evaluation runs in ...                            %8lld ", cycles/((SHORT_BENCH_LOOPS/16)*16)); print_unit;
+    printf(" per input (batches of 16)\n"); 
+    }        
+    {    
+    point_t PP; 
+    point_affine RR[64];
+    uint64_t k[4];
+    unsigned char encoded[64*32];
+    ECCRYPTO_STATUS status[64];
+    unsigned int i;
+
+    for (i = 0; i < 64; i++) {
+        random_scalar_test(k); 
+        ecc_mul_fixed((digit_t*)k, PP);
+        encode(PP, encoded + 32*i);
+    }
+
+    // Point decompression
+    cycles = 0;
+    for (n=0; n<SHORT_BENCH_LOOPS; n++)
+    {        
+        cycles1 = cpucycles();
+        decode(encoded + 32*(n % 64), PP);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    
+    printf("  Point decompression runs in ...                                  %8lld ", cycles/SHORT_BENCH_LOOPS); print_unit;
+    printf("\n"); 
+
+    // Batched point decompression
+    cycles = 0;
+    for (n=0; n<SHORT_BENCH_LOOPS/64; n++)
+    {        
+        cycles1 = cpucycles();
+        decode_batch(encoded, RR, status, 64);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    
+    printf("  Batched point decompression runs in ...                          %8lld ", cycles/((SHORT_BENCH_LOOPS/64)*64)); print_unit;
+    printf(" per point (batches of 64)\n"); 
     }
 
     return OK;
 } 
 
 
+#if defined(FOURQ_COUNT_OPS)
+
+bool ecc_count_ops()
+{
+    bool OK = true;
+    int passed;
+    op_counts_t counts, counts2, zero = {0};
+    point_t A, B;
+    uint64_t k[4], l[4];
+    unsigned char encoded[32];
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
+    printf("Operation counts of FourQ's curve arithmetic \n\n"); 
+
+    random_scalar_test(k); random_scalar_test(l);
+    eccset(A);
+    ecc_mul_fixed((digit_t*)l, A);
+
+    // Reset, and constant-time scalar multiplications performing the same operations for any scalar
+    passed = 1;
+    ecc_mul(A, (digit_t*)k, B, false);
+    FourQ_ResetOpCounts();
+    FourQ_GetOpCounts(&counts);
+    if (memcmp(&counts, &zero, sizeof(op_counts_t)) != 0) passed=0;
+#if !defined(SCA_PROTECTION)                   // The countermeasures redraw their state every SCA_REFRESH_INTERVAL uses, at an extra cost
+    ecc_mul(A, (digit_t*)k, B, false);
+    FourQ_GetOpCounts(&counts);
+    FourQ_ResetOpCounts();
+    ecc_mul(A, (digit_t*)l, B, false);
+    FourQ_GetOpCounts(&counts2);
+    if (counts.fp2mul == 0 || memcmp(&counts, &counts2, sizeof(op_counts_t)) != 0) passed=0;
+    FourQ_ResetOpCounts();
+    ecc_mul_fixed((digit_t*)k, B);
+    FourQ_GetOpCounts(&counts);
+    FourQ_ResetOpCounts();
+    ecc_mul_fixed((digit_t*)l, B);
+    FourQ_GetOpCounts(&counts2);
+    if (counts.fp2mul == 0 || memcmp(&counts, &counts2, sizeof(op_counts_t)) != 0) passed=0;
+#endif
+    if (passed==1) printf("  Operation counter tests ................................................................. PASSED");
+    else { printf("  Operation counter tests ... FAILED"); printf("\n"); return false; }
+    printf("\n\n");
+
+    print_op_counts_header();
+    FourQ_ResetOpCounts();
+    ecc_mul(A, (digit_t*)k, B, false);
+    FourQ_GetOpCounts(&counts);
+    print_op_counts("ecc_mul", &counts);
+
+    FourQ_ResetOpCounts();
+    ecc_mul(A, (digit_t*)k, B, true);
+    FourQ_GetOpCounts(&counts);
+    print_op_counts("ecc_mul (cofactor clearing)", &counts);
+
+    FourQ_ResetOpCounts();
+    ecc_mul_fixed((digit_t*)k, B);
+    FourQ_GetOpCounts(&counts);
+    print_op_counts("ecc_mul_fixed", &counts);
+
+    FourQ_ResetOpCounts();
+    ecc_mul_double((digit_t*)k, A, (digit_t*)l, B);
+    FourQ_GetOpCounts(&counts);
+    print_op_counts("ecc_mul_double", &counts);
+
+    encode(A, encoded);
+    FourQ_ResetOpCounts();
+    decode(encoded, B);
+    FourQ_GetOpCounts(&counts);
+    print_op_counts("decode", &counts);
+
+    return OK;
+}
+
+#endif
+
+
 int main()
 {
     bool OK = true;
 
     OK = OK && ecc_test();         // Test FourQ's curve functions
     OK = OK && ecc_run();          // Benchmark FourQ's curve functions
+#if defined(FOURQ_COUNT_OPS)
+    OK = OK && ecc_count_ops();    // Operation counts of FourQ's curve functions
+#endif
     
     return OK;
 }
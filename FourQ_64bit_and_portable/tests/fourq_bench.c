@@ -0,0 +1,655 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: benchmark harness for FourQ's primitives
+*
+* Every primitive is timed over a number of samples, each one running a batch of calls.
+* The harness pins the thread to one core, warms up before measuring, subtracts the
+* overhead of the timers, and reports min/median/p90/p99 per call in cycles and in
+* nanoseconds. Results are printed as text, JSON or CSV, and can be compared against a
+* baseline saved in JSON or CSV format to flag regressions.
+* With --perf, hardware counters (instructions, IPC, L1D and LLC misses, branch misses,
+* dTLB misses) are collected on Linux in a separate pass and reported per call next to
+* the cycles. With --tables, the precomputed tables are first placed in huge pages and/or
+* replicated per NUMA node (see ecc_tables_place()). The "_cold" variants of fixed-base and
+* double-scalar multiplication evict the table in use from the caches before every call.
+************************************************************************************/
+
+#if defined(__LINUX__)
+    #define _GNU_SOURCE
+#endif
+#include "../FourQ_internal.h"
+#include "../FourQ_params.h"
+#include "test_extras.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if (OS_TARGET == OS_WIN)
+    #include <windows.h>
+#else
+    #include <sched.h>
+    #include <time.h>
+#endif
+
+
+// Default parameters
+#define DEFAULT_SAMPLES       1000       // Number of measured samples per primitive
+#define DEFAULT_THRESHOLD     2.0        // Regression threshold for the compare mode, in percent
+#define WARMUP_DIVISOR        10         // Warm-up samples = samples/WARMUP_DIVISOR (at least MIN_WARMUP)
+#define MIN_WARMUP            10
+#define SPIN_UP_NS            200000000  // Busy loop before the first benchmark, to let the core reach its steady frequency
+#define MAX_BENCHMARKS        64
+#define MAX_NAME              48
+
+#if (TARGET == TARGET_ARM || TARGET == TARGET_ARM64)
+    #define COUNTER_UNIT      "nsec"     // cpucycles() reads a clock on these targets
+#else
+    #define COUNTER_UNIT      "cycles"
+#endif
+
+typedef enum { FORMAT_TEXT, FORMAT_JSON, FORMAT_CSV } output_format;
+
+typedef struct {
+    char name[MAX_NAME];
+    unsigned int batch, samples;
+    double cycles[4];                    // min, median, p90, p99 per call
+    double ns[4];
+    double perf[PERF_NCOUNTERS];         // Hardware counters per call, -1 if unavailable
+} bench_result;
+
+
+// Operands shared by the benchmarks
+static felm_t fa, fb, fc;
+static f2elm_t f2a, f2b, f2c;
+static point_t A, B;
+static point_extproj_t PE;
+static point_extproj_precomp_t PQ, PT, Table[8];
+static uint64_t k[NWORDS64_ORDER], l[NWORDS64_ORDER];
+static unsigned char SecretKey[32], PublicKey[32], Signature[64], Encoded[32], Shared[32], Message[64];
+static unsigned int valid;
+static unsigned int digit;
+
+
+static void bench_fpmul1271(unsigned int n)          { while (n--) fpmul1271(fa, fb, fc); }
+static void bench_fpsqr1271(unsigned int n)          { while (n--) fpsqr1271(fa, fc); }
+static void bench_fpinv1271(unsigned int n)          { while (n--) fpinv1271(fa); }
+static void bench_fp2mul1271(unsigned int n)         { while (n--) fp2mul1271(f2a, f2b, f2c); }
+static void bench_fp2sqr1271(unsigned int n)         { while (n--) fp2sqr1271(f2a, f2c); }
+static void bench_fp2inv1271(unsigned int n)         { while (n--) fp2inv1271(f2a); }
+static void bench_eccdouble(unsigned int n)          { while (n--) eccdouble(PE); }
+static void bench_eccadd(unsigned int n)             { while (n--) eccadd(PQ, PE); }
+static void bench_eccnorm(unsigned int n)            { while (n--) eccnorm(PE, B); }
+static void bench_table_lookup_1x8(unsigned int n)   { while (n--) { table_lookup_1x8(Table, PT, digit, (unsigned int)-1); digit = (digit + 1) & 7; } }
+static void bench_encode(unsigned int n)             { while (n--) encode(A, Encoded); }
+static void bench_decode(unsigned int n)             { while (n--) decode(Encoded, B); }
+static void bench_ecc_mul(unsigned int n)            { while (n--) ecc_mul(A, (digit_t*)k, B, false); }
+static void bench_ecc_mul_fixed(unsigned int n)      { while (n--) ecc_mul_fixed((digit_t*)k, B); }
+static void bench_ecc_mul_double(unsigned int n)     { while (n--) ecc_mul_double((digit_t*)k, A, (digit_t*)l, B); }
+static void bench_keygen(unsigned int n)             { while (n--) SchnorrQ_KeyGeneration(SecretKey, PublicKey); }
+static void bench_sign(unsigned int n)               { while (n--) SchnorrQ_Sign(SecretKey, PublicKey, Message, sizeof(Message), Signature); }
+static void bench_verify(unsigned int n)             { while (n--) SchnorrQ_Verify(PublicKey, Message, sizeof(Message), Signature, &valid); }
+static void bench_secret_agreement(unsigned int n)   { while (n--) CompressedSecretAgreement(SecretKey, PublicKey, Shared); }
+static void bench_empty(unsigned int n)              { (void)n; }
+
+static void evict_fixed_base_table(void)             { evict_table(TABLE_FIXED_BASE); }
+static void evict_double_scalar_table(void)          { evict_table(TABLE_DOUBLE_SCALAR); }
+
+typedef struct {
+    const char* name;
+    unsigned int batch;                  // Calls per sample
+    void (*run)(unsigned int n);
+    void (*prepare)(void);               // Called before every sample, outside of the measurements, or NULL
+} bench_entry;
+
+static const bench_entry benchmarks[] = {
+    { "fpmul1271",                 64, bench_fpmul1271 },
+    { "fpsqr1271",                 64, bench_fpsqr1271 },
+    { "fpinv1271",                  1, bench_fpinv1271 },
+    { "fp2mul1271",                64, bench_fp2mul1271 },
+    { "fp2sqr1271",                64, bench_fp2sqr1271 },
+    { "fp2inv1271",                 1, bench_fp2inv1271 },
+    { "eccdouble",                 16, bench_eccdouble },
+    { "eccadd",                    16, bench_eccadd },
+    { "eccnorm",                    1, bench_eccnorm },
+    { "table_lookup_1x8",          64, bench_table_lookup_1x8 },
+    { "encode",                    16, bench_encode },
+    { "decode",                     1, bench_decode },
+    { "ecc_mul",                    1, bench_ecc_mul },
+    { "ecc_mul_fixed",              1, bench_ecc_mul_fixed },
+    { "ecc_mul_double",             1, bench_ecc_mul_double },
+    { "ecc_mul_fixed_cold",         1, bench_ecc_mul_fixed, evict_fixed_base_table },
+    { "ecc_mul_double_cold",        1, bench_ecc_mul_double, evict_double_scalar_table },
+    { "SchnorrQ_KeyGeneration",     1, bench_keygen },
+    { "SchnorrQ_Sign",              1, bench_sign },
+    { "SchnorrQ_Verify",            1, bench_verify },
+    { "CompressedSecretAgreement",  1, bench_secret_agreement },
+};
+
+#define NBENCHMARKS (sizeof(benchmarks)/sizeof(benchmarks[0]))
+
+
+static int64_t now_ns(void)
+{ // Monotonic clock in nanoseconds
+#if (OS_TARGET == OS_WIN)
+    LARGE_INTEGER counter, frequency;
+
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (int64_t)((double)counter.QuadPart*1e9/(double)frequency.QuadPart);
+#else
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (int64_t)time.tv_sec*1000000000 + (int64_t)time.tv_nsec;
+#endif
+}
+
+
+static int pin_cpu(int cpu)
+{ // Pin the calling thread to the given core (or to the current one if cpu < 0). Returns the core, or -1 if not supported
+#if (OS_TARGET == OS_WIN)
+    if (cpu < 0) {
+        cpu = (int)GetCurrentProcessorNumber();
+    }
+    if (SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << cpu) == 0) {
+        return -1;
+    }
+    return cpu;
+#elif defined(__LINUX__)
+    cpu_set_t set;
+
+    if (cpu < 0) {
+        cpu = sched_getcpu();
+        if (cpu < 0) {
+            return -1;
+        }
+    }
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+        return -1;
+    }
+    return cpu;
+#else
+    (void)cpu;
+    return -1;
+#endif
+}
+
+
+static int compare_doubles(const void* a, const void* b)
+{
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+
+static bool matches_filter(const char* name, const char* filter)
+{ // True if name contains one of the comma-separated substrings of filter
+    char item[64];
+    size_t len;
+
+    while (*filter != '\0') {
+        len = strcspn(filter, ",");
+        if (len > 0 && len < sizeof(item)) {
+            memcpy(item, filter, len);
+            item[len] = '\0';
+            if (strstr(name, item) != NULL) return true;
+        }
+        filter += len;
+        if (*filter == ',') filter++;
+    }
+    return false;
+}
+
+
+static double percentile(const double* sorted, unsigned int n, double p)
+{ // Nearest-rank percentile of sorted[0..n-1]
+    unsigned int rank = (unsigned int)(p*n);
+
+    if (rank < p*n) rank++;
+    if (rank < 1) rank = 1;
+    if (rank > n) rank = n;
+    return sorted[rank-1];
+}
+
+
+static void run_samples(const bench_entry* entry, unsigned int samples, unsigned int warmup, double* cycles, double* ns)
+{ // Raw duration of each sample, in cycles and in nanoseconds. The nanosecond clock is read inside the cycle counter reads
+    void (*run)(unsigned int) = entry->run;
+    unsigned int i, batch = entry->batch;
+    int64_t c0, c1, t0, t1;
+
+    for (i = 0; i < warmup; i++) {
+        if (entry->prepare != NULL) entry->prepare();
+        run(batch);
+    }
+    for (i = 0; i < samples; i++) {
+        if (entry->prepare != NULL) entry->prepare();
+        c0 = cpucycles();
+        t0 = now_ns();
+        run(batch);
+        t1 = now_ns();
+        c1 = cpucycles();
+        cycles[i] = (double)(c1 - c0);
+        ns[i] = (double)(t1 - t0);
+    }
+}
+
+
+static void count_events(const bench_entry* entry, unsigned int samples, perf_counters_t* counters, double* perf)
+{ // Hardware counters per call over samples batches. The counting pass is separate from the timed one so that the system calls
+  // that start and stop the counters do not add to the samples. With a prepare function, the counters are stopped while it runs
+    double values[PERF_NCOUNTERS];
+    unsigned int i, j;
+
+    if (entry->prepare == NULL) {
+        perf_counters_start(counters);
+        for (i = 0; i < samples; i++) {
+            entry->run(entry->batch);
+        }
+        perf_counters_stop(counters, perf);
+    } else {
+        for (j = 0; j < PERF_NCOUNTERS; j++) {
+            perf[j] = 0;
+        }
+        for (i = 0; i < samples; i++) {
+            entry->prepare();
+            perf_counters_start(counters);
+            entry->run(entry->batch);
+            perf_counters_stop(counters, values);
+            for (j = 0; j < PERF_NCOUNTERS; j++) {
+                perf[j] = (values[j] >= 0 && perf[j] >= 0) ? perf[j] + values[j] : -1;
+            }
+        }
+    }
+    for (i = 0; i < PERF_NCOUNTERS; i++) {
+        if (perf[i] >= 0) {
+            perf[i] /= (double)samples*entry->batch;
+        }
+    }
+}
+
+
+static double ipc(const double* perf)
+{ // Instructions per core cycle, -1 if unavailable
+    return (perf[PERF_INSTRUCTIONS] >= 0 && perf[PERF_CORE_CYCLES] > 0) ? perf[PERF_INSTRUCTIONS]/perf[PERF_CORE_CYCLES] : -1;
+}
+
+
+static void print_counter(FILE* out, output_format format, int width, int precision, double value)
+{ // A hardware counter in the given format (width and precision apply to text). Unavailable counters print as "-" (text),
+  // null (JSON) or an empty field (CSV)
+    if (format == FORMAT_TEXT) {
+        if (value >= 0) fprintf(out, " %*.*f", width, precision, value);
+        else fprintf(out, " %*s", width, "-");
+    } else if (value >= 0) {
+        fprintf(out, "%.3f", value);
+    } else if (format == FORMAT_JSON) {
+        fprintf(out, "null");
+    }
+}
+
+
+static void summarize(double* values, unsigned int samples, double overhead, unsigned int batch, double* out)
+{ // min/median/p90/p99 per call, after subtracting the timer overhead
+    unsigned int i;
+
+    for (i = 0; i < samples; i++) {
+        values[i] = (values[i] > overhead) ? (values[i] - overhead)/batch : 0;
+    }
+    qsort(values, samples, sizeof(double), compare_doubles);
+    out[0] = values[0];
+    out[1] = percentile(values, samples, 0.50);
+    out[2] = percentile(values, samples, 0.90);
+    out[3] = percentile(values, samples, 0.99);
+}
+
+
+static void setup_operands(void)
+{ // Random operands, keys and signature
+    point_extproj_t R;
+    unsigned int i;
+
+    fp2random1271_test(f2a); fp2random1271_test(f2b); fp2random1271_test(f2c);
+    fpcopy1271(f2a[0], fa); fpcopy1271(f2b[0], fb);
+    random_scalar_test(k); random_scalar_test(l);
+    eccset(A);
+    ecc_mul_fixed((digit_t*)k, A);
+    point_setup(A, PE);
+    R1_to_R2(PE, PQ);
+    ecc_precomp(PE, Table);
+    encode(A, Encoded);
+    for (i = 0; i < sizeof(Message); i++) {
+        Message[i] = (unsigned char)i;
+    }
+    SchnorrQ_FullKeyGeneration(SecretKey, PublicKey);
+    SchnorrQ_Sign(SecretKey, PublicKey, Message, sizeof(Message), Signature);
+}
+
+
+static const char* describe_tables(const table_placement_t* placement, char* text, size_t size)
+{ // Placement of the precomputed tables, e.g. "2 copies in transparent huge pages, 2 bound to their NUMA node"
+    static const char* const pages[] = {"static", "base pages", "transparent huge pages", "explicit huge pages"};
+
+    if (placement->pages == TABLE_PAGES_STATIC) {
+        return pages[TABLE_PAGES_STATIC];
+    }
+    if (placement->flags & TABLES_NUMA_REPLICAS) {
+        snprintf(text, size, "%u cop%s in %s, %u bound to their NUMA node", placement->copies, (placement->copies == 1) ? "y" : "ies", pages[placement->pages], placement->bound);
+    } else {
+        snprintf(text, size, "1 copy in %s", pages[placement->pages]);
+    }
+    return text;
+}
+
+
+static void print_results(FILE* out, output_format format, const bench_result* results, unsigned int n, int cpu, const double* overhead, bool perf)
+{
+    table_placement_t placement;
+    char tables[128];
+    unsigned int i;
+
+    ecc_tables_placement(&placement);
+    if (format == FORMAT_JSON) {
+        fprintf(out, "{\n  \"counter\": \"%s\",\n  \"cpu\": %d,\n  \"tables\": \"%s\",\n  \"timer_overhead_cycles\": %.1f,\n  \"timer_overhead_ns\": %.1f,\n  \"results\": [\n", 
+                     COUNTER_UNIT, cpu, describe_tables(&placement, tables, sizeof(tables)), overhead[0], overhead[1]);
+        for (i = 0; i < n; i++) {
+            fprintf(out, "    {\"name\": \"%s\", \"batch\": %u, \"samples\": %u, \"min_cycles\": %.1f, \"median_cycles\": %.1f, \"p90_cycles\": %.1f, \"p99_cycles\": %.1f, "
+                         "\"min_ns\": %.1f, \"median_ns\": %.1f, \"p90_ns\": %.1f, \"p99_ns\": %.1f", results[i].name, results[i].batch, results[i].samples,
+                         results[i].cycles[0], results[i].cycles[1], results[i].cycles[2], results[i].cycles[3], results[i].ns[0], results[i].ns[1], results[i].ns[2], results[i].ns[3]);
+            if (perf) {
+                fprintf(out, ", \"core_cycles\": ");   print_counter(out, format, 0, 0, results[i].perf[PERF_CORE_CYCLES]);
+                fprintf(out, ", \"instructions\": ");  print_counter(out, format, 0, 0, results[i].perf[PERF_INSTRUCTIONS]);
+                fprintf(out, ", \"ipc\": ");           print_counter(out, format, 0, 0, ipc(results[i].perf));
+                fprintf(out, ", \"l1d_misses\": ");    print_counter(out, format, 0, 0, results[i].perf[PERF_L1D_MISSES]);
+                fprintf(out, ", \"llc_misses\": ");    print_counter(out, format, 0, 0, results[i].perf[PERF_LLC_MISSES]);
+                fprintf(out, ", \"branch_misses\": "); print_counter(out, format, 0, 0, results[i].perf[PERF_BRANCH_MISSES]);
+                fprintf(out, ", \"dtlb_misses\": ");   print_counter(out, format, 0, 0, results[i].perf[PERF_DTLB_MISSES]);
+            }
+            fprintf(out, "}%s\n", (i+1 < n) ? "," : "");
+        }
+        fprintf(out, "  ]\n}\n");
+    } else if (format == FORMAT_CSV) {
+        fprintf(out, "name,batch,samples,min_cycles,median_cycles,p90_cycles,p99_cycles,min_ns,median_ns,p90_ns,p99_ns%s\n",
+                     perf ? ",core_cycles,instructions,ipc,l1d_misses,llc_misses,branch_misses,dtlb_misses" : "");
+        for (i = 0; i < n; i++) {
+            fprintf(out, "%s,%u,%u,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f", results[i].name, results[i].batch, results[i].samples,
+                         results[i].cycles[0], results[i].cycles[1], results[i].cycles[2], results[i].cycles[3], results[i].ns[0], results[i].ns[1], results[i].ns[2], results[i].ns[3]);
+            if (perf) {
+                fprintf(out, ",");  print_counter(out, format, 0, 0, results[i].perf[PERF_CORE_CYCLES]);
+                fprintf(out, ",");  print_counter(out, format, 0, 0, results[i].perf[PERF_INSTRUCTIONS]);
+                fprintf(out, ",");  print_counter(out, format, 0, 0, ipc(results[i].perf));
+                fprintf(out, ",");  print_counter(out, format, 0, 0, results[i].perf[PERF_L1D_MISSES]);
+                fprintf(out, ",");  print_counter(out, format, 0, 0, results[i].perf[PERF_LLC_MISSES]);
+                fprintf(out, ",");  print_counter(out, format, 0, 0, results[i].perf[PERF_BRANCH_MISSES]);
+                fprintf(out, ",");  print_counter(out, format, 0, 0, results[i].perf[PERF_DTLB_MISSES]);
+            }
+            fprintf(out, "\n");
+        }
+    } else {
+        fprintf(out, "\nPinned to CPU %d, timer overhead %.1f %s / %.1f ns, precomputed tables: %s, per-call values\n\n", cpu, overhead[0], COUNTER_UNIT, overhead[1], 
+                     describe_tables(&placement, tables, sizeof(tables)));
+        fprintf(out, "  %-26s %10s %10s %10s %10s   %9s %9s %9s %9s\n", "primitive", "min", "median", "p90", "p99", "min ns", "median ns", "p90 ns", "p99 ns");
+        for (i = 0; i < n; i++) {
+            fprintf(out, "  %-26s %10.1f %10.1f %10.1f %10.1f   %9.1f %9.1f %9.1f %9.1f\n", results[i].name,
+                         results[i].cycles[0], results[i].cycles[1], results[i].cycles[2], results[i].cycles[3], results[i].ns[0], results[i].ns[1], results[i].ns[2], results[i].ns[3]);
+        }
+        if (perf) {
+            fprintf(out, "\nHardware counters, per-call values\n\n");
+            fprintf(out, "  %-26s %10s %11s %12s %9s %9s %9s %9s %9s\n", "primitive", "median", "core cycles", "instructions", "IPC", "L1D miss", "LLC miss", "br miss", "dTLB miss");
+            for (i = 0; i < n; i++) {
+                fprintf(out, "  %-26s %10.1f", results[i].name, results[i].cycles[1]);
+                print_counter(out, format, 11, 1, results[i].perf[PERF_CORE_CYCLES]);
+                print_counter(out, format, 12, 1, results[i].perf[PERF_INSTRUCTIONS]);
+                print_counter(out, format, 9, 2, ipc(results[i].perf));
+                print_counter(out, format, 9, 2, results[i].perf[PERF_L1D_MISSES]);
+                print_counter(out, format, 9, 2, results[i].perf[PERF_LLC_MISSES]);
+                print_counter(out, format, 9, 2, results[i].perf[PERF_BRANCH_MISSES]);
+                print_counter(out, format, 9, 2, results[i].perf[PERF_DTLB_MISSES]);
+                fprintf(out, "\n");
+            }
+        }
+    }
+}
+
+
+static int json_number(const char* line, const char* key, double* value)
+{ // Value of "key": number in a line of the JSON output
+    char pattern[MAX_NAME+4];
+    const char* p;
+
+    sprintf(pattern, "\"%s\":", key);
+    p = strstr(line, pattern);
+    if (p == NULL) {
+        return 0;
+    }
+    *value = strtod(p + strlen(pattern), NULL);
+    return 1;
+}
+
+
+static unsigned int load_baseline(const char* file, bench_result* results)
+{ // Read a baseline written with --format json or --format csv. Returns the number of results
+    FILE* in = fopen(file, "r");
+    char line[1024], *p, *q;
+    unsigned int n = 0, ok;
+    double batch, samples;
+
+    if (in == NULL) {
+        return 0;
+    }
+    while (n < MAX_BENCHMARKS && fgets(line, sizeof(line), in) != NULL) {
+        bench_result* r = &results[n];
+        if ((p = strstr(line, "\"name\": \"")) != NULL) {
+            p += 9;
+            q = strchr(p, '"');
+            if (q == NULL || q - p >= MAX_NAME) continue;
+            memcpy(r->name, p, q - p);
+            r->name[q - p] = 0;
+            ok = json_number(line, "batch", &batch) & json_number(line, "samples", &samples) &
+                 json_number(line, "min_cycles", &r->cycles[0]) & json_number(line, "median_cycles", &r->cycles[1]) &
+                 json_number(line, "p90_cycles", &r->cycles[2]) & json_number(line, "p99_cycles", &r->cycles[3]) &
+                 json_number(line, "min_ns", &r->ns[0]) & json_number(line, "median_ns", &r->ns[1]) &
+                 json_number(line, "p90_ns", &r->ns[2]) & json_number(line, "p99_ns", &r->ns[3]);
+        } else {
+            ok = (sscanf(line, "%47[^,],%lf,%lf,%lf,%lf,%lf,%lf,%lf,%lf,%lf,%lf", r->name, &batch, &samples, &r->cycles[0], &r->cycles[1], &r->cycles[2], &r->cycles[3],
+                         &r->ns[0], &r->ns[1], &r->ns[2], &r->ns[3]) == 11);
+        }
+        if (ok) {
+            r->batch = (unsigned int)batch;
+            r->samples = (unsigned int)samples;
+            n++;
+        }
+    }
+    fclose(in);
+    return n;
+}
+
+
+static unsigned int compare_results(FILE* out, const bench_result* base, unsigned int nbase, const bench_result* results, unsigned int n, double threshold)
+{ // A primitive regresses when its median and its minimum both grow by more than threshold and threshold/2 percent, respectively.
+  // Requiring both location estimates to move filters out noise in the tail. Returns the number of regressions
+    unsigned int i, j, regressions = 0;
+    double dmedian, dmin;
+    const char* status;
+
+    fprintf(out, "\nComparison against the baseline (median %s per call, threshold %.1f%%)\n\n", COUNTER_UNIT, threshold);
+    fprintf(out, "  %-26s %12s %12s %9s   %s\n", "primitive", "baseline", "current", "change", "status");
+    for (i = 0; i < n; i++) {
+        for (j = 0; j < nbase && strcmp(base[j].name, results[i].name) != 0; j++);
+        if (j == nbase || base[j].cycles[1] <= 0 || base[j].cycles[0] <= 0) {
+            fprintf(out, "  %-26s %12s %12.1f %9s   %s\n", results[i].name, "-", results[i].cycles[1], "-", "new");
+            continue;
+        }
+        dmedian = 100*(results[i].cycles[1] - base[j].cycles[1])/base[j].cycles[1];
+        dmin = 100*(results[i].cycles[0] - base[j].cycles[0])/base[j].cycles[0];
+        if (dmedian > threshold && dmin > threshold/2) {
+            status = "REGRESSION";
+            regressions++;
+        } else if (dmedian < -threshold && dmin < -threshold/2) {
+            status = "improved";
+        } else {
+            status = "ok";
+        }
+        fprintf(out, "  %-26s %12.1f %12.1f %+8.1f%%   %s\n", results[i].name, base[j].cycles[1], results[i].cycles[1], dmedian, status);
+    }
+    fprintf(out, "\n  %u regression(s)\n", regressions);
+    return regressions;
+}
+
+
+static void usage(const char* program)
+{
+    printf("Usage: %s [options]\n\n", program);
+    printf("  --samples N         measured samples per primitive (default %d)\n", DEFAULT_SAMPLES);
+    printf("  --warmup N          warm-up samples per primitive (default samples/%d)\n", WARMUP_DIVISOR);
+    printf("  --cpu N             core to pin the benchmark to (default: the current core)\n");
+    printf("  --filter TEXT       only run the primitives whose name contains TEXT, or one of a comma-separated list\n");
+    printf("  --format FORMAT     text, json or csv (default text)\n");
+    printf("  --output FILE       write the results to FILE instead of the standard output\n");
+    printf("  --compare FILE      compare against a baseline written with --format json or csv\n");
+    printf("  --threshold PCT     regression threshold for --compare, in percent (default %.1f)\n", DEFAULT_THRESHOLD);
+    printf("  --perf              also report hardware counters per call (Linux perf_event_open)\n");
+    printf("  --tables PLACEMENT  static (default), huge, numa or huge,numa: placement of the precomputed tables (Linux)\n\n");
+    printf("Exit status: 0 on success, 1 if --compare found regressions, 2 on usage errors.\n");
+}
+
+
+int main(int argc, char** argv)
+{
+    unsigned int samples = DEFAULT_SAMPLES, warmup = 0, n = 0, nbase, i;
+    int cpu = -1, arg;
+    double threshold = DEFAULT_THRESHOLD, overhead[2], *cycles, *ns;
+    const char *filter = NULL, *output = NULL, *baseline = NULL;
+    output_format format = FORMAT_TEXT;
+    static bench_result results[MAX_BENCHMARKS], base[MAX_BENCHMARKS];
+    FILE* out = stdout;
+    int64_t start;
+    perf_counters_t counters;
+    unsigned int tables = 0;
+    bool perf = false;
+    const bench_entry empty = { "empty", 1, bench_empty, NULL };
+
+    for (arg = 1; arg < argc; arg++) {
+        if (strcmp(argv[arg], "--help") == 0) {
+            usage(argv[0]);
+            return 0;
+        } else if (strcmp(argv[arg], "--samples") == 0 && arg+1 < argc) {
+            samples = (unsigned int)atoi(argv[++arg]);
+        } else if (strcmp(argv[arg], "--warmup") == 0 && arg+1 < argc) {
+            warmup = (unsigned int)atoi(argv[++arg]);
+        } else if (strcmp(argv[arg], "--cpu") == 0 && arg+1 < argc) {
+            cpu = atoi(argv[++arg]);
+        } else if (strcmp(argv[arg], "--filter") == 0 && arg+1 < argc) {
+            filter = argv[++arg];
+        } else if (strcmp(argv[arg], "--output") == 0 && arg+1 < argc) {
+            output = argv[++arg];
+        } else if (strcmp(argv[arg], "--compare") == 0 && arg+1 < argc) {
+            baseline = argv[++arg];
+        } else if (strcmp(argv[arg], "--threshold") == 0 && arg+1 < argc) {
+            threshold = atof(argv[++arg]);
+        } else if (strcmp(argv[arg], "--perf") == 0) {
+            perf = true;
+        } else if (strcmp(argv[arg], "--tables") == 0 && arg+1 < argc) {
+            arg++;
+            if (strcmp(argv[arg], "static") == 0) tables = 0;
+            else if (strcmp(argv[arg], "huge") == 0) tables = TABLES_HUGE_PAGES;
+            else if (strcmp(argv[arg], "numa") == 0) tables = TABLES_NUMA_REPLICAS;
+            else if (strcmp(argv[arg], "huge,numa") == 0 || strcmp(argv[arg], "numa,huge") == 0) tables = TABLES_HUGE_PAGES | TABLES_NUMA_REPLICAS;
+            else { usage(argv[0]); return 2; }
+        } else if (strcmp(argv[arg], "--format") == 0 && arg+1 < argc) {
+            arg++;
+            if (strcmp(argv[arg], "json") == 0) format = FORMAT_JSON;
+            else if (strcmp(argv[arg], "csv") == 0) format = FORMAT_CSV;
+            else if (strcmp(argv[arg], "text") == 0) format = FORMAT_TEXT;
+            else { usage(argv[0]); return 2; }
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (samples == 0) {
+        usage(argv[0]);
+        return 2;
+    }
+    if (warmup == 0) {
+        warmup = (samples/WARMUP_DIVISOR > MIN_WARMUP) ? samples/WARMUP_DIVISOR : MIN_WARMUP;
+    }
+    nbase = 0;
+    if (baseline != NULL) {
+        nbase = load_baseline(baseline, base);
+        if (nbase == 0) {
+            fprintf(stderr, "Could not read any result from the baseline %s\n", baseline);
+            return 2;
+        }
+    }
+
+    cycles = (double*)malloc(samples*sizeof(double));
+    ns = (double*)malloc(samples*sizeof(double));
+    if (cycles == NULL || ns == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        return 2;
+    }
+
+    cpu = pin_cpu(cpu);
+    if (ecc_tables_place(tables) != ECCRYPTO_SUCCESS) {
+        fprintf(stderr, "Could not place the precomputed tables\n");
+        return 2;
+    }
+    if (perf == true && perf_counters_open(&counters) == 0) {
+        fprintf(stderr, "Hardware counters are unavailable (no PMU, or restricted by kernel.perf_event_paranoid); they are reported as missing\n");
+    }
+    setup_operands();
+    start = now_ns();
+    while (now_ns() - start < SPIN_UP_NS) {
+        bench_fp2mul1271(64);
+    }
+
+    // Timer overhead: median duration of an empty sample
+    run_samples(&empty, samples, warmup, cycles, ns);
+    qsort(cycles, samples, sizeof(double), compare_doubles);
+    qsort(ns, samples, sizeof(double), compare_doubles);
+    overhead[0] = percentile(cycles, samples, 0.50);
+    overhead[1] = percentile(ns, samples, 0.50);
+
+    for (i = 0; i < NBENCHMARKS; i++) {
+        if (filter != NULL && matches_filter(benchmarks[i].name, filter) == false) {
+            continue;
+        }
+        run_samples(&benchmarks[i], samples, warmup, cycles, ns);
+        strcpy(results[n].name, benchmarks[i].name);
+        results[n].batch = benchmarks[i].batch;
+        results[n].samples = samples;
+        summarize(cycles, samples, overhead[0], benchmarks[i].batch, results[n].cycles);
+        summarize(ns, samples, overhead[1], benchmarks[i].batch, results[n].ns);
+        if (perf == true) {
+            count_events(&benchmarks[i], samples, &counters, results[n].perf);
+        }
+        n++;
+    }
+    free(cycles);
+    free(ns);
+    if (perf == true) {
+        perf_counters_close(&counters);
+    }
+
+    if (output != NULL) {
+        out = fopen(output, "w");
+        if (out == NULL) {
+            fprintf(stderr, "Could not open %s\n", output);
+            return 2;
+        }
+    }
+    print_results(out, format, results, n, cpu, overhead, perf);
+    if (out != stdout) {
+        fclose(out);
+    }
+
+    if (baseline != NULL && compare_results(stdout, base, nbase, results, n, threshold) != 0) {
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,282 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: generation of the precomputed tables for other window sizes
+*
+* Writes a configuration header with the parameters W_FIXEDBASE, V_FIXEDBASE,
+* WP_DOUBLEBASE and WQ_DOUBLEBASE and the matching FIXED_BASE_TABLE and
+* DOUBLE_SCALAR_TABLE, which is used instead of the defaults when the library is built
+* with TUNED=TRUE (see tune.sh). The tables do not depend on the parameters the program
+* itself is built with. With --verify, the tables compiled into the library are
+* checked against variable-base scalar multiplications.
+************************************************************************************/
+
+#include "../FourQ_internal.h"
+#include "../FourQ_params.h"
+#include "../../random/random.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define VERIFY_LOOPS    100             // Number of random scalars checked by --verify
+
+
+static void table_entry(point_extproj_t P, uint64_t* words)
+{ // Conversion of P to the representation (x+y,y-x,2dt) of the tables, with every coordinate fully reduced
+  // Output: 12 words, (x+y,y-x) in the first 8
+    point_t A;
+    f2elm_t t[3];
+    unsigned int i;
+
+    ecc_point_to_affine(P, A);
+    fp2add1271(A->x, A->y, t[0]);                          // x+y
+    fp2sub1271(A->y, A->x, t[1]);                          // y-x
+    fp2mul1271(A->x, A->y, t[2]);
+    fp2mul1271(t[2], (felm_t*)&PARAMETER_d, t[2]);
+    fp2add1271(t[2], t[2], t[2]);                          // 2dt = 2dxy
+    for (i = 0; i < 3; i++) {
+        mod1271(t[i][0]);
+        mod1271(t[i][1]);
+        memcpy(words + 4*i, t[i], 32);
+    }
+}
+
+
+static void fixed_base_table(unsigned int w, unsigned int v, uint64_t* table)
+{ // Table of the mLSB-set comb used by ecc_mul_fixed(): v blocks of 2^(w-1) points, where the u-th point of block j is
+  // 2^(j*e)*(1 + u_1*2^d + u_2*2^(2d) + ... + u_(w-1)*2^((w-1)d))*G for u = (u_(w-1),...,u_1) in binary, with e = ceil((bitlength(order)+1)/(w*v)) and d = e*v
+    unsigned int e = (NBITS_ORDER_PLUS_ONE + w*v - 1)/(w*v), d = e*v, npoints = 1 << (w-1);
+    unsigned int i, j, u, bit;
+    point_extproj_t B, P[10];
+    point_extproj* T = (point_extproj*)malloc(npoints*sizeof(point_extproj));
+
+    ecc_point_generator(B);
+    for (j = 0; j < v; j++) {
+        ecccopy(B, P[0]);                                  // P[i] = 2^(j*e + i*d)*G
+        for (i = 1; i < w; i++) {
+            ecccopy(P[i-1], P[i]);
+            for (u = 0; u < d; u++) {
+                ecc_point_double(P[i], P[i]);
+            }
+        }
+        ecccopy(P[0], (&T[0]));
+        for (u = 1; u < npoints; u++) {                    // T[u] = T[u - 2^bit] + P[bit+1], where 2^bit is the highest power of two in u
+            for (bit = 0; (u >> (bit+1)) != 0; bit++);
+            ecc_point_add((&T[u - (1 << bit)]), P[bit+1], (&T[u]));
+        }
+        for (u = 0; u < npoints; u++) {
+            table_entry((&T[u]), table + 12*(j*npoints + u));
+        }
+        for (u = 0; u < e; u++) {
+            ecc_point_double(B, B);
+        }
+    }
+    free(T);
+}
+
+
+#if (USE_ENDO == true)
+
+static void double_scalar_table(unsigned int wp, uint64_t* table)
+{ // Table used by ecc_mul_double(): the odd multiples P, 3P, ..., (2^(wp-1)-1)P of P = G, phi(G), psi(G) and psi(phi(G))
+    unsigned int i, j, npoints = 1 << (wp-2);
+    point_extproj_t P[4], P2, T;
+
+    ecc_point_generator(P[0]);
+    ecccopy(P[0], P[1]);
+    ecc_phi(P[1]);
+    ecccopy(P[0], P[2]);
+    ecc_psi(P[2]);
+    ecccopy(P[1], P[3]);
+    ecc_psi(P[3]);
+
+    for (j = 0; j < 4; j++) {
+        ecc_point_double(P[j], P2);
+        ecccopy(P[j], T);
+        for (i = 0; i < npoints; i++) {
+            table_entry(T, table + 12*(j*npoints + i));
+            ecc_point_add(T, P2, T);
+        }
+    }
+}
+
+#endif
+
+
+static void print_table(FILE* out, const char* name, const uint64_t* table, unsigned int npoints, unsigned int words)
+{ // One point per line, in the layout of FourQ_tables.h. With words = 8, only (x+y,y-x) is printed
+    unsigned int i, j;
+
+    fprintf(out, "static const uint64_t %s[%u] = {\n", name, npoints*words);
+    for (i = 0; i < npoints; i++) {
+        fprintf(out, "%s", (i == 0) ? "  " : ", ");
+        for (j = 0; j < words; j++) {
+            fprintf(out, "0x%016llx%s", (unsigned long long)table[12*i + j], (j < words-1) ? ", " : "");
+        }
+        fprintf(out, "%s\n", (i == npoints-1) ? " };" : "");
+    }
+}
+
+
+static void print_sizes(char* text, size_t size, unsigned int npoints)
+{ // Memory requirement of a table of npoints points, with and without COMPACT_TABLES
+    snprintf(text, size, "%gKB, or %gKB with COMPACT_TABLES (storage for %u points)", npoints*96/1024.0, npoints*64/1024.0, npoints);
+}
+
+
+static int generate(FILE* out, unsigned int w, unsigned int v, unsigned int wp, unsigned int wq)
+{ // Configuration header with the parameters and the tables. Returns 0 on success
+    unsigned int nfixed = v*(1 << (w-1)), ndouble = 4*(1 << (wp-2));
+    uint64_t *fixed = (uint64_t*)malloc(12*nfixed*sizeof(uint64_t)), *dbl = (uint64_t*)malloc(12*ndouble*sizeof(uint64_t));
+    char sizes[2][128];
+
+    if (fixed == NULL || dbl == NULL) {
+        free(fixed); free(dbl);
+        return 1;
+    }
+    fixed_base_table(w, v, fixed);
+#if (USE_ENDO == true)
+    double_scalar_table(wp, dbl);
+#else
+    fprintf(stderr, "fourq_tables: DOUBLE_SCALAR_TABLE requires endomorphisms, build with USE_ENDO\n");
+    free(fixed); free(dbl);
+    return 1;
+#endif
+    print_sizes(sizes[0], sizeof(sizes[0]), nfixed);
+    print_sizes(sizes[1], sizeof(sizes[1]), ndouble);
+
+    fprintf(out, "/***********************************************************************************\n");
+    fprintf(out, "* FourQlib: a high-performance crypto library based on the elliptic curve FourQ\n*\n");
+    fprintf(out, "* Abstract: tuned parameters and precomputation tables, generated by fourq_tables\n");
+    fprintf(out, "*\n* Used instead of the defaults of FourQ.h and FourQ_tables.h with TUNED=TRUE.\n");
+    fprintf(out, "************************************************************************************/\n\n");
+    fprintf(out, "#ifndef __FOURQ_TUNED_H__\n#define __FOURQ_TUNED_H__\n\n\n");
+    fprintf(out, "// Basic parameters for fixed-base scalar multiplication\n");
+    fprintf(out, "#define W_FIXEDBASE       %-2u                           // Memory requirement: %s.\n", w, sizes[0]);
+    fprintf(out, "#define V_FIXEDBASE       %u\n\n\n", v);
+    fprintf(out, "// Basic parameters for double scalar multiplication\n");
+    fprintf(out, "#define WP_DOUBLEBASE     %-2u                           // Memory requirement: %s.\n", wp, sizes[1]);
+    fprintf(out, "#define WQ_DOUBLEBASE     %u\n\n\n#endif\n\n\n", wq);
+
+    fprintf(out, "// Tables, included by FourQ_tables.h\n\n");
+    fprintf(out, "#if defined(__TABLES_H__) && !defined(__FOURQ_TUNED_TABLES_H__)\n#define __FOURQ_TUNED_TABLES_H__\n\n");
+    fprintf(out, "// The table below was generated using window width W = %u and table parameter V = %u (see http://eprint.iacr.org/2013/158).\n", w, v);
+    fprintf(out, "// Number of point entries = %u * 2^%u = %u points, where each point (x,y) is represented using coordinates (x+y,y-x,2*d*t).\n", v, w-1, nfixed);
+    fprintf(out, "// Table size = %u * 3 * 256 = %gKB\n\n", nfixed, nfixed*96/1024.0);
+    fprintf(out, "#if defined(COMPACT_TABLES)\n\n");
+    fprintf(out, "// Compact layout, selected with COMPACT_TABLES: each point (x,y) is stored as (x+y,y-x) and 2*d*t is recomputed after every lookup.\n");
+    fprintf(out, "// Table size = %u * 2 * 256 = %gKB\n\n", nfixed, nfixed*64/1024.0);
+    print_table(out, "FIXED_BASE_TABLE", fixed, nfixed, 8);
+    fprintf(out, "\n#else\n\n");
+    print_table(out, "FIXED_BASE_TABLE", fixed, nfixed, 12);
+    fprintf(out, "\n#endif\n\n\n");
+    fprintf(out, "// The table below consists of four mini-tables each generated using window width W = %u.\n", wp);
+    fprintf(out, "// Number of point entries = 4 * 2^%u = %u points, where each point (x,y) is represented using coordinates (x+y,y-x,2*d*t).\n", wp-2, ndouble);
+    fprintf(out, "// Table size = %u * 3 * 256 = %gKB\n\n", ndouble, ndouble*96/1024.0);
+    fprintf(out, "#if defined(COMPACT_TABLES)\n\n");
+    fprintf(out, "// Compact layout, selected with COMPACT_TABLES: each point (x,y) is stored as (x+y,y-x) and 2*d*t is recomputed after every lookup.\n");
+    fprintf(out, "// Table size = %u * 2 * 256 = %gKB\n\n", ndouble, ndouble*64/1024.0);
+    print_table(out, "DOUBLE_SCALAR_TABLE", dbl, ndouble, 8);
+    fprintf(out, "\n#else\n\n");
+    print_table(out, "DOUBLE_SCALAR_TABLE", dbl, ndouble, 12);
+    fprintf(out, "\n#endif\n\n#endif\n");
+
+    free(fixed);
+    free(dbl);
+    return 0;
+}
+
+
+static int verify(void)
+{ // Check ecc_mul_fixed() and ecc_mul_double(), which use the compiled tables, against ecc_mul(). Returns 0 on success
+    point_t G, A, B, C;
+    point_extproj_t P, Q;
+    digit_t k[NWORDS_ORDER], l[NWORDS_ORDER];
+    unsigned int n;
+
+    eccset(G);
+    for (n = 0; n < VERIFY_LOOPS; n++) {
+        random_bytes((unsigned char*)k, sizeof(k));
+        random_bytes((unsigned char*)l, sizeof(l));
+        ecc_mul_fixed(k, A);                               // A = k*G
+        ecc_mul(G, k, B, false);
+        if (memcmp(A, B, sizeof(point_t)) != 0) {
+            return 1;
+        }
+        ecc_mul(G, l, B, false);                           // C = k*G + l*B
+        ecc_mul_double(k, B, l, C);
+        ecc_mul(B, l, B, false);
+        ecc_point_from_affine(A, P);
+        ecc_point_from_affine(B, Q);
+        ecc_point_add(P, Q, P);
+        ecc_point_to_affine(P, A);
+        if (memcmp(A, C, sizeof(point_t)) != 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+static void usage(void)
+{
+    printf("Usage: fourq_tables [options]\n\n");
+    printf("  --fixed W V         fixed-base window width and table parameter (default %d %d)\n", W_FIXEDBASE, V_FIXEDBASE);
+    printf("  --double WP WQ      double-scalar window widths of the generator and of the variable point (default %d %d)\n", WP_DOUBLEBASE, WQ_DOUBLEBASE);
+    printf("  --output FILE       write the configuration header to FILE instead of the standard output\n");
+    printf("  --verify            check the tables compiled into the library and exit\n");
+}
+
+
+int main(int argc, char** argv)
+{
+    unsigned int w = W_FIXEDBASE, v = V_FIXEDBASE, wp = WP_DOUBLEBASE, wq = WQ_DOUBLEBASE;
+    const char* output = NULL;
+    FILE* out = stdout;
+    int arg, status;
+
+    for (arg = 1; arg < argc; arg++) {
+        if (strcmp(argv[arg], "--fixed") == 0 && arg+2 < argc) {
+            w = (unsigned int)atoi(argv[++arg]);
+            v = (unsigned int)atoi(argv[++arg]);
+        } else if (strcmp(argv[arg], "--double") == 0 && arg+2 < argc) {
+            wp = (unsigned int)atoi(argv[++arg]);
+            wq = (unsigned int)atoi(argv[++arg]);
+        } else if (strcmp(argv[arg], "--output") == 0 && arg+1 < argc) {
+            output = argv[++arg];
+        } else if (strcmp(argv[arg], "--verify") == 0) {
+            status = verify();
+            printf("fourq_tables: W_FIXEDBASE = %d, V_FIXEDBASE = %d, WP_DOUBLEBASE = %d, WQ_DOUBLEBASE = %d: %s\n",
+                   W_FIXEDBASE, V_FIXEDBASE, WP_DOUBLEBASE, WQ_DOUBLEBASE, (status == 0) ? "PASSED" : "FAILED");
+            return status;
+        } else {
+            usage();
+            return (strcmp(argv[arg], "--help") == 0) ? 0 : 2;
+        }
+    }
+
+    // Ranges supported by mLSB_set_recode() and wNAF_recode(). L = w*d must differ from bitlength(order)+1
+    if (w < 2 || w > 10 || v < 1 || v > 10 || ((NBITS_ORDER_PLUS_ONE + w*v - 1)/(w*v))*v*w == NBITS_ORDER_PLUS_ONE) {
+        fprintf(stderr, "fourq_tables: unsupported fixed-base parameters W = %u, V = %u\n", w, v);
+        return 2;
+    }
+    if (wp < 3 || wp > 10 || wq < 2 || wq > 8) {
+        fprintf(stderr, "fourq_tables: unsupported double-scalar parameters WP = %u, WQ = %u\n", wp, wq);
+        return 2;
+    }
+
+    if (output != NULL) {
+        out = fopen(output, "w");
+        if (out == NULL) {
+            fprintf(stderr, "fourq_tables: cannot write %s\n", output);
+            return 1;
+        }
+    }
+    status = generate(out, w, v, wp, wq);
+    if (output != NULL) {
+        fclose(out);
+    }
+    return status;
+}
@@ -87,6 +87,35 @@ bool fp2_test()
     else { printf("  GF(p^2) squaring tests... FAILED"); printf("\n"); return false; }
     printf("\n");
 
+    // GF(p^2) multiplication and squaring known-answer tests with edge-case operands
+    // Each row contains a, b, a*b and a^2 as 64-bit words
+    {
+    static const uint64_t kat[4][16] = {
+        { 0xFFFFFFFFFFFFFFFE, 0x7FFFFFFFFFFFFFFF, 0x0000000000000001, 0x0000000000000000,   0xFFFFFFFFFFFFFFFE, 0x7FFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFE, 0x7FFFFFFFFFFFFFFF,   
+          0x0000000000000002, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,   0x0000000000000000, 0x0000000000000000, 0xFFFFFFFFFFFFFFFD, 0x7FFFFFFFFFFFFFFF },
+        { 0x0000000000000000, 0x4000000000000000, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000,   0x0000000000000000, 0x7FFFFFFFFFFFFFFF, 0x0000000000000000, 0x0000000000000001,   
+          0x7FFFFFFFFFFFFFFE, 0x4000000000000000, 0x7FFFFFFFFFFFFFFD, 0x0000000000000002,   0xFFFFFFFFFFFFFFFD, 0x2000000000000001, 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 },
+        { 0xF2A74DE452E6B438, 0x32899387269E0D37, 0x0C5C7FD0A6A3A450, 0x691F8412128B2F33,   0x1818E811892F902B, 0x4A98CC2E5D9DC9F8, 0xE8E25D940ED90475, 0x1B7B3AE681E74EF5,   
+          0x9B8EC37A8B3DDF48, 0x5288DEC80CF2AD0C, 0x6C0FFE67EB82453F, 0x1330E7E32400776C,   0x02E561CB79369174, 0x55DD015E95227968, 0x83A181DD9F1C6A03, 0x19D5A1B6440777B4 },
+        { 0xFFFFFFFFFFFFFFFE, 0x7FFFFFFFFFFFFFFF, 0x0000000000000000, 0x0000000000000000,   0x0000000000000000, 0x0000000000000000, 0xFFFFFFFFFFFFFFFE, 0x7FFFFFFFFFFFFFFF,   
+          0x0000000000000000, 0x0000000000000000, 0x0000000000000001, 0x0000000000000000,   0x0000000000000001, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 } };
+
+    passed = 1;
+    for (n=0; n<4; n++)
+    {
+        memcpy((unsigned char*)a, (unsigned char*)&kat[n][0], 32);
+        memcpy((unsigned char*)b, (unsigned char*)&kat[n][4], 32);
+        fp2mul1271(a, b, c);                                         // c = a*b
+        mod1271(c[0]); mod1271(c[1]);
+        fp2sqr1271(a, d);                                            // d = a^2
+        mod1271(d[0]); mod1271(d[1]);
+        if (fp2compare64((uint64_t*)c,(uint64_t*)&kat[n][8])!=0 || fp2compare64((uint64_t*)d,(uint64_t*)&kat[n][12])!=0) { passed=0; break; }
+    }
+    if (passed==1) printf("  GF(p^2) multiplication/squaring known-answer tests ............................................... PASSED");
+    else { printf("  GF(p^2) multiplication/squaring known-answer tests... FAILED"); printf("\n"); return false; }
+    printf("\n");
+    }
+
     // GF(p^2) inversion using p = 2^127-1
     passed = 1;
     for (n=0; n<TEST_LOOPS; n++)
@@ -102,6 +131,29 @@ bool fp2_test()
     }
     if (passed==1) printf("  GF(p^2) inversion tests.......................................................................... PASSED");
     else { printf("  GF(p^2) inversion tests... FAILED"); printf("\n"); return false; }
+    printf("\n");
+
+    // GF(p^2) square root using p = 2^127-1
+    passed = 1;
+    for (n=0; n<TEST_LOOPS; n++)
+    {
+        fp2random1271_test(a);  
+        
+        fp2sqr1271(a, b);                                           // b = a^2
+        mod1271(b[0]); mod1271(b[1]);
+        if (fp2issquare1271(b) != 1) { passed=0; break; }
+        fp2sqrt1271(b, c);                                          
+        fp2sqr1271(c, d);                                           // d = sqrt(b)^2 = b
+        mod1271(d[0]); mod1271(d[1]);
+        if (fp2compare64((uint64_t*)b,(uint64_t*)d)!=0) { passed=0; break; }
+
+        fp2zero1271(d); d[0][0] = 2; d[1][0] = 1;                   // d = 2+i, a non-square
+        if (fp2issquare1271(d) != 0) { passed=0; break; }
+        fp2mul1271(b, d, c);                                        // c = a^2*(2+i), a non-square
+        if (fp2issquare1271(c) != 0) { passed=0; break; }
+    }
+    if (passed==1) printf("  GF(p^2) square root tests........................................................................ PASSED");
+    else { printf("  GF(p^2) square root tests... FAILED"); printf("\n"); return false; }
     printf("\n");
 
 	// Modular addition, modulo the order of a curve
@@ -16,10 +16,45 @@
 #if (OS_TARGET == OS_LINUX) && (TARGET == TARGET_ARM || TARGET == TARGET_ARM64)
     #include <time.h>
 #endif
+#if (OS_TARGET == OS_LINUX) && (TARGET == TARGET_AMD64)
+    #include <emmintrin.h>
+#endif
+#if (OS_TARGET == OS_LINUX)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 
+#if (OS_TARGET == OS_LINUX) && (TARGET == TARGET_RV64)
+
+static int cycles_fd = -2;               // Cycle counter opened with perf_event_open, -1 if it is not available, -2 before the first use
+
+static int cycles_open(void)
+{ // Open a user-mode cycle counter for the calling thread. Since Linux 6.6, rdcycle traps in user mode unless kernel.perf_user_access=2
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = PERF_COUNT_HW_CPU_CYCLES;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    cycles_fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+    if (cycles_fd < 0) {
+        cycles_fd = -1;
+        fprintf(stderr, "  (no cycle counter: timings are rdtime ticks, not cycles)\n");
+    }
+    return cycles_fd;
+}
+
+#endif
+
+
 int64_t cpucycles(void)
 { // Access system counter for benchmarking
 #if (OS_TARGET == OS_WIN) && (TARGET == TARGET_AMD64 || TARGET == TARGET_x86)
@@ -31,6 +66,15 @@ int64_t cpucycles(void)
 
     asm volatile ("rdtsc\n\t" : "=a" (lo), "=d"(hi));
     return ((int64_t)lo) | (((int64_t)hi) << 32);
+#elif (OS_TARGET == OS_LINUX) && (TARGET == TARGET_RV64)
+    uint64_t cycles;
+    int fd = (cycles_fd == -2) ? cycles_open() : cycles_fd;
+
+    if (fd >= 0 && read(fd, &cycles, sizeof(cycles)) == (ssize_t)sizeof(cycles)) {
+        return (int64_t)cycles;
+    }
+    asm volatile ("rdtime %0" : "=r" (cycles));       // The time CSR, unlike cycle, remains readable from user mode
+    return (int64_t)cycles;
 #elif (OS_TARGET == OS_LINUX) && (TARGET == TARGET_ARM || TARGET == TARGET_ARM64)
     struct timespec time;
 
@@ -169,3 +213,221 @@ bool verify_mLSB_recoding(uint64_t* scalar, int* digits)
 
     return true;
 }
+
+
+void print_op_counts_header(void)
+{ // Header of the operation-count tables printed by print_op_counts()
+    printf("  %-28s %7s %7s %6s %7s %7s %6s %6s %6s %6s %7s %7s\n", "Operation", "fpmul", "fpsqr", "fpinv", "fp2mul", "fp2sqr", "fp2inv", 
+           "dbl", "add", "madd", "lut1x8", "lutfix");
+}
+
+
+void print_op_counts(const char* name, const op_counts_t* counts)
+{ // Operation counts of a call, as one row of an operation-count table
+    printf("  %-28s %7llu %7llu %6llu %7llu %7llu %6llu %6llu %6llu %6llu %7llu %7llu\n", name, 
+           (unsigned long long)counts->fpmul, (unsigned long long)counts->fpsqr, (unsigned long long)counts->fpinv, 
+           (unsigned long long)counts->fp2mul, (unsigned long long)counts->fp2sqr, (unsigned long long)counts->fp2inv, 
+           (unsigned long long)counts->eccdouble, (unsigned long long)counts->eccadd, (unsigned long long)counts->eccmadd, 
+           (unsigned long long)counts->table_lookup_1x8, (unsigned long long)counts->table_lookup_fixed_base);
+}
+
+
+#if (TARGET != TARGET_AMD64)
+
+#define DEFAULT_EVICTION_BYTES  (64*1024*1024)   // Size of the eviction buffer if the size of the caches is unknown
+
+static size_t largest_cache(void)
+{ // Size in bytes of the largest cache of CPU 0, as reported by sysfs, or 0 if unknown
+    size_t largest = 0;
+#if (OS_TARGET == OS_LINUX)
+    char path[64], unit;
+    unsigned long value;
+    unsigned int i;
+    FILE* file;
+
+    for (i = 0; i < 8; i++) {
+        sprintf(path, "/sys/devices/system/cpu/cpu0/cache/index%u/size", i);
+        file = fopen(path, "r");
+        if (file == NULL) {
+            break;
+        }
+        unit = 'K';
+        if (fscanf(file, "%lu%c", &value, &unit) >= 1) {
+            value <<= (unit == 'M') ? 20 : ((unit == 'K') ? 10 : 0);
+            if ((size_t)value > largest) largest = (size_t)value;
+        }
+        fclose(file);
+    }
+#endif
+    return largest;
+}
+
+#endif
+
+
+void cache_evict(const void* address, size_t bytes)
+{ // Evict [address, address+bytes) from all cache levels. On x64, only these lines are flushed (clflush). Elsewhere, a buffer twice the size
+  // of the largest cache is read, which also evicts everything else
+#if (TARGET == TARGET_AMD64)
+    size_t i;
+
+    for (i = 0; i < bytes; i += 64) {
+        _mm_clflush((const char*)address + i);
+    }
+    _mm_mfence();
+#else
+    static unsigned char* buffer = NULL;
+    static size_t size = 0;
+    volatile unsigned char sink = 0;
+    size_t i;
+
+    (void)address; (void)bytes;
+    if (buffer == NULL) {
+        size = 2*largest_cache();
+        if (size == 0) {
+            size = DEFAULT_EVICTION_BYTES;
+        }
+        buffer = (unsigned char*)malloc(size);
+        if (buffer == NULL) {
+            return;
+        }
+        memset(buffer, 1, size);
+    }
+    for (i = 0; i < size; i += 64) {
+        sink += buffer[i];
+    }
+#endif
+}
+
+
+void evict_table(unsigned int Table)
+{ // Evict a precomputed table from the caches: the copy read by the calling thread if the tables were placed with ecc_tables_place(), 
+  // and otherwise the static table of the library. The tables of FourQ_tables.h are static, so a test that includes it has its own copy
+    const uint64_t* tables[NTABLES];
+    const uint64_t* placed = ecc_placed_table(Table);
+    size_t sizes[NTABLES];
+
+    ecc_static_tables(tables, sizes);
+    if (sizes[Table] != 0) {
+        cache_evict((placed != NULL) ? placed : tables[Table], sizes[Table]);
+    }
+}
+
+
+#if (OS_TARGET == OS_LINUX)
+
+static const struct { uint32_t type; uint64_t config; } perf_events[PERF_NCOUNTERS] = {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+    { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) }
+};
+
+#endif
+
+
+unsigned int perf_counters_open(perf_counters_t* counters)
+{ // Open the counters for the calling thread. They are put in one group, led by the first counter that opens, so that the kernel
+  // schedules them together and ratios such as IPC are taken over the same interval
+    unsigned int i, n = 0;
+#if (OS_TARGET == OS_LINUX)
+    struct perf_event_attr attr;
+    int leader = -1;
+
+    for (i = 0; i < PERF_NCOUNTERS; i++) {
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = perf_events[i].type;
+        attr.config = perf_events[i].config;
+        attr.disabled = (leader == -1);
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        counters->fd[i] = (int)syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0);
+        if (counters->fd[i] >= 0) {
+            if (leader == -1) {
+                leader = counters->fd[i];
+            }
+            n++;
+        } else {
+            counters->fd[i] = -1;
+        }
+    }
+#else
+    for (i = 0; i < PERF_NCOUNTERS; i++) {
+        counters->fd[i] = -1;
+    }
+#endif
+    return n;
+}
+
+
+#if (OS_TARGET == OS_LINUX)
+
+static int perf_leader(perf_counters_t* counters)
+{
+    unsigned int i;
+
+    for (i = 0; i < PERF_NCOUNTERS && counters->fd[i] < 0; i++);
+    return (i < PERF_NCOUNTERS) ? counters->fd[i] : -1;
+}
+
+#endif
+
+
+void perf_counters_start(perf_counters_t* counters)
+{ // Reset and start the counters
+#if (OS_TARGET == OS_LINUX)
+    int leader = perf_leader(counters);
+
+    if (leader >= 0) {
+        ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#else
+    (void)counters;
+#endif
+}
+
+
+void perf_counters_stop(perf_counters_t* counters, double* values)
+{ // Stop the counters and read them, scaled by time_enabled/time_running if the kernel multiplexed the group. A counter that never
+  // ran (e.g., because the group does not fit in the PMU) reads as -1
+    unsigned int i;
+#if (OS_TARGET == OS_LINUX)
+    int leader = perf_leader(counters);
+    uint64_t data[3];                    // value, time_enabled, time_running
+
+    if (leader >= 0) {
+        ioctl(leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    }
+    for (i = 0; i < PERF_NCOUNTERS; i++) {
+        values[i] = -1;
+        if (counters->fd[i] >= 0 && read(counters->fd[i], data, sizeof(data)) == (ssize_t)sizeof(data) && data[2] != 0) {
+            values[i] = (double)data[0]*((double)data[1]/(double)data[2]);
+        }
+    }
+#else
+    (void)counters;
+    for (i = 0; i < PERF_NCOUNTERS; i++) {
+        values[i] = -1;
+    }
+#endif
+}
+
+
+void perf_counters_close(perf_counters_t* counters)
+{ // Close the counters, members of the group before the leader
+    int i;
+
+    for (i = PERF_NCOUNTERS-1; i >= 0; i--) {
+#if (OS_TARGET == OS_LINUX)
+        if (counters->fd[i] >= 0) {
+            close(counters->fd[i]);
+        }
+#endif
+        counters->fd[i] = -1;
+    }
+}
\ No newline at end of file
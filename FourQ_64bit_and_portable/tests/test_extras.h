@@ -41,6 +41,44 @@ void random_order_test(digit_t* a);
 // Verification of the mLSB-set's recoding algorithm used in fixed-base scalar multiplication 
 bool verify_mLSB_recoding(uint64_t* scalar, int* digits);
 
+// Header of the operation-count tables printed by print_op_counts()
+void print_op_counts_header(void);
+
+// Operation counts of a call, as one row of an operation-count table
+void print_op_counts(const char* name, const op_counts_t* counts);
+
+// Evict a memory range, e.g., a precomputed table, from all cache levels (with clflush on x64, otherwise with a buffer sized from the largest cache)
+void cache_evict(const void* address, size_t bytes);
+
+// Evict the precomputed table TABLE_FIXED_BASE or TABLE_DOUBLE_SCALAR read by the library from all cache levels
+void evict_table(unsigned int Table);
+
+// Hardware performance counters, read with perf_event_open on Linux
+#define PERF_CORE_CYCLES      0          // Core clock cycles, which unlike the TSC slow down when the core is throttled
+#define PERF_INSTRUCTIONS     1
+#define PERF_L1D_MISSES       2          // L1 data cache read misses
+#define PERF_LLC_MISSES       3          // Last-level cache misses
+#define PERF_BRANCH_MISSES    4
+#define PERF_DTLB_MISSES      5          // Data TLB read misses
+#define PERF_NCOUNTERS        6
+
+typedef struct {
+    int fd[PERF_NCOUNTERS];              // -1 if the counter could not be opened
+} perf_counters_t;
+
+// Open the counters for the calling thread, counting in user mode only. Returns the number of counters that could be opened, 
+// which is 0 on other platforms, without a PMU (e.g., in some virtual machines) or when kernel.perf_event_paranoid forbids it
+unsigned int perf_counters_open(perf_counters_t* counters);
+
+// Reset and start the counters
+void perf_counters_start(perf_counters_t* counters);
+
+// Stop the counters and read them into values[PERF_NCOUNTERS], scaled if the kernel multiplexed them. Unavailable counters read as -1
+void perf_counters_stop(perf_counters_t* counters, double* values);
+
+// Close the counters
+void perf_counters_close(perf_counters_t* counters);
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,143 @@
+#!/bin/sh
+#
+# FourQlib: window-size autotuner
+#
+# Builds and benchmarks candidate window parameters for fixed-base and double scalar
+# multiplication, regenerating the precomputed tables for each one with fourq_tables,
+# and writes the fastest set to FourQ_tuned.h. Build with TUNED=TRUE to use it.
+#
+# Usage:  ./tune.sh [make options]
+#   e.g.  ./tune.sh ARCH=x64 "OPT=-O3 -fno-strict-aliasing"
+#
+# Environment:
+#   FIXED         candidate "W:V" pairs for W_FIXEDBASE and V_FIXEDBASE
+#   DOUBLE        candidate "WP:WQ" pairs for WP_DOUBLEBASE and WQ_DOUBLEBASE
+#   SAMPLES       samples per primitive passed to fourq_bench (default 2000)
+#   MAX_TABLE_KB  skip candidates whose table is larger than this (default: no limit)
+#   REPORT        speed versus memory report (default tune_report.txt)
+#
+# The fixed-base pass runs with the default double-scalar parameters, and the double-scalar
+# pass with the selected fixed-base parameters. W_VARBASE is not tuned: variable-base
+# scalar multiplication uses a fixed table of 8 points (see ecc_precomp()).
+
+FIXED=${FIXED:-"4:4 4:6 5:3 5:4 5:5 5:6 6:3 6:4 6:5 7:2 7:3 8:2"}
+DOUBLE=${DOUBLE:-"6:3 6:4 6:5 7:3 7:4 7:5 8:3 8:4 8:5 9:4 9:5"}
+SAMPLES=${SAMPLES:-2000}
+MAX_TABLE_KB=${MAX_TABLE_KB:-0}
+REPORT=${REPORT:-tune_report.txt}
+
+cd "$(dirname "$0")" || exit 1
+TMP=$(mktemp -d) || exit 1
+trap 'rm -rf "$TMP"' EXIT
+
+# Bytes per table point: (x+y,y-x,2dt), or (x+y,y-x) with COMPACT_TABLES
+POINT_BYTES=96
+for arg in "$@"; do
+    [ "$arg" = "COMPACT_TABLES=TRUE" ] && POINT_BYTES=64
+done
+
+fail()
+{
+    echo "tune.sh: $1" >&2
+    [ -f "$TMP/build.log" ] && tail -n 20 "$TMP/build.log" >&2
+    exit 1
+}
+
+build()
+{ # build TARGETS... -- MAKE_OPTIONS...
+    targets=
+    while [ "$1" != "--" ]; do targets="$targets $1"; shift; done
+    shift
+    make clean > /dev/null 2>&1
+    make "$@" $targets > "$TMP/build.log" 2>&1
+}
+
+measure()
+{ # measure W V WP WQ FILTER MAKE_OPTIONS...: median cycles of the primitives in FILTER, in the order of FILTER
+    w=$1; v=$2; wp=$3; wq=$4; filter=$5
+    shift 5
+    "$TMP/fourq_tables" --fixed "$w" "$v" --double "$wp" "$wq" --output FourQ_tuned.h > /dev/null || return 1
+    build fourq_bench fourq_tables -- "$@" TUNED=TRUE || return 1
+    ./fourq_tables --verify > /dev/null || return 1
+    ./fourq_bench --format csv --samples "$SAMPLES" --filter "$filter" > "$TMP/bench.csv" || return 1
+    for name in $(echo "$filter" | tr ',' ' '); do
+        awk -F, -v name="$name" '$1 == name { printf "%s ", $5 }' "$TMP/bench.csv"
+    done
+}
+
+fits()
+{ # fits BYTES: true if a table of BYTES bytes is within MAX_TABLE_KB
+    [ "$MAX_TABLE_KB" -eq 0 ] || [ "$1" -le $((MAX_TABLE_KB*1024)) ]
+}
+
+# The generator only uses the default tables, so it is built once
+build fourq_tables -- "$@" || fail "cannot build fourq_tables"
+cp fourq_tables "$TMP/" || exit 1
+eval "$(./fourq_tables --help | awk '/--fixed/ { sub(/\)/, "", $NF); print "W=" $(NF-1) " V=" $NF } /--double/ { sub(/\)/, "", $NF); print "WP=" $(NF-1) " WQ=" $NF }')"
+
+{
+    echo "FourQlib window-size tuning, make options: $*"
+    echo "Median cycles per call over $SAMPLES samples. Table sizes use $POINT_BYTES bytes per point."
+    echo
+    echo "Fixed-base scalar multiplication (WP_DOUBLEBASE = $WP, WQ_DOUBLEBASE = $WQ)"
+    echo
+    printf "  %2s %2s %12s %14s %23s %14s\n" W V "table bytes" ecc_mul_fixed SchnorrQ_KeyGeneration SchnorrQ_Sign
+} > "$REPORT"
+
+best=
+for pair in $FIXED; do
+    w=${pair%:*}; v=${pair#*:}
+    bytes=$((v*(1 << (w-1))*POINT_BYTES))
+    fits "$bytes" || continue
+    echo "tune.sh: W_FIXEDBASE = $w, V_FIXEDBASE = $v" >&2
+    result=$(measure "$w" "$v" "$WP" "$WQ" ecc_mul_fixed,SchnorrQ_KeyGeneration,SchnorrQ_Sign "$@") || { echo "tune.sh: skipped $w:$v" >&2; continue; }
+    read -r fixed keygen sign <<EOF
+$result
+EOF
+    printf "  %2s %2s %12s %14s %23s %14s\n" "$w" "$v" "$bytes" "$fixed" "$keygen" "$sign" >> "$REPORT"
+    if [ -z "$best" ] || awk -v a="$fixed" -v b="$best" 'BEGIN { exit !(a < b) }'; then
+        best=$fixed; W=$w; V=$v
+    fi
+done
+[ -n "$best" ] || fail "no fixed-base candidate could be measured"
+
+{
+    echo
+    echo "Double scalar multiplication (W_FIXEDBASE = $W, V_FIXEDBASE = $V)"
+    echo
+    printf "  %2s %2s %12s %12s %14s %15s\n" WP WQ "table bytes" "stack bytes" ecc_mul_double SchnorrQ_Verify
+} >> "$REPORT"
+
+best=
+for pair in $DOUBLE; do
+    wp=${pair%:*}; wq=${pair#*:}
+    bytes=$((4*(1 << (wp-2))*POINT_BYTES))
+    stack=$((4*(1 << (wq-2))*128))
+    fits "$bytes" || continue
+    echo "tune.sh: WP_DOUBLEBASE = $wp, WQ_DOUBLEBASE = $wq" >&2
+    result=$(measure "$W" "$V" "$wp" "$wq" ecc_mul_double,SchnorrQ_Verify "$@") || { echo "tune.sh: skipped $wp:$wq" >&2; continue; }
+    read -r double verify <<EOF
+$result
+EOF
+    printf "  %2s %2s %12s %12s %14s %15s\n" "$wp" "$wq" "$bytes" "$stack" "$double" "$verify" >> "$REPORT"
+    if [ -z "$best" ] || awk -v a="$double" -v b="$best" 'BEGIN { exit !(a < b) }'; then
+        best=$double; WP=$wp; WQ=$wq
+    fi
+done
+[ -n "$best" ] || fail "no double-scalar candidate could be measured"
+
+# Final configuration, checked with the full test suite
+"$TMP/fourq_tables" --fixed "$W" "$V" --double "$WP" "$WQ" --output FourQ_tuned.h || fail "cannot write FourQ_tuned.h"
+build all -- "$@" TUNED=TRUE || fail "cannot build the tuned configuration"
+./fourq_tables --verify > /dev/null || fail "the tuned tables are incorrect"
+if { ./ecc_test; ./crypto_test; } 2>&1 | grep -q FAILED; then
+    fail "the tests failed with the tuned configuration"
+fi
+
+{
+    echo
+    echo "Selected: W_FIXEDBASE = $W, V_FIXEDBASE = $V, WP_DOUBLEBASE = $WP, WQ_DOUBLEBASE = $WQ"
+} >> "$REPORT"
+cat "$REPORT"
+echo
+echo "FourQ_tuned.h written, build with TUNED=TRUE to use it."
@@ -99,13 +99,46 @@ extern "C" {
 #define NBITS_ORDER_PLUS_ONE  246+1 
 
 
+// Memory profiles
+// The precomputed tables for fixed-base and double scalar multiplication are constant and reside in flash. The table for 
+// the input point of double scalar multiplication and the wNAF digits are computed on the stack at every call.
+// _PROFILE_MIN_RAM_:   smallest tables and 8-bit wNAF digits. Flash: 9KB of tables, ecc_mul_double() stack: ~2.5KB below max-speed.
+// _PROFILE_BALANCED_:  max-speed fixed-base table, smaller double-base table and 8-bit wNAF digits. Flash: 13.5KB of tables, ecc_mul_double() stack: ~1.5KB below max-speed.
+// Default (max-speed): largest tables and word-sized wNAF digits. Flash: 31.5KB of tables.
+
+#if defined(_PROFILE_MIN_RAM_)
+    #define PROFILE_MIN_RAM
+#elif defined(_PROFILE_BALANCED_)
+    #define PROFILE_BALANCED
+#else
+    #define PROFILE_MAX_SPEED
+#endif
+
+#if defined(PROFILE_MIN_RAM) || defined(PROFILE_BALANCED)
+    #define COMPACT_WNAF_DIGITS           // wNAF digits are stored as int8_t
+#endif
+
+
 // Basic parameters for fixed-base scalar multiplication
-#define W_FIXEDBASE       5              // Memory requirement: 7.5KB (storage for 80 points).
-#define V_FIXEDBASE       5               
+#if defined(PROFILE_MIN_RAM)
+    #define W_FIXEDBASE   4              // Memory requirement: 3KB (storage for 32 points).
+    #define V_FIXEDBASE   4
+#else
+    #define W_FIXEDBASE   5              // Memory requirement: 7.5KB (storage for 80 points).
+    #define V_FIXEDBASE   5
+#endif
 
 // Basic parameters for double scalar multiplication
-#define WP_DOUBLEBASE     8              // Memory requirement: 24KB (storage for 256 points).
-#define WQ_DOUBLEBASE     4   
+#if defined(PROFILE_MIN_RAM)
+    #define WP_DOUBLEBASE 6              // Memory requirement: 6KB (storage for 64 points).
+    #define WQ_DOUBLEBASE 3              // Stack requirement: 1KB (4 tables with 2 points).
+#elif defined(PROFILE_BALANCED)
+    #define WP_DOUBLEBASE 6              // Memory requirement: 6KB (storage for 64 points).
+    #define WQ_DOUBLEBASE 4              // Stack requirement: 2KB (4 tables with 4 points).
+#else
+    #define WP_DOUBLEBASE 8              // Memory requirement: 24KB (storage for 256 points).
+    #define WQ_DOUBLEBASE 4              // Stack requirement: 2KB (4 tables with 4 points).
+#endif
    
 
 // FourQ's basic element definitions and point representations
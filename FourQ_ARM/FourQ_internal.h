@@ -48,6 +48,16 @@ typedef uint64_t uint128_t[2];
 // Basic parameters for double scalar multiplication
 #define NPOINTS_DOUBLEMUL_WP   (1 << (WP_DOUBLEBASE-2)) 
 #define NPOINTS_DOUBLEMUL_WQ   (1 << (WQ_DOUBLEBASE-2)) 
+#define NDIGITS_WNAF           65
+
+#if defined(COMPACT_WNAF_DIGITS)
+    typedef int8_t  wnaf_digit_t;        // Digits are in [-(2^(w-1)-1), 2^(w-1)-1]
+    #if (WP_DOUBLEBASE > 8) || (WQ_DOUBLEBASE > 8)
+        #error -- "Unsupported window width for 8-bit wNAF digits"
+    #endif
+#else
+    typedef int     wnaf_digit_t;
+#endif
    
 
 // FourQ's point representations        
@@ -297,7 +307,7 @@ void mLSB_set_recode(uint64_t* scalar, unsigned int *digits);
 void ecc_precomp_double(point_extproj_t P, point_extproj_precomp_t* Table, unsigned int npoints);
 
 // Computes wNAF recoding of a scalar
-void wNAF_recode(uint64_t scalar, unsigned int w, int* digits);
+void wNAF_recode(uint64_t scalar, unsigned int w, wnaf_digit_t* digits);
 
 // Encode point P
 void encode(point_t P, unsigned char* Pencoded);
@@ -836,8 +836,9 @@ bool ecc_mul_double(digit_t* k, point_t Q, digit_t* l, point_t R)
 
 #if (USE_ENDO == true)
     unsigned int position;
-    int i, digits_k1[65] = {0}, digits_k2[65] = {0}, digits_k3[65] = {0}, digits_k4[65] = {0};
-    int digits_l1[65] = {0}, digits_l2[65] = {0}, digits_l3[65] = {0}, digits_l4[65] = {0};
+    int i;
+    wnaf_digit_t digits_k1[NDIGITS_WNAF] = {0}, digits_k2[NDIGITS_WNAF] = {0}, digits_k3[NDIGITS_WNAF] = {0}, digits_k4[NDIGITS_WNAF] = {0};
+    wnaf_digit_t digits_l1[NDIGITS_WNAF] = {0}, digits_l2[NDIGITS_WNAF] = {0}, digits_l3[NDIGITS_WNAF] = {0}, digits_l4[NDIGITS_WNAF] = {0};
     point_precomp_t V;
     point_extproj_t Q1, Q2, Q3, Q4, T;
     point_extproj_precomp_t U, Q_table1[NPOINTS_DOUBLEMUL_WQ], Q_table2[NPOINTS_DOUBLEMUL_WQ], Q_table3[NPOINTS_DOUBLEMUL_WQ], Q_table4[NPOINTS_DOUBLEMUL_WQ];
@@ -993,7 +994,7 @@ void ecc_precomp_double(point_extproj_t P, point_extproj_precomp_t* Table, unsig
 }
 
 
-void wNAF_recode(uint64_t scalar, unsigned int w, int* digits)
+void wNAF_recode(uint64_t scalar, unsigned int w, wnaf_digit_t* digits)
 { // Computes wNAF recoding of a scalar, where digits are in set {0,+-1,+-3,...,+-(2^(w-1)-1)}
     unsigned int i;
     int digit, index = 0; 
@@ -1018,7 +1019,7 @@ void wNAF_recode(uint64_t scalar, unsigned int w, int* digits)
             if (digit < 0) {         // scalar + 1
                 k += 1;
             }
-            digits[index] = digit; 
+            digits[index] = (wnaf_digit_t)digit; 
                        
             if (k != 0) {            // Check if scalar != 0
                 for (i = 0; i < (w-1); i++) 
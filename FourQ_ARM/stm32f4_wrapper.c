@@ -9,7 +9,9 @@
 
 void clock_setup(void)
 {
+#if !defined(_QEMU_)                // The PLL is not emulated by qemu-system-arm
 	rcc_clock_setup_hse_3v3(&hse_8mhz_3v3[CLOCK_3V3_48MHZ]);
+#endif
 	rcc_periph_clock_enable(RCC_GPIOD);
     rcc_periph_clock_enable(RCC_GPIOA);
     rcc_periph_clock_enable(RCC_USART2);
@@ -56,9 +58,34 @@ void send_USART_str(const unsigned char* in)
 
 void signal_host(void) 
 {
+#if defined(_QEMU_)
+    // Semihosting SYS_EXIT with ADP_Stopped_ApplicationExit terminates the emulator
+    register unsigned int r0 __asm__("r0") = 0x18;
+    register unsigned int r1 __asm__("r1") = 0x20026;
+    __asm__ volatile ("bkpt 0xab" : : "r"(r0), "r"(r1) : "memory");
+#else
     usart_send_blocking(USART2, (char)4);
+#endif
 }
 
+#if defined(_QEMU_)
+
+void random_int(uint32_t* urnd, int n)
+{ // The RNG peripheral is not emulated by qemu-system-arm. Xorshift generator for emulation runs only. NOT FOR PRODUCTION USE.
+	static uint32_t state = 0x12345678;
+	int i;
+
+	for(i = 0; i < n; i++)
+	{
+	    state ^= state << 13;
+	    state ^= state >> 17;
+	    state ^= state << 5;
+	    urnd[i] = state;
+	}
+}
+
+#else
+
 void random_int(uint32_t* urnd, int n)
 {
 	unsigned int last_value=0;
@@ -77,4 +104,6 @@ void random_int(uint32_t* urnd, int n)
 	    last_value = new_value;
 	    urnd[i] = new_value;
 	}
-}
\ No newline at end of file
+}
+
+#endif
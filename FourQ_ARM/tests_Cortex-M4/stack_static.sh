@@ -0,0 +1,77 @@
+#!/bin/sh
+# Static worst-case stack depth of the API functions, from the call graphs written by GCC with -fcallgraph-info=su.
+# Usage: stack_static.sh <file.S>... <file.ci>...
+# The frames of the assembly functions are taken from their "push" instructions. Functions without a known frame
+# (e.g., library calls) are counted as 0 bytes and listed, and a recursive call makes the result unbounded.
+# STACK_TARGET is the target triple of the compiler that wrote the call graphs. Depths computed for any target other
+# than ARM are host approximations: their frames differ from Thumb-2 and they are not Cortex-M4 figures.
+
+case "$*" in
+    *.ci*) ;;
+    *) echo "No call graph files (.ci): compile the library with -fcallgraph-info=su from a clean tree"; exit 1 ;;
+esac
+
+case "${STACK_TARGET:-unknown}" in
+    arm*) echo "Static stack depth, target $STACK_TARGET:" ;;
+    *) echo "Static stack depth, target ${STACK_TARGET:-unknown} (host approximation, not a Cortex-M4 figure):" ;;
+esac
+
+awk '
+FILENAME ~ /\.S$/ {
+    if ($0 ~ /^[A-Za-z_][A-Za-z_0-9]*:/) { sub(/:.*/, "", $0); label = $0; next }
+    if (label != "" && $1 == "push") {
+        regs = $0; sub(/.*\{/, "", regs); sub(/\}.*/, "", regs)
+        n = split(regs, r, ",")
+        for (i = 1; i <= n; i++) {
+            if (r[i] ~ /-/) { split(r[i], b, "-"); gsub(/[^0-9]/, "", b[1]); gsub(/[^0-9]/, "", b[2]); frame[label] += 4*(b[2]-b[1]+1) }
+            else frame[label] += 4
+        }
+    }
+    next
+}
+/^node:/ {
+    name = $0; sub(/.*title: "/, "", name); sub(/".*/, "", name); sub(/.*:/, "", name)
+    if ($0 ~ /[0-9]+ bytes/) { nb = $0; sub(/ bytes.*/, "", nb); sub(/.*\\n/, "", nb); frame[name] = nb + 0 }
+    if ($0 ~ /dynamic[^,]/ || $0 ~ /dynamic"/) dynamic[name] = 1
+    next
+}
+/^edge:/ {
+    s = $0; sub(/.*sourcename: "/, "", s); sub(/".*/, "", s); sub(/.*:/, "", s)
+    t = $0; sub(/.*targetname: "/, "", t); sub(/".*/, "", t); sub(/.*:/, "", t)
+    if (!((s, t) in seen)) { seen[s, t] = 1; ncallees[s]++; callee[s, ncallees[s]] = t }
+    next
+}
+
+function depth(f,    i, d, m) {
+    if (f in memo) return memo[f]
+    if (f in active) { recursive = 1; return 0 }
+    if (!(f in frame)) unknown[f] = 1
+    if (f in dynamic) unbounded = 1
+    active[f] = 1
+    m = 0
+    for (i = 1; i <= ncallees[f]; i++) {
+        d = depth(callee[f, i])
+        if (d > m) m = d
+    }
+    delete active[f]
+    memo[f] = frame[f] + m
+    return memo[f]
+}
+
+END {
+    napi = split("ecc_mul ecc_mul_fixed ecc_mul_double KeyGeneration SecretAgreement CompressedKeyGeneration CompressedSecretAgreement " \
+                 "SchnorrQ_FullKeyGeneration SchnorrQ_Sign SchnorrQ_Verify", api, " ")
+    for (i = 1; i <= napi; i++) {
+        if (!(api[i] in frame)) continue
+        printf("  %-30s %8u bytes\n", api[i], depth(api[i]))
+    }
+    if (recursive) printf("  WARNING: recursive calls, the depths above are not bounds\n")
+    if (unbounded) printf("  WARNING: functions with unbounded dynamic stack allocation\n")
+    n = 0
+    for (f in unknown) list[++n] = f
+    if (n > 0) {
+        printf("  Counted as 0 bytes (no frame information):")
+        for (i = 1; i <= n; i++) printf(" %s", list[i])
+        printf("\n")
+    }
+}' "$@"
@@ -0,0 +1,201 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: measurement of the worst-case stack depth of the API functions
+*
+* A window of RAM below the current stack pointer is painted with a known pattern before
+* each call, and the deepest overwritten word is located afterwards. The reported depths are
+* Cortex-M4 figures only when this program runs on the board or under qemu-system-arm.
+************************************************************************************/
+
+#include "../FourQ_internal.h"
+#include "../FourQ_params.h"
+#include "test_extras.h"
+#include "../stm32f4_wrapper.h"
+#include <stdio.h>
+
+// Test parameters
+#define STACK_LOOPS       10       // Number of calls per measurement; the maximum is reported
+#define STACK_PATTERN     0xA5A5A5A5
+#define STACK_WINDOW      8192     // Number of words painted below the stack pointer (32KB)
+#define STACK_MARGIN      16       // Number of words left unpainted below the stack pointer
+
+extern unsigned int _ebss;         // End of .bss, defined by the linker script
+static unsigned int *stack_top, *stack_bottom;
+
+
+static void print_test(const char *text)
+{
+    unsigned char output[100];
+
+    sprintf((char*)output, "%s", text);
+    send_USART_str(output);
+}
+
+
+static void print_stack(const char *s, unsigned int bytes)
+{
+  unsigned char output[100];
+
+  sprintf((char*)output, "%s %8u bytes", s, bytes);
+  send_USART_str(output);
+}
+
+
+static void __attribute__((noinline)) stack_paint(void)
+{ // Paint the stack window below the caller's frame. The heap right after .bss is left untouched
+    unsigned int* p;
+
+    __asm__ volatile ("mov %0, sp" : "=r"(stack_top));
+    stack_bottom = stack_top - STACK_WINDOW;
+    if (stack_bottom < &_ebss + STACK_MARGIN) {
+        stack_bottom = &_ebss + STACK_MARGIN;
+    }
+    p = stack_bottom;
+    while (p < (stack_top - STACK_MARGIN)) {
+        *p++ = STACK_PATTERN;
+    }
+}
+
+
+static unsigned int stack_depth(void)
+{ // Number of bytes of stack used below the painted frame since the last call to stack_paint()
+  // A result equal to the window size means that the window was exceeded
+    unsigned int* p = stack_bottom;
+
+    while (p < stack_top && *p == STACK_PATTERN) {
+        p++;
+    }
+    return (unsigned int)(stack_top - p)*sizeof(unsigned int);
+}
+
+
+#define STACK_MEASURE(max, call)  { unsigned int depth; stack_paint(); call; depth = stack_depth(); if (depth > max) max = depth; }
+
+
+ECCRYPTO_STATUS ecc_stack_run()
+{ // Stack depth of the curve functions
+    unsigned int n, max_mul = 0, max_fixed = 0, max_double = 0;
+    point_t A, B;
+    uint64_t k[4], l[4];
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    print_test("\n--------------------------------------------------------------------------------------------------------\n");
+    print_test("Stack depth of the curve functions: \n");
+
+    for (n = 0; n < STACK_LOOPS; n++)
+    {
+        random_scalar_test(k);
+        random_scalar_test(l);
+        eccset(A);
+        STACK_MEASURE(max_mul, ecc_mul(A, (digit_t*)k, B, false));
+        STACK_MEASURE(max_fixed, ecc_mul_fixed((digit_t*)k, A));
+        STACK_MEASURE(max_double, ecc_mul_double((digit_t*)k, B, (digit_t*)l, A));
+    }
+    print_stack("  Scalar multiplication (ecc_mul) uses ....................................... ", max_mul);
+    print_stack("  Fixed-base scalar multiplication (ecc_mul_fixed) uses ...................... ", max_fixed);
+    print_stack("  Double scalar multiplication (ecc_mul_double) uses ......................... ", max_double);
+
+    return Status;
+}
+
+
+ECCRYPTO_STATUS crypto_stack_run()
+{ // Stack depth of the key exchange and signature functions
+    unsigned int n, valid = false;
+    unsigned int max_keygen = 0, max_agree = 0, max_ckeygen = 0, max_cagree = 0, max_skeygen = 0, max_sign = 0, max_verify = 0;
+    unsigned char SecretKeyA[32], PublicKeyA[64], SecretKeyB[32], PublicKeyB[64], SharedSecret[32], Signature[64];
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    print_test("\n--------------------------------------------------------------------------------------------------------\n");
+    print_test("Stack depth of the key exchange and signature functions: \n");
+
+    for (n = 0; n < STACK_LOOPS; n++)
+    {
+        Status = KeyGeneration(SecretKeyB, PublicKeyB);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        STACK_MEASURE(max_keygen, Status = KeyGeneration(SecretKeyA, PublicKeyA));
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        STACK_MEASURE(max_agree, Status = SecretAgreement(SecretKeyA, PublicKeyB, SharedSecret));
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+
+        Status = CompressedKeyGeneration(SecretKeyB, PublicKeyB);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        STACK_MEASURE(max_ckeygen, Status = CompressedKeyGeneration(SecretKeyA, PublicKeyA));
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        STACK_MEASURE(max_cagree, Status = CompressedSecretAgreement(SecretKeyA, PublicKeyB, SharedSecret));
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+
+        STACK_MEASURE(max_skeygen, Status = SchnorrQ_FullKeyGeneration(SecretKeyA, PublicKeyA));
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        STACK_MEASURE(max_sign, Status = SchnorrQ_Sign(SecretKeyA, PublicKeyA, SharedSecret, 32, Signature));
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        STACK_MEASURE(max_verify, Status = SchnorrQ_Verify(PublicKeyA, SharedSecret, 32, Signature, &valid));
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        if (valid == false) {
+            return ECCRYPTO_ERROR_SIGNATURE_VERIFICATION;
+        }
+    }
+    print_stack("  KeyGeneration uses ......................................................... ", max_keygen);
+    print_stack("  SecretAgreement uses ....................................................... ", max_agree);
+    print_stack("  CompressedKeyGeneration uses ............................................... ", max_ckeygen);
+    print_stack("  CompressedSecretAgreement uses ............................................. ", max_cagree);
+    print_stack("  SchnorrQ_FullKeyGeneration uses ............................................ ", max_skeygen);
+    print_stack("  SchnorrQ_Sign uses ......................................................... ", max_sign);
+    print_stack("  SchnorrQ_Verify uses ....................................................... ", max_verify);
+
+    return Status;
+}
+
+
+int main()
+{
+    clock_setup();
+    gpio_setup();
+    usart_setup(115200);
+    rng_setup();
+
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+#if defined(PROFILE_MIN_RAM)
+    print_test("\nMemory profile: MIN_RAM");
+#elif defined(PROFILE_BALANCED)
+    print_test("\nMemory profile: BALANCED");
+#else
+    print_test("\nMemory profile: MAX_SPEED");
+#endif
+
+    Status = ecc_stack_run();         // Stack depth of the curve functions
+    if (Status != ECCRYPTO_SUCCESS) {
+        print_test("\n\n   Error detected \n\n");
+        return false;
+    }
+    Status = crypto_stack_run();      // Stack depth of the key exchange and signature functions
+    if (Status != ECCRYPTO_SUCCESS) {
+        print_test("\n\n   Error detected \n\n");
+        return false;
+    }
+    signal_host();
+
+    return 0;
+}
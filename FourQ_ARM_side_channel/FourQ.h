@@ -90,6 +90,10 @@ extern "C" {
 
 // Full table randomization selection for additional protection against side-channel attacks
 //#define FULL_TABLE_RANDOMIZATION
+
+// Lower-cost point randomization: the accumulator is re-randomized inside every doubling instead of randomizing the
+// extracted point after every table lookup. Ignored if FULL_TABLE_RANDOMIZATION is selected
+//#define DOUBLING_RANDOMIZATION
    
 
 // FourQ's basic element definitions and point representations
@@ -44,6 +44,11 @@ typedef uint64_t uint128_t[2];
 // Basic parameters for double scalar multiplication
 #define NPOINTS_DOUBLEMUL_WP   (1 << (WP_DOUBLEBASE-2)) 
 #define NPOINTS_DOUBLEMUL_WQ   (1 << (WQ_DOUBLEBASE-2)) 
+
+
+// Number of digits processed by the variable-base scalar multiplication ecc_mul_SCA_secure(). The sub-scalars produced  
+// by randomize() are below 2^72 (64-bit sub-scalars plus four 8-bit multiples of lattice vectors with entries below 2^62)
+#define NDIGITS_SCA       72
    
 
 // FourQ's point representations        
@@ -235,6 +240,9 @@ void R1_to_R2(point_extproj_t P, point_extproj_precomp_t Q);
 // Point doubling 2P
 void eccdouble(point_extedwards_t P);
 
+// Point doubling 2P with randomization of the output coordinates using a random field element
+void eccdouble_randomized(point_extedwards_t P, felm_t random);
+
 // Complete point addition P = P+Q or P = P+P
 void eccadd(point_extedwards_t P, point_extedwards_t Q, point_extedwards_t R);  
 void eccadd_core(point_extedwards_t P, point_extedwards_t Q, point_extedwards_t R, f2elm_t Ta, f2elm_t Tb);
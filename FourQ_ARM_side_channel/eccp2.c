@@ -460,8 +460,8 @@ void decompose(uint64_t* k, uint64_t* scalars)
 
 void randomize(uint64_t* scalars, unsigned char* r, uint128_t* random_scalars)
 { // Scalar randomization for the variable-base scalar multiplication
-  // Input: 4 64-bit sub-scalars, and 4 16-bit random values.
-  // Output: 4 80-bit sub-scalars. 
+  // Input: 4 64-bit sub-scalars, and 4 8-bit random values.
+  // Output: 4 72-bit sub-scalars. 
     uint128_t tt0;
     uint64_t r0 = (uint64_t)r[0], r1 = (uint64_t)r[1];
     uint64_t r2 = (uint64_t)r[2], r3 = (uint64_t)r[3];
@@ -511,8 +511,9 @@ void randomize(uint64_t* scalars, unsigned char* r, uint128_t* random_scalars)
 
 void recode(uint128_t* scalars, unsigned int* digits)
 { // Recoding sub-scalars for use in the variable-base scalar multiplication. 
-  // Input: 4 80-bit sub-scalars passed through "scalars", which are obtained after calling randomize().
-  // Outputs: "digits" array with 80 nonzero entries. Each entry is in the range [0, 15], corresponding to one entry in the precomputed table.
+  // Input: 4 sub-scalars passed through "scalars", which are obtained after calling randomize() and are below 2^NDIGITS_SCA = 2^72.
+  // Outputs: "digits" array with 80 entries, whose top 80-NDIGITS_SCA entries are always zero. Each entry is in the range [0, 15], corresponding 
+  //          to one entry in the precomputed table. ecc_mul_SCA_secure() only processes the lower NDIGITS_SCA entries, in every randomization mode.
     unsigned int i, bit;
 
     for (i = 0; i < 64; i++)
@@ -610,7 +611,7 @@ bool ecc_mul_SCA_secure(point_t P, point_t R, digit_t* k, point_t Q, bool clear_
     unsigned char rand_bytes[8];
     digit_t bit;
     f2elm_t Ta, Tb;
-    felm_t rand_felmt[82]; 
+    felm_t rand_felmt[NDIGITS_SCA+2]; 
     int i;
 
     point_setup(P, PP);                                       // Convert to representation (X,Y,1,T)    
@@ -626,13 +627,13 @@ bool ecc_mul_SCA_secure(point_t P, point_t R, digit_t* k, point_t Q, bool clear_
         return false;
     }
 
-    RandomBytesFunction((unsigned char*)rand_felmt[0], 82*16);
-    bit = rand_felmt[81][NWORDS_FIELD-1] >> (RADIX-1);
-    for (i = 0; i < 82; i++) {    
+    RandomBytesFunction((unsigned char*)rand_felmt[0], (NDIGITS_SCA+2)*16);
+    bit = rand_felmt[NDIGITS_SCA+1][NWORDS_FIELD-1] >> (RADIX-1);
+    for (i = 0; i < NDIGITS_SCA+2; i++) {    
         rand_felmt[i][NWORDS_FIELD-1] &= (digit_t)(-1) >> 1;
     }
     
-    felmt_randomize_point(RR, rand_felmt[81]);                // Randomization of R's coordinates  
+    felmt_randomize_point(RR, rand_felmt[NDIGITS_SCA+1]);     // Randomization of R's coordinates  
     ecccopy(RR, S);                                           // Update R = ((-1)^b*3)*R  
     eccdouble(RR);                                            
     eccadd(S, RR, S);    
@@ -641,7 +642,7 @@ bool ecc_mul_SCA_secure(point_t P, point_t R, digit_t* k, point_t Q, bool clear_
     fp2neg1271(S->t); 
     select_f2elm(RR->y, S->y, bit, RR->y); 
     select_f2elm(RR->t, S->t, bit, RR->t);                                     
-    felmt_randomize_point(PP, rand_felmt[80]);                // Randomization of P's coordinates                
+    felmt_randomize_point(PP, rand_felmt[NDIGITS_SCA]);       // Randomization of P's coordinates                
      
     decompose((uint64_t*) k, scalars);                        // Scalar decomposition
     RandomBytesFunction(&rand_bytes[0], 8);
@@ -650,13 +651,17 @@ bool ecc_mul_SCA_secure(point_t P, point_t R, digit_t* k, point_t Q, bool clear_
     ecc_precomp(PP, RR, Table);                               // Precomputation
     ecccopy(RR, PP);                                          
     
-    for (i = 79; i >= 0; i--)
+    for (i = NDIGITS_SCA-1; i >= 0; i--)                      // The top 80-NDIGITS_SCA digits are always zero
     {
+#if defined(FULL_TABLE_RANDOMIZATION)
         eccdouble(PP);                                        // P = 2*P using representations (X,Y,Z,T) <- 2*(X,Y,Z)
-#ifdef FULL_TABLE_RANDOMIZATION
         randomize_table(Table, rand_felmt[i]);                // Randomization of the full table
         table_lookup_1x16(Table, S, digits[i]);               // Extract point S in (X+Y,Y-X,2Z,2dT) representation
+#elif defined(DOUBLING_RANDOMIZATION)
+        eccdouble_randomized(PP, rand_felmt[i]);              // P = 2*P with randomization of P's coordinates
+        table_lookup_1x16(Table, S, digits[i]);               // Extract point S in (X+Y,Y-X,2Z,2dT) representation
 #else   
+        eccdouble(PP);                                        // P = 2*P using representations (X,Y,Z,T) <- 2*(X,Y,Z)
         table_lookup_1x16(Table, S, digits[i]);               // Extract point S in (X+Y,Y-X,2Z,2dT) representation
         felmt_randomize_point(S, rand_felmt[i]);              // Randomization of the extracted point
 #endif
@@ -737,6 +742,35 @@ void eccdouble(point_extedwards_t P)
 }
 
 
+void eccdouble_randomized(point_extedwards_t P, felm_t random)
+{ // Point doubling 2P with randomization of the output coordinates
+  // Input: P = (X1:Y1:Z1:T1) in twisted Edwards coordinates, and a random field element
+  // Output: 2P = (Xfinal,Yfinal,Zfinal,Tfinal) in extended twisted Edwards coordinates, where all the coordinates are multiplied by "random".
+  // Each output coordinate is the product of exactly one of 2X1Y1 and Y1^2-X1^2, so randomizing these two values costs
+  // 4 field multiplications instead of the 8 required by felmt_randomize_point()
+    f2elm_t t1, t2, t3;  
+
+    fp2sqr1271(P->x, t1);                  // t1 = X1^2
+    fp2sqr1271(P->y, P->t);                // T = Y1^2
+    fp2add1271(P->x, P->y, P->x);          // X1 = X1+Y1
+    fp2add1271(t1, P->t, t2);              // t2 = X1^2+Y1^2      
+    fp2sub1271(P->t, t1, t1);              // t1 = Y1^2-X1^2  
+    fp2sqr1271(P->z, P->t);                // T = Z1^2       
+    fp2sqr1271(P->x, t3);                  // t3 = (X1+Y1)^2  
+    fp2add1271(P->t, P->t, P->t);          // T = 2Z1^2   
+    fp2sub1271(t3, t2, t3);                // t3 = 2X1*Y1 = (X1+Y1)^2-(X1^2+Y1^2)
+    fp2sub1271(P->t, t1, P->t);            // T = 2Z1^2-(Y1^2-X1^2) 
+    fpmul1271(t1[0], random, t1[0]);       // t1 = random*(Y1^2-X1^2)
+    fpmul1271(t1[1], random, t1[1]);
+    fpmul1271(t3[0], random, t3[0]);       // t3 = random*2X1*Y1
+    fpmul1271(t3[1], random, t3[1]);
+    fp2mul1271(t1, t2, P->y);              // Yfinal = random*(X1^2+Y1^2)(Y1^2-X1^2)  
+    fp2mul1271(P->t, t3, P->x);            // Xfinal = random*2X1Y1*[2Z1^2-(Y1^2-X1^2)]
+    fp2mul1271(t1, P->t, P->z);            // Zfinal = random*(Y1^2-X1^2)[2Z1^2-(Y1^2-X1^2)]
+    fp2mul1271(t2, t3, P->t);              // Tfinal = random*2X1Y1*(X1^2+Y1^2)
+}
+
+
 void eccadd_core(point_extedwards_t P, point_extedwards_t Q, point_extedwards_t R, f2elm_t Ta, f2elm_t Tb)      
 { // Basic point addition R = P+Q or R = P+P
   // Inputs: P = (X1,Y1,Z1,T1) in extended twisted Edwards coordinates
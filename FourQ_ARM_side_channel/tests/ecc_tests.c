@@ -27,6 +27,7 @@ bool ecc_test()
     point_t A, R;
     point_extedwards_t P, Q;
     f2elm_t t1;
+    felm_t r;
     uint64_t scalar[4], res_x[4], res_y[4];
 
     
@@ -54,6 +55,25 @@ bool ecc_test()
     if (passed==1) printf("  Point doubling tests .................................................................... PASSED");
     else { printf("  Point doubling tests ... FAILED"); printf("\n"); return false; }
     printf("\n");
+
+    // Point doubling with randomization of the output coordinates
+    passed = 1;
+    eccset(A); 
+    point_setup(A, P);
+
+    for (n=0; n<TEST_LOOPS; n++)
+    {
+        random_felmt(r);
+        eccdouble_randomized(P, r);        // 2*P
+    }
+    eccnorm(P, A);
+    mod1271(A->x[0]); mod1271(A->x[1]);    // Fully reduced P
+    mod1271(A->y[0]); mod1271(A->y[1]);  
+
+    if (fp2compare64((uint64_t*)A->x, res_x)!=0 || fp2compare64((uint64_t*)A->y, res_y)!=0) passed=0;
+    if (passed==1) printf("  Randomized point doubling tests ......................................................... PASSED");
+    else { printf("  Randomized point doubling tests ... FAILED"); printf("\n"); return false; }
+    printf("\n");
    
     // Point addition
     eccset(A); 
@@ -225,6 +245,7 @@ bool ecc_run()
     point_t A, B, R;
     point_extedwards_t P, Q, RR, Table[16];
     f2elm_t t1;    
+    felm_t r;
     uint64_t scalar[4];
         
     printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
@@ -247,6 +268,38 @@ bool ecc_run()
     printf("  Point doubling runs in ...                                       %8lld nsec", nsec/(BENCH_LOOPS*1000));
     printf("\n");
 
+    // Point doubling with randomization of the output coordinates
+    eccset(A);
+    point_setup(A, P);
+    random_felmt(r);
+
+    nsec = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        nsec1 = cpu_nseconds();
+        for (i = 0; i < 1000; i++) {
+            eccdouble_randomized(P, r);
+        }
+        nsec2 = cpu_nseconds();
+        nsec = nsec+(nsec2-nsec1);
+    }
+    printf("  Randomized point doubling runs in ...                            %8lld nsec", nsec/(BENCH_LOOPS*1000));
+    printf("\n");
+
+    // Point randomization
+    nsec = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        nsec1 = cpu_nseconds();
+        for (i = 0; i < 1000; i++) {
+            felmt_randomize_point(P, r);
+        }
+        nsec2 = cpu_nseconds();
+        nsec = nsec+(nsec2-nsec1);
+    }
+    printf("  Point randomization runs in ...                                  %8lld nsec", nsec/(BENCH_LOOPS*1000));
+    printf("\n");
+
     // Point addition (twisted Edwards a=-1)
     eccset(A);
     point_setup(A, P);
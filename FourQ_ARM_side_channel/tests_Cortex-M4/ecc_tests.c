@@ -50,6 +50,7 @@ bool ecc_test()
     point_t A, R;
     point_extedwards_t P, Q;
     f2elm_t t1;
+    felm_t r;
     uint64_t scalar[4], res_x[4], res_y[4];
         
     print_test("\n--------------------------------------------------------------------------------------------------------\n"); 
@@ -75,6 +76,24 @@ bool ecc_test()
     if (fp2compare64((uint64_t*)A->x, res_x)!=0 || fp2compare64((uint64_t*)A->y, res_y)!=0) passed=0;
     if (passed==1) print_test("  Point doubling tests .................................................................... PASSED");
     else { print_test("  Point doubling tests ... FAILED"); print_test("\n"); return false; }
+
+    // Point doubling with randomization of the output coordinates
+    passed = 1;
+    eccset(A); 
+    point_setup(A, P);
+
+    for (n=0; n<TEST_LOOPS; n++)
+    {
+        random_felmt(r);
+        eccdouble_randomized(P, r);        // 2*P
+    }
+    eccnorm(P, A);
+    mod1271(A->x[0]); mod1271(A->x[1]);    // Fully reduced P
+    mod1271(A->y[0]); mod1271(A->y[1]);  
+
+    if (fp2compare64((uint64_t*)A->x, res_x)!=0 || fp2compare64((uint64_t*)A->y, res_y)!=0) passed=0;
+    if (passed==1) print_test("  Randomized point doubling tests ......................................................... PASSED");
+    else { print_test("  Randomized point doubling tests ... FAILED"); print_test("\n"); return false; }
    
     // Point addition
     eccset(A); 
@@ -241,6 +260,7 @@ bool ecc_run()
     point_t A, B, R;
     point_extedwards_t P, Q, RR, Table[16];
     f2elm_t t1;    
+    felm_t r;
     uint64_t scalar[4];
         
     print_test("\n--------------------------------------------------------------------------------------------------------\n"); 
@@ -262,6 +282,36 @@ bool ecc_run()
     }
     print_bench("  Point doubling runs in ...                                       ", cycles/(BENCH_LOOPS*10));
 
+    // Point doubling with randomization of the output coordinates
+    eccset(A);
+    point_setup(A, P);
+    random_felmt(r);
+
+    cycles = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        for (i = 0; i < 10; i++) {
+            eccdouble_randomized(P, r);
+        }
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    print_bench("  Randomized point doubling runs in ...                            ", cycles/(BENCH_LOOPS*10));
+
+    // Point randomization
+    cycles = 0;
+    for (n=0; n<BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        for (i = 0; i < 10; i++) {
+            felmt_randomize_point(P, r);
+        }
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    print_bench("  Point randomization runs in ...                                  ", cycles/(BENCH_LOOPS*10));
+
     // Point addition (twisted Edwards a=-1)
     eccset(A);
     point_setup(A, P);
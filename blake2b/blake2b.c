@@ -0,0 +1,161 @@
+/*
+BLAKE2b with 64-byte output and no key, following RFC 7693.
+Public domain.
+*/
+
+#include "blake2b.h"
+
+typedef unsigned long long uint64;
+
+static uint64 load_littleendian(const unsigned char *x)
+{
+  return
+      (uint64) (x[0]) \
+  | (((uint64) (x[1])) << 8) \
+  | (((uint64) (x[2])) << 16) \
+  | (((uint64) (x[3])) << 24) \
+  | (((uint64) (x[4])) << 32) \
+  | (((uint64) (x[5])) << 40) \
+  | (((uint64) (x[6])) << 48) \
+  | (((uint64) (x[7])) << 56)
+  ;
+}
+
+static void store_littleendian(unsigned char *x,uint64 u)
+{
+  x[0] = (unsigned char)u; u >>= 8;
+  x[1] = (unsigned char)u; u >>= 8;
+  x[2] = (unsigned char)u; u >>= 8;
+  x[3] = (unsigned char)u; u >>= 8;
+  x[4] = (unsigned char)u; u >>= 8;
+  x[5] = (unsigned char)u; u >>= 8;
+  x[6] = (unsigned char)u; u >>= 8;
+  x[7] = (unsigned char)u;
+}
+
+static const uint64 iv[8] = {
+  0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+  0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL, 0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
+};
+
+static const unsigned char sigma[12][16] = {
+  {  0, 1, 2, 3, 4, 5, 6, 7, 8, 9,10,11,12,13,14,15 },
+  { 14,10, 4, 8, 9,15,13, 6, 1,12, 0, 2,11, 7, 5, 3 },
+  { 11, 8,12, 0, 5, 2,15,13,10,14, 3, 6, 7, 1, 9, 4 },
+  {  7, 9, 3, 1,13,12,11,14, 2, 6, 5,10, 4, 0,15, 8 },
+  {  9, 0, 5, 7, 2, 4,10,15,14, 1,11,12, 6, 8, 3,13 },
+  {  2,12, 6,10, 0,11, 8, 3, 4,13, 7, 5,15,14, 1, 9 },
+  { 12, 5, 1,15,14,13, 4,10, 0, 7, 6, 3, 9, 2, 8,11 },
+  { 13,11, 7,14,12, 1, 3, 9, 5, 0,15, 4, 8, 6, 2,10 },
+  {  6,15,14, 9,11, 3, 0, 8,12, 2,13, 7, 1, 4,10, 5 },
+  { 10, 2, 8, 4, 7, 6, 1, 5,15,11, 9,14, 3,12,13, 0 },
+  {  0, 1, 2, 3, 4, 5, 6, 7, 8, 9,10,11,12,13,14,15 },
+  { 14,10, 4, 8, 9,15,13, 6, 1,12, 0, 2,11, 7, 5, 3 }
+};
+
+#define ROTR(x,c) (((x) >> (c)) | ((x) << (64 - (c))))
+
+#define G(a,b,c,d,x,y) \
+  a = a + b + x; d = ROTR(d ^ a,32); \
+  c = c + d;     b = ROTR(b ^ c,24); \
+  a = a + b + y; d = ROTR(d ^ a,16); \
+  c = c + d;     b = ROTR(b ^ c,63);
+
+static void compress(crypto_blake2b_state *state,const unsigned char *block,int last)
+{
+  uint64 m[16];
+  uint64 v[16];
+  int i;
+
+  for (i = 0;i < 16;++i) m[i] = load_littleendian(block + 8*i);
+  for (i = 0;i < 8;++i) {
+    v[i] = state->h[i];
+    v[i + 8] = iv[i];
+  }
+  v[12] ^= state->t[0];
+  v[13] ^= state->t[1];
+  if (last) v[14] = ~v[14];
+
+  for (i = 0;i < 12;++i) {
+    G(v[0],v[4],v[ 8],v[12],m[sigma[i][ 0]],m[sigma[i][ 1]])
+    G(v[1],v[5],v[ 9],v[13],m[sigma[i][ 2]],m[sigma[i][ 3]])
+    G(v[2],v[6],v[10],v[14],m[sigma[i][ 4]],m[sigma[i][ 5]])
+    G(v[3],v[7],v[11],v[15],m[sigma[i][ 6]],m[sigma[i][ 7]])
+    G(v[0],v[5],v[10],v[15],m[sigma[i][ 8]],m[sigma[i][ 9]])
+    G(v[1],v[6],v[11],v[12],m[sigma[i][10]],m[sigma[i][11]])
+    G(v[2],v[7],v[ 8],v[13],m[sigma[i][12]],m[sigma[i][13]])
+    G(v[3],v[4],v[ 9],v[14],m[sigma[i][14]],m[sigma[i][15]])
+  }
+
+  for (i = 0;i < 8;++i) state->h[i] ^= v[i] ^ v[i + 8];
+}
+
+static void increment_counter(crypto_blake2b_state *state,uint64 inc)
+{
+  state->t[0] += inc;
+  if (state->t[0] < inc) state->t[1]++;
+}
+
+int crypto_blake2b_init(crypto_blake2b_state *state)
+{
+  int i;
+
+  for (i = 0;i < 8;++i) state->h[i] = iv[i];
+  state->h[0] ^= 0x01010040;                  /* Parameter block: digest length 64, no key, fanout = depth = 1 */
+  state->t[0] = 0;
+  state->t[1] = 0;
+  state->used = 0;
+
+  return 0;
+}
+
+int crypto_blake2b_update(crypto_blake2b_state *state, const unsigned char *in, unsigned long long inlen)
+{
+  unsigned long long i;
+
+  /* The last block is compressed by crypto_blake2b_final(), so a full buffer is only compressed when more input follows */
+  while (inlen > 0) {
+    if (state->used == 128) {
+      increment_counter(state,128);
+      compress(state,state->buffer,0);
+      state->used = 0;
+    }
+    if (state->used == 0) {
+      while (inlen > 128) {
+        increment_counter(state,128);
+        compress(state,in,0);
+        in += 128;
+        inlen -= 128;
+      }
+    }
+    for (i = 0;i < inlen && state->used < 128;++i) state->buffer[state->used++] = in[i];
+    in += i;
+    inlen -= i;
+  }
+
+  return 0;
+}
+
+int crypto_blake2b_final(crypto_blake2b_state *state, unsigned char *out)
+{
+  unsigned long long i;
+
+  increment_counter(state,state->used);
+  for (i = state->used;i < 128;++i) state->buffer[i] = 0;
+  compress(state,state->buffer,1);
+
+  for (i = 0;i < 8;++i) store_littleendian(out + 8*i,state->h[i]);
+
+  return 0;
+}
+
+int crypto_blake2b(const unsigned char *in, unsigned long long inlen, unsigned char *out)
+{
+  crypto_blake2b_state state;
+
+  crypto_blake2b_init(&state);
+  crypto_blake2b_update(&state,in,inlen);
+  crypto_blake2b_final(&state,out);
+
+  return 0;
+}
@@ -0,0 +1,34 @@
+#ifndef __BLAKE2B_H__
+#define __BLAKE2B_H__
+
+
+// For C++
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+// Hashing using BLAKE2b (RFC 7693) without a key. Output is 64 bytes long
+int crypto_blake2b(const unsigned char *in, unsigned long long inlen, unsigned char *out);
+
+
+// Streaming interface: crypto_blake2b_init(), then crypto_blake2b_update() any number of times, then crypto_blake2b_final(). 
+// The output of crypto_blake2b_final() is 64 bytes long and equal to crypto_blake2b() of the concatenated inputs
+typedef struct {
+  unsigned long long h[8];
+  unsigned long long t[2];
+  unsigned char buffer[128];
+  unsigned long long used;
+} crypto_blake2b_state;
+
+int crypto_blake2b_init(crypto_blake2b_state *state);
+int crypto_blake2b_update(crypto_blake2b_state *state, const unsigned char *in, unsigned long long inlen);
+int crypto_blake2b_final(crypto_blake2b_state *state, unsigned char *out);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
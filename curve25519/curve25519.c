@@ -0,0 +1,157 @@
+/*
+Ed25519 (RFC 8032) and X25519 (RFC 7748) on top of the Curve25519 code of BoringSSL, for
+benchmarks against FourQ. The field, group and scalar arithmetic is in ring/, copied without
+changes from ring 0.17.14 (see ring/README.md); this file only adds the hashing and encodings
+of RFC 8032 and RFC 7748 around it. Fixed-base multiplications (key generation, signing and
+X25519 public keys) use the ref10 comb over precomputed multiples of the base point,
+verification the sliding-window double scalar multiplication of ref10, and X25519 the
+Montgomery ladder of fiat-crypto.
+*/
+
+#include "ring/crypto/curve25519/internal.h"
+#include "curve25519.h"
+#include "../sha512/sha512.h"
+#include <string.h>
+
+/* Exported by ring/crypto/curve25519/curve25519.c, without a declaration in its headers */
+int x25519_ge_frombytes_vartime(ge_p3 *h, const uint8_t s[32]);
+void x25519_ge_scalarmult_base(ge_p3 *h, const uint8_t a[32], int use_adx);
+void x25519_ge_double_scalarmult_vartime(ge_p2 *r, const uint8_t *a, const ge_p3 *A, const uint8_t *b);
+void x25519_sc_reduce(uint8_t s[64]);
+void x25519_sc_muladd(uint8_t *s, const uint8_t *a, const uint8_t *b, const uint8_t *c);
+void x25519_sc_mask(uint8_t a[32]);
+void x25519_fe_invert(fe *out, const fe *z);
+uint8_t x25519_fe_isnegative(const fe *f);
+void x25519_fe_mul_ttt(fe *h, const fe *f, const fe *g);
+void x25519_fe_neg(fe *f);
+void x25519_fe_tobytes(uint8_t s[32], const fe *h);
+void x25519_scalar_mult_generic_masked(uint8_t out[32], const uint8_t scalar_masked[32], const uint8_t point[32]);
+void x25519_public_from_private_generic_masked(uint8_t out_public_value[32], const uint8_t private_key_masked[32], int use_adx);
+
+/* Group order L, little endian */
+static const unsigned char L[32] = {
+  0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+};
+
+static int sc_is_canonical(const unsigned char *s)
+{
+  int i;
+  for (i = 31;i >= 0;--i) {
+    if (s[i] < L[i]) return 1;
+    if (s[i] > L[i]) return 0;
+  }
+  return 0;
+}
+
+static void ge_tobytes(unsigned char *s,const fe *X,const fe *Y,const fe *Z)
+{ /* y with the sign of x in the top bit */
+  fe recip, x, y;
+
+  x25519_fe_invert(&recip,Z);
+  x25519_fe_mul_ttt(&x,X,&recip);
+  x25519_fe_mul_ttt(&y,Y,&recip);
+  x25519_fe_tobytes(s,&y);
+  s[31] ^= x25519_fe_isnegative(&x) << 7;
+}
+
+
+/* Ed25519 */
+
+static void expand_secret(unsigned char *h,const unsigned char *sk)
+{
+  crypto_sha512(sk,32,h);
+  x25519_sc_mask(h);
+}
+
+void crypto_ed25519_public_key(const unsigned char *sk,unsigned char *pk)
+{
+  unsigned char h[64];
+  ge_p3 A;
+
+  expand_secret(h,sk);
+  x25519_ge_scalarmult_base(&A,h,0);
+  ge_tobytes(pk,&A.X,&A.Y,&A.Z);
+  memset(h,0,sizeof h);
+}
+
+void crypto_ed25519_sign(const unsigned char *sk,const unsigned char *pk,const unsigned char *m,unsigned long long mlen,unsigned char *sig)
+{
+  unsigned char h[64], nonce[64], hram[64];
+  crypto_sha512_state state;
+  ge_p3 R;
+
+  expand_secret(h,sk);
+
+  crypto_sha512_init(&state);
+  crypto_sha512_update(&state,h + 32,32);
+  crypto_sha512_update(&state,m,mlen);
+  crypto_sha512_final(&state,nonce);
+  x25519_sc_reduce(nonce);
+  x25519_ge_scalarmult_base(&R,nonce,0);
+  ge_tobytes(sig,&R.X,&R.Y,&R.Z);
+
+  crypto_sha512_init(&state);
+  crypto_sha512_update(&state,sig,32);
+  crypto_sha512_update(&state,pk,32);
+  crypto_sha512_update(&state,m,mlen);
+  crypto_sha512_final(&state,hram);
+  x25519_sc_reduce(hram);
+  x25519_sc_muladd(sig + 32,hram,h,nonce);
+
+  memset(h,0,sizeof h);
+  memset(nonce,0,sizeof nonce);
+}
+
+int crypto_ed25519_verify(const unsigned char *pk,const unsigned char *m,unsigned long long mlen,const unsigned char *sig)
+{
+  unsigned char hram[64], rcheck[32], diff = 0;
+  crypto_sha512_state state;
+  ge_p3 A;
+  ge_p2 R;
+  int i;
+
+  if (!sc_is_canonical(sig + 32)) return -1;
+  if (!x25519_ge_frombytes_vartime(&A,pk)) return -1;
+  x25519_fe_neg(&A.X);
+  x25519_fe_neg(&A.T);
+
+  crypto_sha512_init(&state);
+  crypto_sha512_update(&state,sig,32);
+  crypto_sha512_update(&state,pk,32);
+  crypto_sha512_update(&state,m,mlen);
+  crypto_sha512_final(&state,hram);
+  x25519_sc_reduce(hram);
+
+  x25519_ge_double_scalarmult_vartime(&R,hram,&A,sig + 32);   /* R = h*(-A) + S*B */
+  ge_tobytes(rcheck,&R.X,&R.Y,&R.Z);
+  for (i = 0;i < 32;++i) diff |= rcheck[i] ^ sig[i];
+  return diff ? -1 : 0;
+}
+
+
+/* X25519 */
+
+int crypto_x25519(unsigned char *q,const unsigned char *n,const unsigned char *p)
+{
+  unsigned char e[32], r = 0;
+  int i;
+
+  memcpy(e,n,32);
+  x25519_sc_mask(e);
+  x25519_scalar_mult_generic_masked(q,e,p);
+  memset(e,0,sizeof e);
+  for (i = 0;i < 32;++i) r |= q[i];
+  return r ? 0 : -1;
+}
+
+int crypto_x25519_base(unsigned char *q,const unsigned char *n)
+{
+  unsigned char e[32];
+
+  memcpy(e,n,32);
+  x25519_sc_mask(e);
+  x25519_public_from_private_generic_masked(q,e,0);
+  memset(e,0,sizeof e);
+  return 0;
+}
@@ -0,0 +1,35 @@
+#ifndef __CURVE25519_H__
+#define __CURVE25519_H__
+
+
+// For C++
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+// Ed25519 (RFC 8032) and X25519 (RFC 7748) over the unmodified Curve25519 code of BoringSSL (as shipped by ring, see
+// ring/README.md), used by curve_bench to compare FourQ against Curve25519 on the same machine.
+
+// Ed25519 public key from a 32-byte secret key
+void crypto_ed25519_public_key(const unsigned char *sk, unsigned char *pk);
+
+// Ed25519 signature of m: sig = R || S, 64 bytes
+void crypto_ed25519_sign(const unsigned char *sk, const unsigned char *pk, const unsigned char *m, unsigned long long mlen, unsigned char *sig);
+
+// Ed25519 verification. Returns 0 if sig is a valid signature of m under pk, -1 otherwise
+int crypto_ed25519_verify(const unsigned char *pk, const unsigned char *m, unsigned long long mlen, const unsigned char *sig);
+
+// X25519: q = n*p, where n is a 32-byte secret scalar and p a u-coordinate. Returns -1 if q is zero (small-order p), 0 otherwise
+int crypto_x25519(unsigned char *q, const unsigned char *n, const unsigned char *p);
+
+// X25519 public key: q = n*9
+int crypto_x25519_base(unsigned char *q, const unsigned char *n);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
@@ -76,6 +76,124 @@ static void store_bigendian(unsigned char *x,uint64 u)
   b = a; \
   a = T1 + T2;
 
+#if defined(_AVX2_)
+
+/* AVX2 variant: the message schedule of each block is computed four words at a time, 
+   and the rounds read W[t]+K[t] from memory. sigma1 depends on the words two positions
+   back, so every group of four words is completed in two halves of two words. */
+
+#include <immintrin.h>
+
+static const uint64 K[80] = {
+  0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
+  0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL, 0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
+  0xd807aa98a3030242ULL, 0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+  0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL, 0xc19bf174cf692694ULL,
+  0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL, 0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
+  0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+  0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL,
+  0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL, 0x06ca6351e003826fULL, 0x142929670a0e6e70ULL,
+  0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+  0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
+  0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL, 0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL,
+  0xd192e819d6ef5218ULL, 0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+  0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL,
+  0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL, 0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL,
+  0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+  0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL,
+  0xca273eceea26619cULL, 0xd186b8c721c0c207ULL, 0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL,
+  0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+  0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL, 0x431d67c49c100d4cULL,
+  0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL, 0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+};
+
+#define ROTR_256(x,c) _mm256_or_si256(_mm256_srli_epi64(x,c),_mm256_slli_epi64(x,64 - (c)))
+#define ROTR_128(x,c) _mm_or_si128(_mm_srli_epi64(x,c),_mm_slli_epi64(x,64 - (c)))
+#define sigma0_256(x) _mm256_xor_si256(_mm256_xor_si256(ROTR_256(x, 1),ROTR_256(x, 8)),_mm256_srli_epi64(x,7))
+#define sigma1_128(x) _mm_xor_si128(_mm_xor_si128(ROTR_128(x,19),ROTR_128(x,61)),_mm_srli_epi64(x,6))
+
+#define R(a,b,c,d,e,f,g,h,wk) \
+  T1 = h + Sigma1(e) + Ch(e,f,g) + wk; \
+  d += T1; \
+  h = T1 + Sigma0(a) + Maj(a,b,c);
+
+static int crypto_hashblocks_sha512(unsigned char *statebytes,const unsigned char *in,unsigned long long inlen)
+{
+  uint64 state[8];
+  uint64 W[80];
+  uint64 WK[80];
+  uint64 a;
+  uint64 b;
+  uint64 c;
+  uint64 d;
+  uint64 e;
+  uint64 f;
+  uint64 g;
+  uint64 h;
+  uint64 T1;
+  __m256i x;
+  __m128i lo, hi;
+  const __m256i bswap = _mm256_setr_epi8(7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8,7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8);
+  int t;
+
+  for (t = 0;t < 8;++t) state[t] = load_bigendian(statebytes + 8*t);
+
+  while (inlen >= 128) {
+    for (t = 0;t < 16;t += 4) {
+      x = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *) (in + 8*t)),bswap);
+      _mm256_storeu_si256((__m256i *) (W + t),x);
+      _mm256_storeu_si256((__m256i *) (WK + t),_mm256_add_epi64(x,_mm256_loadu_si256((const __m256i *) (K + t))));
+    }
+    for (t = 16;t < 80;t += 4) {
+      x = _mm256_add_epi64(_mm256_loadu_si256((const __m256i *) (W + t - 16)),sigma0_256(_mm256_loadu_si256((const __m256i *) (W + t - 15))));
+      x = _mm256_add_epi64(x,_mm256_loadu_si256((const __m256i *) (W + t - 7)));
+      lo = _mm_add_epi64(_mm256_castsi256_si128(x),sigma1_128(_mm_loadu_si128((const __m128i *) (W + t - 2))));
+      hi = _mm_add_epi64(_mm256_extracti128_si256(x,1),sigma1_128(lo));
+      x = _mm256_inserti128_si256(_mm256_castsi128_si256(lo),hi,1);
+      _mm256_storeu_si256((__m256i *) (W + t),x);
+      _mm256_storeu_si256((__m256i *) (WK + t),_mm256_add_epi64(x,_mm256_loadu_si256((const __m256i *) (K + t))));
+    }
+
+    a = state[0];
+    b = state[1];
+    c = state[2];
+    d = state[3];
+    e = state[4];
+    f = state[5];
+    g = state[6];
+    h = state[7];
+
+    for (t = 0;t < 80;t += 8) {
+      R(a,b,c,d,e,f,g,h,WK[t    ])
+      R(h,a,b,c,d,e,f,g,WK[t + 1])
+      R(g,h,a,b,c,d,e,f,WK[t + 2])
+      R(f,g,h,a,b,c,d,e,WK[t + 3])
+      R(e,f,g,h,a,b,c,d,WK[t + 4])
+      R(d,e,f,g,h,a,b,c,WK[t + 5])
+      R(c,d,e,f,g,h,a,b,WK[t + 6])
+      R(b,c,d,e,f,g,h,a,WK[t + 7])
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+
+    in += 128;
+    inlen -= 128;
+  }
+
+  for (t = 0;t < 8;++t) store_bigendian(statebytes + 8*t,state[t]);
+
+  return (int)inlen;
+}
+
+#else
+
 static int crypto_hashblocks_sha512(unsigned char *statebytes,const unsigned char *in,unsigned long long inlen)
 {
   uint64 state[8];
@@ -244,6 +362,8 @@ static int crypto_hashblocks_sha512(unsigned char *statebytes,const unsigned cha
   return (int)inlen;
 }
 
+#endif
+
 static const unsigned char iv[64] = {
   0x6a,0x09,0xe6,0x67,0xf3,0xbc,0xc9,0x08,
   0xbb,0x67,0xae,0x85,0x84,0xca,0xa7,0x3b,
@@ -257,19 +377,10 @@ static const unsigned char iv[64] = {
 
 typedef unsigned long long uint64;
 
-int crypto_sha512(const unsigned char *in, unsigned long long inlen, unsigned char *out)
+static void crypto_sha512_finish(unsigned char *h,const unsigned char *in,unsigned long long inlen,unsigned long long bytes,unsigned char *out)
 {
-  unsigned char h[64];
   unsigned char padded[256];
   int i;
-  unsigned long long bytes = inlen;
-
-  for (i = 0;i < 64;++i) h[i] = iv[i];
-
-  crypto_hashblocks_sha512(h,in,inlen);
-  in += inlen;
-  inlen &= 127;
-  in -= inlen;
 
   for (i = 0;i < inlen;++i) padded[i] = in[i];
   padded[inlen] = 0x80;
@@ -301,6 +412,64 @@ int crypto_sha512(const unsigned char *in, unsigned long long inlen, unsigned ch
   }
 
   for (i = 0;i < 64;++i) out[i] = h[i];
+}
+
+int crypto_sha512(const unsigned char *in, unsigned long long inlen, unsigned char *out)
+{
+  unsigned char h[64];
+  int i;
+  unsigned long long bytes = inlen;
+
+  for (i = 0;i < 64;++i) h[i] = iv[i];
+
+  crypto_hashblocks_sha512(h,in,inlen);
+  in += inlen;
+  inlen &= 127;
+  in -= inlen;
+
+  crypto_sha512_finish(h,in,inlen,bytes,out);
+
+  return 0;
+}
+
+int crypto_sha512_init(crypto_sha512_state *state)
+{
+  int i;
+
+  for (i = 0;i < 64;++i) state->h[i] = iv[i];
+  state->bytes = 0;
+
+  return 0;
+}
+
+int crypto_sha512_update(crypto_sha512_state *state, const unsigned char *in, unsigned long long inlen)
+{
+  unsigned long long used = state->bytes & 127;
+  unsigned long long i;
+
+  state->bytes += inlen;
+
+  if (used > 0) {
+    for (i = 0;i < inlen && used < 128;++i) state->buffer[used++] = in[i];
+    if (used < 128) return 0;
+    crypto_hashblocks_sha512(state->h,state->buffer,128);
+    in += i;
+    inlen -= i;
+  }
+
+  crypto_hashblocks_sha512(state->h,in,inlen);
+  in += inlen;
+  inlen &= 127;
+  in -= inlen;
+
+  for (i = 0;i < inlen;++i) state->buffer[i] = in[i];
+
+  return 0;
+}
+
+int crypto_sha512_final(crypto_sha512_state *state, unsigned char *out)
+{
+  crypto_sha512_finish(state->h,state->buffer,state->bytes & 127,state->bytes,out);
 
   return 0;
 }
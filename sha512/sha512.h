@@ -12,6 +12,19 @@ extern "C" {
 int crypto_sha512(const unsigned char *in, unsigned long long inlen, unsigned char *out);
 
 
+// Streaming interface: crypto_sha512_init(), then crypto_sha512_update() any number of times, then crypto_sha512_final(). 
+// The output of crypto_sha512_final() is 64 bytes long and equal to crypto_sha512() of the concatenated inputs
+typedef struct {
+  unsigned char h[64];
+  unsigned char buffer[128];
+  unsigned long long bytes;
+} crypto_sha512_state;
+
+int crypto_sha512_init(crypto_sha512_state *state);
+int crypto_sha512_update(crypto_sha512_state *state, const unsigned char *in, unsigned long long inlen);
+int crypto_sha512_final(crypto_sha512_state *state, unsigned char *out);
+
+
 #ifdef __cplusplus
 }
 #endif